@@ -106,6 +106,39 @@ struct FHoudiniEvent
 };
 
 
+// Per system instance data of the Houdini DI, updated once per tick in PerInstanceTick().
+// It holds the instance's spawn state, and the values that only depend on the instance's time (its age):
+// the range of points to spawn during this tick and, for point caches with a fixed topology, the frame bracket.
+// The VM functions and the GPU shader parameters read these values instead of computing them for each particle.
+struct FHoudiniNiagaraInstanceData
+{
+	// Time used for this tick's precomputed values, -FLT_MAX until the first tick
+	float Time = -FLT_MAX;
+
+	// Spawn state, kept across ticks
+	int32 LastSpawnedPointID = -1;
+	float LastSpawnTime = -FLT_MAX;
+	float LastSpawnTimeRequest = -FLT_MAX;
+
+	// Points to spawn during this tick
+	int32 SpawnMinID = -1;
+	int32 SpawnMaxID = -1;
+	int32 SpawnCount = 0;
+
+	// Frame bracket at Time, only valid for point caches with a fixed topology
+	bool bHasFrameIndexes = false;
+	int32 PrevFrameIndex = 0;
+	int32 NextFrameIndex = 0;
+	float FramePrevWeight = 1.0f;
+
+	void ResetSpawnState()
+	{
+		LastSpawnedPointID = -1;
+		LastSpawnTime = -FLT_MAX;
+		LastSpawnTimeRequest = -FLT_MAX;
+	}
+};
+
 /** Data Interface allowing sampling of UHoudiniPointCache assets (CSV, .json (binary) files) files. */
 UCLASS(EditInlineNew, Category = "Houdini Niagara", meta = (DisplayName = "Houdini Point Cache Info"))
 class HOUDININIAGARA_API UNiagaraDataInterfaceHoudini : public UNiagaraDataInterface
@@ -121,16 +154,43 @@ public:
 		SHADER_PARAMETER(int32, NumberOfSamples)
 		SHADER_PARAMETER(int32, NumberOfAttributes)
 		SHADER_PARAMETER(int32, NumberOfPoints)
+		SHADER_PARAMETER(int32, NumberOfFrames)
+		SHADER_PARAMETER(int32, NumberOfPointsPerFrame)
+		SHADER_PARAMETER(int32, NumberOfPointAttributes)
+		SHADER_PARAMETER(int32, NumberOfQuantizedColumns)
+		SHADER_PARAMETER(int32, NumberOfIntColumns)
+		SHADER_PARAMETER(int32, NumberOfVectorColumns)
+		SHADER_PARAMETER(float, SampleTimeStep)
+		SHADER_PARAMETER(int32, PositionInterpolation)
+		SHADER_PARAMETER(int32, SpawnTimesSorted)
 		SHADER_PARAMETER(int32, MaxNumberOfIndexesPerPoint)
 		SHADER_PARAMETER(int32, LastSpawnedPointId)
 		SHADER_PARAMETER(float, LastSpawnTime)
 		SHADER_PARAMETER(float, LastSpawnTimeRequest)
+		SHADER_PARAMETER(int32, SpawnMinPointId)
+		SHADER_PARAMETER(int32, SpawnMaxPointId)
+		SHADER_PARAMETER(int32, SpawnCount)
+		SHADER_PARAMETER(float, InstanceTime)
+		SHADER_PARAMETER(int32, InstancePrevFrameIndex)
+		SHADER_PARAMETER(int32, InstanceNextFrameIndex)
+		SHADER_PARAMETER(float, InstanceFramePrevWeight)
 		SHADER_PARAMETER_SRV(Buffer<float>, FloatValuesBuffer)
 		SHADER_PARAMETER_SRV(Buffer<int>, SpecialAttributeIndexesBuffer)
 		SHADER_PARAMETER_SRV(Buffer<float>, SpawnTimesBuffer)
-		SHADER_PARAMETER_SRV(Buffer<float>, LifeValuesBuffer)
-		SHADER_PARAMETER_SRV(Buffer<float>, PointTypesBuffer)
-		SHADER_PARAMETER_SRV(Buffer<int>, PointValueIndexesBuffer)
+		SHADER_PARAMETER_SRV(Buffer<float4>, PointRecordsBuffer)
+		SHADER_PARAMETER_SRV(Buffer<int>, PointSampleIndexOffsetsBuffer)
+		SHADER_PARAMETER_SRV(Buffer<int>, PointSampleIndexesBuffer)
+		SHADER_PARAMETER_SRV(Buffer<float>, FrameTimesBuffer)
+		SHADER_PARAMETER_SRV(Buffer<int>, FrameSampleIndexOffsetsBuffer)
+		SHADER_PARAMETER_SRV(Buffer<float>, PointAttributeValuesBuffer)
+		SHADER_PARAMETER_SRV(Buffer<int>, AttributeColumnIndexesBuffer)
+		SHADER_PARAMETER_SRV(Buffer<uint>, QuantizedValuesBuffer)
+		SHADER_PARAMETER_SRV(Buffer<float>, QuantizationParamsBuffer)
+		SHADER_PARAMETER_SRV(Buffer<int>, IntValuesBuffer)
+		SHADER_PARAMETER_SRV(Buffer<int>, AttributeIntColumnIndexesBuffer)
+		SHADER_PARAMETER_SRV(Buffer<float>, AliveIntervalIndexBuffer)
+		SHADER_PARAMETER_SRV(Buffer<int>, VectorColumnIndexesBuffer)
+		SHADER_PARAMETER_SRV(Buffer<float4>, VectorValuesBuffer)
 		SHADER_PARAMETER_SRV(Buffer<uint>, FunctionIndexToAttributeIndexBuffer)
 	END_SHADER_PARAMETER_STRUCT()
 public:
@@ -139,6 +199,13 @@ public:
 
 	UPROPERTY(EditAnywhere, Category = "Houdini Niagara", meta = (DisplayName = "Houdini Point Cache Asset"))
 	TObjectPtr<UHoudiniPointCache> HoudiniPointCacheAsset;
+
+	// Bakes the point cache's special attribute indexes and attribute layout into the GPU simulation shaders as constants,
+	// removing buffer reads and letting the shader compiler remove the unused branches.
+	// The shaders are recompiled when the point cache is reimported with a different layout.
+	// Don't enable it if the point cache asset is overridden at runtime, the shaders would use the layout of the default one.
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = "Houdini Niagara", meta = (DisplayName = "Specialize GPU Shaders"))
+	bool bSpecializeShaders;
 //#if ENGINE_MAJOR_VERSION==5 && ENGINE_MINOR_VERSION < 1
 //		UHoudiniPointCache* HoudiniPointCacheAsset;
 //#else
@@ -165,6 +232,14 @@ public:
 
 	virtual bool Equals(const UNiagaraDataInterface* Other) const override;
 
+	// Per instance data: spawn state and per tick precomputation
+	virtual bool InitPerInstanceData(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance) override;
+	virtual void DestroyPerInstanceData(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance) override;
+	virtual bool PerInstanceTick(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance, float DeltaSeconds) override;
+	virtual int32 PerInstanceDataSize() const override { return sizeof(FHoudiniNiagaraInstanceData); }
+	virtual bool HasPreSimulateTick() const override { return true; }
+	virtual void ProvidePerInstanceDataForRenderThread(void* DataForRenderThread, void* PerInstanceData, const FNiagaraSystemInstanceID& SystemInstance) override;
+
 	//----------------------------------------------------------------------------
 	// EXPOSED FUNCTIONS
 
@@ -172,31 +247,34 @@ public:
 	void GetFloatValue(FVectorVMExternalFunctionContext& Context);
 
 	// Returns a float value for a given sample index and attribute name in the point cache
-	void GetFloatValueByString(FVectorVMExternalFunctionContext& Context, const FString& Attribute);
+	void GetFloatValueByString(FVectorVMExternalFunctionContext& Context, int32 AttributeIndex);
+
+	// Returns the integer value at a given sample index and attribute index in the point cache
+	void GetIntValue(FVectorVMExternalFunctionContext& Context);
 
 	// Returns a Vector3 value for a given sample index in the point cache
 	void GetVectorValue(FVectorVMExternalFunctionContext& Context);
 
 	// Returns a Vector3 value for a given sample index in the point cache by attribute
-	void GetVectorValueByString(FVectorVMExternalFunctionContext& Context, const FString& Attribute);
+	void GetVectorValueByString(FVectorVMExternalFunctionContext& Context, int32 AttributeIndex);
 
 	// Returns a Vector3 value for a given sample index in the point cache
 	void GetVectorValueEx(FVectorVMExternalFunctionContext& Context);
 
 	// Returns a Vector3 value for a given sample index in the point cache by attribute
-	void GetVectorValueExByString(FVectorVMExternalFunctionContext& Context, const FString& Attribute);
+	void GetVectorValueExByString(FVectorVMExternalFunctionContext& Context, int32 AttributeIndex);
 
 	// Returns a Vector4 value for a given sample index in the point cache
 	void GetVector4Value(FVectorVMExternalFunctionContext& Context);
 
 	// Returns a Vector4 value for a given sample index in the point cache by attribute
-	void GetVector4ValueByString(FVectorVMExternalFunctionContext& Context, const FString& Attribute);
+	void GetVector4ValueByString(FVectorVMExternalFunctionContext& Context, int32 AttributeIndex);
 
 	// Returns a Quat value for a given sample index in the point cache
 	void GetQuatValue(FVectorVMExternalFunctionContext& Context);
 
 	// Returns a Quat value for a given sample index in the point cache by attribute
-	void GetQuatValueByString(FVectorVMExternalFunctionContext& Context, const FString& Attribute);
+	void GetQuatValueByString(FVectorVMExternalFunctionContext& Context, int32 AttributeIndex);
 
 	// Returns the positions for a given sample index in the point cache
 	void GetPosition(FVectorVMExternalFunctionContext& Context);
@@ -234,42 +312,87 @@ public:
 	// Returns the indexes (min, max) and number of points that should be spawned at time t
 	void GetPointIDsToSpawnAtTime(FVectorVMExternalFunctionContext& Context);
 
+	// Returns the indexes (min, max) and number of points that should be spawned during this tick, precomputed for the system instance
+	void GetPointIDsToSpawn(FVectorVMExternalFunctionContext& Context);
+
+	// Returns the number of points alive at time t, and the range of point IDs (min, max) containing them
+	void GetAlivePointsAtTime(FVectorVMExternalFunctionContext& Context);
+
 	// Returns the position for a given point at a given time
 	void GetPointPositionAtTime(FVectorVMExternalFunctionContext& Context);
 
 	// Returns a float value for a given point at a given time 
 	void GetPointValueAtTime(FVectorVMExternalFunctionContext& Context);
 
+	// Returns an integer value for a given point at a given time, without interpolation
+	void GetPointIntValueAtTime(FVectorVMExternalFunctionContext& Context);
+
 	// Returns a float value by attribute name for a given point at a given time 
-	void GetPointValueAtTimeByString(FVectorVMExternalFunctionContext& Context, const FString& Attribute);
+	void GetPointValueAtTimeByString(FVectorVMExternalFunctionContext& Context, int32 AttributeIndex);
 
 	// Returns a Vector value for a given point at a given time
 	void GetPointVectorValueAtTime(FVectorVMExternalFunctionContext& Context);
 
 	// Returns a Vector value by attribute name for a given point at a given time
-	void GetPointVectorValueAtTimeByString(FVectorVMExternalFunctionContext& Context, const FString& Attribute);
+	void GetPointVectorValueAtTimeByString(FVectorVMExternalFunctionContext& Context, int32 AttributeIndex);
 
 	// Returns a Vector value for a given point at a given time
 	void GetPointVectorValueAtTimeEx(FVectorVMExternalFunctionContext& Context);
 
 	// Returns a Vector value by attribute name for a given point at a given time
-	void GetPointVectorValueAtTimeExByString(FVectorVMExternalFunctionContext& Context, const FString& Attribute);
+	void GetPointVectorValueAtTimeExByString(FVectorVMExternalFunctionContext& Context, int32 AttributeIndex);
 
 	// Returns a Vector4 value for a given point at a given time
 	void GetPointVector4ValueAtTime(FVectorVMExternalFunctionContext& Context);
 
 	// Returns a Vector4 value by attribute name for a given point at a given time
-	void GetPointVector4ValueAtTimeByString(FVectorVMExternalFunctionContext& Context, const FString& Attribute);
+	void GetPointVector4ValueAtTimeByString(FVectorVMExternalFunctionContext& Context, int32 AttributeIndex);
 
 	// Returns a Quat value for a given point at a given time
 	void GetPointQuatValueAtTime(FVectorVMExternalFunctionContext& Context);
 
 	// Returns a Quat value by attribute name for a given point at a given time
-	void GetPointQuatValueAtTimeByString(FVectorVMExternalFunctionContext& Context, const FString& Attribute);
+	void GetPointQuatValueAtTimeByString(FVectorVMExternalFunctionContext& Context, int32 AttributeIndex);
 
 	// Returns the sample indexes (previous, next) for reading values for a given point at a given time
 	void GetSampleIndexesForPointAtTime(FVectorVMExternalFunctionContext& Context);
 
+	// Same as GetSampleIndexesForPointAtTime, resuming the search from a sample cursor stored by the particle
+	void GetSampleIndexesForPointAtTimeWithCursor(FVectorVMExternalFunctionContext& Context);
+
+	// Same as GetPointPositionAtTime, resuming the search from a sample cursor stored by the particle
+	void GetPointPositionAtTimeWithCursor(FVectorVMExternalFunctionContext& Context);
+
+	// Same as GetPointValueAtTime, resuming the search from a sample cursor stored by the particle
+	void GetPointValueAtTimeWithCursor(FVectorVMExternalFunctionContext& Context);
+
+	// Same as GetPointVectorValueAtTime, resuming the search from a sample cursor stored by the particle
+	void GetPointVectorValueAtTimeWithCursor(FVectorVMExternalFunctionContext& Context);
+
+	// Same as GetPointValueAtTimeByString, resuming the search from a sample cursor stored by the particle
+	void GetPointValueAtTimeWithCursorByString(FVectorVMExternalFunctionContext& Context, int32 AttributeIndex);
+
+	// Same as GetPointVectorValueAtTimeByString, resuming the search from a sample cursor stored by the particle
+	void GetPointVectorValueAtTimeWithCursorByString(FVectorVMExternalFunctionContext& Context, int32 AttributeIndex);
+
+	// Same as GetPointVectorValueAtTimeEx, resuming the search from a sample cursor stored by the particle
+	void GetPointVectorValueAtTimeExWithCursor(FVectorVMExternalFunctionContext& Context);
+
+	// Same as GetPointVectorValueAtTimeExByString, resuming the search from a sample cursor stored by the particle
+	void GetPointVectorValueAtTimeExWithCursorByString(FVectorVMExternalFunctionContext& Context, int32 AttributeIndex);
+
+	// Same as GetPointVector4ValueAtTime, resuming the search from a sample cursor stored by the particle
+	void GetPointVector4ValueAtTimeWithCursor(FVectorVMExternalFunctionContext& Context);
+
+	// Same as GetPointVector4ValueAtTimeByString, resuming the search from a sample cursor stored by the particle
+	void GetPointVector4ValueAtTimeWithCursorByString(FVectorVMExternalFunctionContext& Context, int32 AttributeIndex);
+
+	// Same as GetPointQuatValueAtTime, resuming the search from a sample cursor stored by the particle
+	void GetPointQuatValueAtTimeWithCursor(FVectorVMExternalFunctionContext& Context);
+
+	// Same as GetPointQuatValueAtTimeByString, resuming the search from a sample cursor stored by the particle
+	void GetPointQuatValueAtTimeWithCursorByString(FVectorVMExternalFunctionContext& Context, int32 AttributeIndex);
+
 	// Return the life value for a given point
 	void GetPointLife(FVectorVMExternalFunctionContext& Context);
 
@@ -290,6 +413,12 @@ public:
 	// Sample a float attribute value for a given point at a given time
 	void GetPointGenericFloatAttributeAtTime(EHoudiniAttributes Attribute, FVectorVMExternalFunctionContext& Context);
 
+	// Same as GetPointGenericVectorAttributeAtTime, resuming the search from a sample cursor stored by the particle
+	void GetPointGenericVectorAttributeAtTimeWithCursor(EHoudiniAttributes Attribute, FVectorVMExternalFunctionContext& Context, bool DoSwap, bool DoScale);
+
+	// Same as GetPointGenericFloatAttributeAtTime, resuming the search from a sample cursor stored by the particle
+	void GetPointGenericFloatAttributeAtTimeWithCursor(EHoudiniAttributes Attribute, FVectorVMExternalFunctionContext& Context);
+
 	// Sample a float attribute value for a given point at a given time
 	void GetPointGenericInt32AttributeAtTime(EHoudiniAttributes Attribute, FVectorVMExternalFunctionContext& Context);
 
@@ -300,17 +429,30 @@ public:
 	void GetPointAlphaAtTime(FVectorVMExternalFunctionContext& Context);
 	
 	void GetPointVelocityAtTime(FVectorVMExternalFunctionContext& Context);
+
+	void GetPointNormalAtTimeWithCursor(FVectorVMExternalFunctionContext& Context);
+
+	void GetPointColorAtTimeWithCursor(FVectorVMExternalFunctionContext& Context);
+
+	void GetPointAlphaAtTimeWithCursor(FVectorVMExternalFunctionContext& Context);
+
+	void GetPointVelocityAtTimeWithCursor(FVectorVMExternalFunctionContext& Context);
 	
 	void GetPointImpulseAtTime(FVectorVMExternalFunctionContext& Context);
 
 	void GetPointTypeAtTime(FVectorVMExternalFunctionContext& Context);
 
+	// Returns the position, velocity, normal, color and alpha of a given point at a given time, from a single sample search.
+	// AttributeMask selects the attributes that are read (EHoudiniPointAttributesMask), the others are returned as zero.
+	void GetPointAttributesAtTime(FVectorVMExternalFunctionContext& Context, int32 AttributeMask);
+
 	//----------------------------------------------------------------------------
 	// GPU / HLSL Functions
 
 #if ENGINE_MAJOR_VERSION==5 && ENGINE_MINOR_VERSION < 1
 #if WITH_EDITORONLY_DATA
 	virtual bool GetFunctionHLSL(const FNiagaraDataInterfaceGPUParamInfo& ParamInfo, const FNiagaraDataInterfaceGeneratedFunction& FunctionInfo, int FunctionInstanceIndex, FString& OutHLSL) override;
+	virtual bool AppendCompileHash(FNiagaraCompileHashVisitor* InVisitor) const override;
 	virtual void GetParameterDefinitionHLSL(const FNiagaraDataInterfaceGPUParamInfo& ParamInfo, FString& OutHLSL) override;
 	virtual void GetCommonHLSL(FString& OutHLSL) override;
 #endif
@@ -334,29 +476,70 @@ public:
 
 	virtual bool CanExecuteOnTarget(ENiagaraSimTarget Target)const override { return true; }
 
+#if WITH_EDITOR
+	// Requests a compile of the systems using a point cache with bSpecializeShaders, after its layout has changed
+	static void RequestCompileOfSpecializedShaders(const UHoudiniPointCache* PointCache);
+
+	// Points the data interfaces using a point cache to its current GPU resource and reinitializes their systems,
+	// so that their functions are bound again after it has been reimported
+	static void ReinitializeSystemsUsingPointCache(const UHoudiniPointCache* PointCache);
+#endif
+
+#if WITH_EDITORONLY_DATA
+	// Returns the point cache layout to bake in the HLSL, false if bSpecializeShaders is disabled or there is no point cache
+	bool GetSpecializedShaderLayout(FHoudiniPointCacheShaderLayout& OutLayout) const;
+#endif
+
 	// Members for GPU compatibility
 
 	// Buffer and member variables base name
 	static const FString NumberOfSamplesBaseName;
 	static const FString NumberOfAttributesBaseName;
 	static const FString NumberOfPointsBaseName;
+	static const FString NumberOfFramesBaseName;
+	static const FString NumberOfPointsPerFrameBaseName;
+	static const FString NumberOfPointAttributesBaseName;
+	static const FString NumberOfQuantizedColumnsBaseName;
+	static const FString NumberOfIntColumnsBaseName;
+	static const FString NumberOfVectorColumnsBaseName;
+	static const FString SampleTimeStepBaseName;
+	static const FString PositionInterpolationBaseName;
+	static const FString SpawnTimesSortedBaseName;
 	static const FString FloatValuesBufferBaseName;
 	static const FString SpecialAttributeIndexesBufferBaseName;
 	static const FString SpawnTimesBufferBaseName;
-	static const FString LifeValuesBufferBaseName;
-	static const FString PointTypesBufferBaseName;
+	static const FString PointRecordsBufferBaseName;
 	static const FString MaxNumberOfIndexesPerPointBaseName;
-	static const FString PointValueIndexesBufferBaseName;
+	static const FString PointSampleIndexOffsetsBufferBaseName;
+	static const FString PointSampleIndexesBufferBaseName;
+	static const FString FrameTimesBufferBaseName;
+	static const FString FrameSampleIndexOffsetsBufferBaseName;
+	static const FString PointAttributeValuesBufferBaseName;
+	static const FString AttributeColumnIndexesBufferBaseName;
+	static const FString QuantizedValuesBufferBaseName;
+	static const FString QuantizationParamsBufferBaseName;
+	static const FString IntValuesBufferBaseName;
+	static const FString AttributeIntColumnIndexesBufferBaseName;
+	static const FString AliveIntervalIndexBufferBaseName;
+	static const FString VectorColumnIndexesBufferBaseName;
+	static const FString VectorValuesBufferBaseName;
 	static const FString LastSpawnedPointIdBaseName;
 	static const FString LastSpawnTimeBaseName;
 	static const FString LastSpawnTimeRequestBaseName;
+	static const FString SpawnMinPointIdBaseName;
+	static const FString SpawnMaxPointIdBaseName;
+	static const FString SpawnCountBaseName;
+	static const FString InstanceTimeBaseName;
+	static const FString InstancePrevFrameIndexBaseName;
+	static const FString InstanceNextFrameIndexBaseName;
+	static const FString InstanceFramePrevWeightBaseName;
 	static const FString FunctionIndexToAttributeIndexBufferBaseName;
 
 	// Member variables accessors
 	FORCEINLINE int32 GetNumberOfSamples()const { return HoudiniPointCacheAsset ? HoudiniPointCacheAsset->GetNumberOfSamples() : 0; }
 	FORCEINLINE int32 GetNumberOfAttributes()const { return HoudiniPointCacheAsset ? HoudiniPointCacheAsset->GetNumberOfAttributes() : 0; }
 	FORCEINLINE int32 GetNumberOfPoints()const { return HoudiniPointCacheAsset ? HoudiniPointCacheAsset->GetNumberOfPoints() : 0; }
-	FORCEINLINE int32 GetMaxNumberOfIndexesPerPoints()const { return HoudiniPointCacheAsset ? HoudiniPointCacheAsset->GetMaxNumberOfPointValueIndexes() + 1 : 0; }
+	FORCEINLINE int32 GetMaxNumberOfIndexesPerPoints()const { return HoudiniPointCacheAsset ? HoudiniPointCacheAsset->GetMaxNumberOfPointValueIndexes() : 0; }
 
 	// GPU Buffers accessors
 	/*FRWBuffer& GetFloatValuesGPUBuffer();
@@ -374,6 +557,11 @@ protected:
 	// Return false if the function itself does not have the Attribute specifier, or if InGeneratedFunctions is empty.
 	bool GetAttributeFunctionIndex(const TArray<FNiagaraDataInterfaceGeneratedFunction>& InGeneratedFunctions, int InFunctionIndex, int &OutColTitleFunctionIndex) const;
 
+	// Resolves the Attribute specifier of a *ByString function to an attribute index when the function is bound,
+	// so the VM functions don't have to look up the attribute name for each instance.
+	// Returns INDEX_NONE if the attribute can't be found in the point cache.
+	int32 ResolveAttributeIndex(const FString& Attribute) const;
+
 	virtual bool CopyToInternal(UNiagaraDataInterface* Destination) const override;
 
 	// The following state variables are now stored in Niagara on the emitter itself
@@ -402,11 +590,16 @@ struct FNiagaraDataInterfaceProxyHoudini : public FNiagaraDataInterfaceProxy
 	FNiagaraDataInterfaceProxyHoudini();
 	virtual ~FNiagaraDataInterfaceProxyHoudini();
 	
+	// Per instance data sent from the game thread, by system instance
+	TMap<FNiagaraSystemInstanceID, FHoudiniNiagaraInstanceData> SystemInstancesToInstanceData;
+
 	virtual int32 PerInstanceDataPassedToRenderThreadSize() const override
 	{
-		return 0;
+		return sizeof(FHoudiniNiagaraInstanceData);
 	}
 
+	virtual void ConsumePerInstanceDataFromGameThread(void* PerInstanceData, const FNiagaraSystemInstanceID& Instance) override;
+
 #if ENGINE_MAJOR_VERSION==5 && ENGINE_MINOR_VERSION < 1
 	void UpdateFunctionIndexToAttributeIndexBuffer(const TMemoryImageArray<FName>& FunctionIndexToAttribute, bool bForceUpdate = false);
 #else
@@ -26,16 +26,26 @@
 #include "HoudiniPointCacheLoaderBJSON.h"
 #include "HoudiniPointCacheLoaderCSV.h"
 #include "HoudiniPointCacheLoaderJSON.h"
+#include "NiagaraDataInterfaceHoudini.h"
 
+#include "Algo/BinarySearch.h"
+#include "Algo/Sort.h"
+#include "Async/ParallelFor.h"
+#include "CoreGlobals.h"
 #include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
 #include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Math/Float16.h"
 #include "Math/NumericLimits.h"
 #include "Misc/CoreMiscDefines.h" 
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
 #include "PixelFormat.h"
 #include "RenderingThread.h"
 #include "ShaderCompiler.h"
+#include "UObject/UObjectIterator.h"
 
 #if WITH_EDITOR
 	#include "EditorFramework/AssetImportData.h"
@@ -44,6 +54,42 @@
 #define LOCTEXT_NAMESPACE "HoudiniNiagaraPointCacheAsset"
 
 DEFINE_LOG_CATEGORY(LogHoudiniNiagara);
+
+// Encodes a value to 16 bits, using the quantization, offset and scale found in Params
+static uint16 EncodeQuantizedValue( const float& Value, const float* Params )
+{
+	switch ( (EHoudiniAttributeQuantization)(int32)Params[ 1 ] )
+	{
+		case EHoudiniAttributeQuantization::Half:
+			return FFloat16( Value ).Encoded;
+
+		case EHoudiniAttributeQuantization::SNorm16:
+			return (uint16)(int16)FMath::Clamp( FMath::RoundToInt( ( Value - Params[ 2 ] ) / Params[ 3 ] ), -32767, 32767 );
+
+		default:
+			return (uint16)FMath::Clamp( FMath::RoundToInt( ( Value - Params[ 2 ] ) / Params[ 3 ] ), 0, 65535 );
+	}
+}
+
+// Decodes a value encoded with EncodeQuantizedValue
+static float DecodeQuantizedValue( const uint16& Value, const float* Params )
+{
+	switch ( (EHoudiniAttributeQuantization)(int32)Params[ 1 ] )
+	{
+		case EHoudiniAttributeQuantization::Half:
+		{
+			FFloat16 HalfValue;
+			HalfValue.Encoded = Value;
+			return HalfValue.GetFloat();
+		}
+
+		case EHoudiniAttributeQuantization::SNorm16:
+			return Params[ 2 ] + (float)(int16)Value * Params[ 3 ];
+
+		default:
+			return Params[ 2 ] + (float)Value * Params[ 3 ];
+	}
+}
  
 
 UHoudiniPointCache::UHoudiniPointCache( const FObjectInitializer& ObjectInitializer )
@@ -56,7 +102,20 @@ UHoudiniPointCache::UHoudiniPointCache( const FObjectInitializer& ObjectInitiali
 	LastFrame( -FLT_MAX ),
 	MinSampleTime( FLT_MAX ),
 	MaxSampleTime( -FLT_MAX ),
-	Resource(nullptr)
+	TopologyMode( EHoudiniPointCacheTopology::Auto ),
+	bHasFixedTopology( false ),
+	ResampleTimeStep( 0.0f ),
+	UniformSampleTimeStep( 0.0f ),
+	KeyframeReductionTolerance( 0.0f ),
+	KeyframeReductionRatio( 1.0f ),
+	PositionInterpolation( EHoudiniPositionInterpolation::Linear ),
+	bShareEvaluations( false ),
+	SharedEvaluationsMaxMemoryMB( 64.0f ),
+	bInterleaveVectorAttributes( false ),
+	Resource(nullptr),
+	NumberOfPointAttributes( 0 ),
+	NumberOfQuantizedColumns( 0 ),
+	NumberOfIntColumns( 0 )
 {
 	SpecialAttributeIndexes.Init(INDEX_NONE, EHoudiniAttributes::HOUDINI_ATTR_SIZE);
 
@@ -116,7 +175,44 @@ bool UHoudiniPointCache::UpdateFromFile( const FString& TheFileName )
 	if (!Loader)
 		return false;
 
-	return Loader->LoadToAsset(this);
+	// The attribute array is about to change, lookups fall back to it until the loader rebuilds the map
+	AttributeIndexMap.Empty();
+	ResetSharedEvaluations();
+
+	FHoudiniPointCacheShaderLayout PreviousLayout;
+	GetShaderLayout(PreviousLayout);
+
+	if (!Loader->LoadToAsset(this))
+		return false;
+
+	// The data already pushed to the GPU is out of date, push the new data to a new resource.
+	// The previous one is released once the data interfaces have been pointed to the new one.
+	FHoudiniPointCacheResource* PreviousResource = Resource.Release();
+	if (PreviousResource)
+		RequestPushToGPU();
+
+	// Shaders with the previous layout baked in need to be recompiled
+	FHoudiniPointCacheShaderLayout NewLayout;
+	GetShaderLayout(NewLayout);
+	if (!(NewLayout == PreviousLayout))
+		UNiagaraDataInterfaceHoudini::RequestCompileOfSpecializedShaders(this);
+
+	// The attribute indexes resolved when binding the data interface functions might have changed,
+	// reinitialize the systems using this point cache so that they are bound again
+	UNiagaraDataInterfaceHoudini::ReinitializeSystemsUsingPointCache(this);
+
+	if (PreviousResource)
+	{
+		ENQUEUE_RENDER_COMMAND(FHoudiniPointCache_ReleasePrevious) (
+			[PreviousResource](FRHICommandListImmediate& CmdList)
+		{
+			PreviousResource->ReleaseResource();
+			delete PreviousResource;
+		}
+		);
+	}
+
+	return true;
 }
 #endif
 
@@ -129,7 +225,54 @@ bool UHoudiniPointCache::GetFloatValue( const int32& sampleIndex, const int32& a
     if ( attrIndex < 0 || attrIndex >= NumberOfAttributes )
 		return false;
 
-    int32 Index = sampleIndex + ( attrIndex * NumberOfSamples );
+    const int32 IntColumn = GetAttributeIntColumnIndex( attrIndex );
+    if ( IntColumn >= 0 )
+    {
+		// Integer attribute
+		int32 Index = sampleIndex + ( IntColumn * NumberOfSamples );
+		if ( !IntSampleData.IsValidIndex( Index ) )
+			return false;
+
+		value = static_cast<float>( IntSampleData[ Index ] );
+		return true;
+    }
+
+    if ( QuantizationParams.Num() > 0 )
+    {
+		// The attribute might be quantized
+		const float* Params = QuantizationParams.GetData() + attrIndex * QuantizationParamsStride;
+		if ( Params[ 0 ] >= 0.0f )
+		{
+			int32 Index = sampleIndex + ( (int32)Params[ 0 ] * NumberOfSamples );
+			if ( !QuantizedSampleData.IsValidIndex( Index ) )
+				return false;
+
+			value = DecodeQuantizedValue( QuantizedSampleData[ Index ], Params );
+			return true;
+		}
+    }
+
+    const int32 Column = GetAttributeColumnIndex( attrIndex );
+    if ( Column < 0 )
+    {
+		// The attribute is constant for each point, read it in the sample's point values
+		int32 IDAttributeIndex = GetAttributeAttributeIndex( EHoudiniAttributes::POINTID );
+		if ( IDAttributeIndex < 0 || IDAttributeIndex >= NumberOfAttributes )
+			return false;
+
+		int32 IDIndex = sampleIndex + ( GetAttributeColumnIndex( IDAttributeIndex ) * NumberOfSamples );
+		if ( !FloatSampleData.IsValidIndex( IDIndex ) )
+			return false;
+
+		int32 PointIndex = (int32)FloatSampleData[ IDIndex ] * NumberOfPointAttributes - Column - 1;
+		if ( !PointAttributeValues.IsValidIndex( PointIndex ) )
+			return false;
+
+		value = PointAttributeValues[ PointIndex ];
+		return true;
+    }
+
+    int32 Index = sampleIndex + ( Column * NumberOfSamples );
     if ( FloatSampleData.IsValidIndex( Index ) )
     {
 		value = FloatSampleData[ Index ];
@@ -391,6 +534,15 @@ bool UHoudiniPointCache::GetLastSampleIndexAtTime(const float& desiredTime, int3
 		return true;
 	}
 
+	if ( FrameTimes.Num() > 0 && FrameSampleIndexOffsets.Num() == FrameTimes.Num() + 1 )
+	{
+		// Find the first frame with a time value higher than desiredTime in the frame table,
+		// the last sample of the frame preceding it is the one we're looking for (-1 if desiredTime is before the first frame)
+		const int32 NextFrameIndex = Algo::UpperBound( FrameTimes, desiredTime );
+		lastSampleIndex = FrameSampleIndexOffsets[ NextFrameIndex ] - 1;
+		return true;
+	}
+
 	// Iterates through all the samples
 	lastSampleIndex = INDEX_NONE;
 	for ( int32 n = 0; n < NumberOfSamples; n++ )
@@ -416,6 +568,30 @@ bool UHoudiniPointCache::GetLastSampleIndexAtTime(const float& desiredTime, int3
 	return true;
 }
 
+// Returns the index preceding the first point whose spawn time exceeds desiredTime, or -1
+static int32
+FindLastPointIDToSpawnLinear(const float* InSpawnTimes, const int32& InNumPoints, const float& desiredTime)
+{
+	// Iterates through all the points to find the point who's spawn time exceeds the desired time.
+	int32 lastID = -1;
+	for (int32 n = 0; n < InNumPoints; n++)
+	{
+		if (InSpawnTimes[n] > desiredTime)
+			break;
+
+		lastID = n;
+	}
+
+	return lastID;
+}
+
+// Same as FindLastPointIDToSpawnLinear, for spawn times sorted in ascending order
+static int32
+FindLastPointIDToSpawnSorted(const float* InSpawnTimes, const int32& InNumPoints, const float& desiredTime)
+{
+	return Algo::UpperBound(TArrayView<const float>(InSpawnTimes, InNumPoints), desiredTime) - 1;
+}
+
 // Get the last index of the points with a time value smaller or equal to desiredTime
 // If the Point Cache doesn't have time informations, returns false and set the LastIndex to the last point
 // If desiredTime is smaller than the first point time, LastIndex will be set to -1
@@ -433,27 +609,189 @@ bool UHoudiniPointCache::GetLastPointIDToSpawnAtTime(const float& desiredTime, i
 		lastID = NumberOfPoints - 1;
 		return true;
 	}
+
+	// Use a binary search when the spawn times are sorted, legacy or unsorted point caches fall back to a linear search
+	if (bSpawnTimesSorted)
+		lastID = FindLastPointIDToSpawnSorted(SpawnTimes.GetData(), NumberOfPoints, desiredTime);
 	else
+		lastID = FindLastPointIDToSpawnLinear(SpawnTimes.GetData(), NumberOfPoints, desiredTime);
+
+	return true;
+}
+
+void UHoudiniPointCache::UpdateSpawnTimesSorted()
+{
+	bSpawnTimesSorted = false;
+	if (NumberOfPoints <= 0 || !SpawnTimes.IsValidIndex(NumberOfPoints - 1))
+		return;
+
+	for (int32 n = 1; n < NumberOfPoints; n++)
 	{
-		// Iterates through all the points to find the point who's spawn time exceeds the desired time.
-		//lastID = GetNumberOfPoints();
-		lastID = -1;
-		for (int32 n = 0; n < NumberOfPoints; n++)
-		{
-			float SpawnTime = SpawnTimes[n];
-			if (SpawnTime > desiredTime)
-			{
-				return true;
-			}
-			lastID = n;
-		}
+		// Also rejects NaNs
+		if (!(SpawnTimes[n - 1] <= SpawnTimes[n]))
+			return;
+	}
+
+	bSpawnTimesSorted = true;
+}
+
+void UHoudiniPointCache::BuildAliveIntervalIndex()
+{
+	AliveIntervalIndex.Empty();
+	if ( NumberOfPoints <= 0 || !SpawnTimes.IsValidIndex( NumberOfPoints - 1 ) )
+		return;
+
+	const int32 NumPoints = NumberOfPoints;
+	AliveIntervalIndex.SetNumUninitialized( NumPoints * 4 );
+	float* SortedSpawnTimes = AliveIntervalIndex.GetData();
+	float* MinSpawnTimes = SortedSpawnTimes + NumPoints;
+	float* SortedDeathTimes = MinSpawnTimes + NumPoints;
+	float* MaxDeathTimes = SortedDeathTimes + NumPoints;
+
+	for ( int32 PointID = 0; PointID < NumPoints; PointID++ )
+	{
+		const float SpawnTime = SpawnTimes[ PointID ];
+		// Points without a valid life value never die
+		float DeathTime = TNumericLimits<float>::Max();
+		if ( LifeValues.IsValidIndex( PointID ) && LifeValues[ PointID ] >= 0.0f )
+			DeathTime = SpawnTime + LifeValues[ PointID ];
+
+		SortedSpawnTimes[ PointID ] = SpawnTime;
+		SortedDeathTimes[ PointID ] = DeathTime;
+		MaxDeathTimes[ PointID ] = PointID > 0 ? FMath::Max( MaxDeathTimes[ PointID - 1 ], DeathTime ) : DeathTime;
+	}
+
+	for ( int32 PointID = NumPoints - 1; PointID >= 0; PointID-- )
+	{
+		const float SpawnTime = SpawnTimes[ PointID ];
+		MinSpawnTimes[ PointID ] = PointID < NumPoints - 1 ? FMath::Min( MinSpawnTimes[ PointID + 1 ], SpawnTime ) : SpawnTime;
+	}
+
+	if ( !bSpawnTimesSorted )
+		Algo::Sort( TArrayView<float>( SortedSpawnTimes, NumPoints ) );
+	Algo::Sort( TArrayView<float>( SortedDeathTimes, NumPoints ) );
+}
+
+void UHoudiniPointCache::BuildPointRecords()
+{
+	PointRecords.Empty();
+	if ( NumberOfPoints <= 0 || !SpawnTimes.IsValidIndex( NumberOfPoints - 1 )
+		|| !LifeValues.IsValidIndex( NumberOfPoints - 1 ) || !PointTypes.IsValidIndex( NumberOfPoints - 1 ) )
+		return;
+
+	PointRecords.SetNumUninitialized( NumberOfPoints );
+	for ( int32 PointID = 0; PointID < NumberOfPoints; PointID++ )
+	{
+		FHoudiniPointRecord& Record = PointRecords[ PointID ];
+		Record.SpawnTime = SpawnTimes[ PointID ];
+		Record.Life = LifeValues[ PointID ];
+		Record.Type = (float)PointTypes[ PointID ];
+		Record.DeathTime = Record.Life >= 0.0f ? Record.SpawnTime + Record.Life : TNumericLimits<float>::Max();
+	}
+}
+
+bool UHoudiniPointCache::GetAlivePointsAtTime( const float& desiredTime, int32& NumAlivePoints, int32& FirstPointID, int32& LastPointID ) const
+{
+	NumAlivePoints = 0;
+	FirstPointID = 0;
+	LastPointID = -1;
+
+	const int32 NumPoints = NumberOfPoints;
+	if ( NumPoints <= 0 || AliveIntervalIndex.Num() != NumPoints * 4 )
+		return false;
+
+	const float* SortedSpawnTimes = AliveIntervalIndex.GetData();
+	const float* MinSpawnTimes = SortedSpawnTimes + NumPoints;
+	const float* SortedDeathTimes = MinSpawnTimes + NumPoints;
+	const float* MaxDeathTimes = SortedDeathTimes + NumPoints;
+
+	// Points that have spawned at desiredTime, minus the ones that are already dead
+	const int32 NumSpawned = Algo::UpperBound( TArrayView<const float>( SortedSpawnTimes, NumPoints ), desiredTime );
+	const int32 NumDead = Algo::UpperBound( TArrayView<const float>( SortedDeathTimes, NumPoints ), desiredTime );
+	if ( NumSpawned <= NumDead )
+		return true;
+
+	NumAlivePoints = NumSpawned - NumDead;
+
+	// All the points before the first one whose running max death time is after desiredTime are dead,
+	// and none of the points after the last one whose running min spawn time is before desiredTime have spawned
+	FirstPointID = Algo::UpperBound( TArrayView<const float>( MaxDeathTimes, NumPoints ), desiredTime );
+	LastPointID = Algo::UpperBound( TArrayView<const float>( MinSpawnTimes, NumPoints ), desiredTime ) - 1;
+
+	return true;
+}
+
+bool UHoudiniPointCache::IsPointAliveAtTime( const int32& PointID, const float& desiredTime ) const
+{
+	if ( PointRecords.IsValidIndex( PointID ) )
+	{
+		const FHoudiniPointRecord& Record = PointRecords[ PointID ];
+		return desiredTime >= Record.SpawnTime && ( Record.Life < 0.0f || desiredTime < Record.DeathTime );
 	}
 
+	if ( PointID < 0 || PointID >= NumberOfPoints || !SpawnTimes.IsValidIndex( PointID ) )
+		return false;
+
+	const float SpawnTime = SpawnTimes[ PointID ];
+	if ( desiredTime < SpawnTime )
+		return false;
+
+	if ( LifeValues.IsValidIndex( PointID ) && LifeValues[ PointID ] >= 0.0f )
+		return desiredTime < SpawnTime + LifeValues[ PointID ];
+
 	return true;
 }
 
+#if !UE_BUILD_SHIPPING
+// Measures the per-call cost of the linear and binary spawn time searches on all loaded point caches
+static FAutoConsoleCommand CCmdHoudiniNiagaraBenchmarkSpawnTimes(
+	TEXT("HoudiniNiagara.BenchmarkSpawnTimes"),
+	TEXT("Measures the per-call cost of the linear and binary searches used by GetLastPointIDToSpawnAtTime on all loaded point caches.\n")
+	TEXT("Usage: HoudiniNiagara.BenchmarkSpawnTimes [NumCalls]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 NumCalls = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 10000;
+		for (TObjectIterator<UHoudiniPointCache> It; It; ++It)
+		{
+			const UHoudiniPointCache* PointCache = *It;
+			const TArray<float>& Times = PointCache->GetSpawnTimes();
+			const int32 NumPoints = PointCache->NumberOfPoints;
+			if (NumPoints <= 0 || !Times.IsValidIndex(NumPoints - 1))
+				continue;
+
+			// Query times evenly distributed over the spawn time range
+			const float MinTime = Times[0];
+			const float TimeStep = (Times[NumPoints - 1] - MinTime) / NumCalls;
+
+			int64 LinearChecksum = 0;
+			double StartTime = FPlatformTime::Seconds();
+			for (int32 n = 0; n < NumCalls; n++)
+				LinearChecksum += FindLastPointIDToSpawnLinear(Times.GetData(), NumPoints, MinTime + n * TimeStep);
+			const double LinearTime = FPlatformTime::Seconds() - StartTime;
+
+			int64 SortedChecksum = 0;
+			StartTime = FPlatformTime::Seconds();
+			for (int32 n = 0; n < NumCalls; n++)
+				SortedChecksum += FindLastPointIDToSpawnSorted(Times.GetData(), NumPoints, MinTime + n * TimeStep);
+			const double SortedTime = FPlatformTime::Seconds() - StartTime;
+
+			UE_LOG(LogHoudiniNiagara, Display, TEXT("%s: %d points, sorted: %s, linear: %.3f us/call, binary: %.3f us/call, results %s"),
+				*PointCache->GetName(), NumPoints, PointCache->AreSpawnTimesSorted() ? TEXT("yes") : TEXT("no"),
+				LinearTime * 1e6 / NumCalls, SortedTime * 1e6 / NumCalls,
+				LinearChecksum == SortedChecksum ? TEXT("match") : TEXT("differ"));
+		}
+	})
+);
+#endif
+
 bool UHoudiniPointCache::GetPointType(const int32& PointID, int32& Value) const
 {
+	if ( PointRecords.IsValidIndex( PointID ) )
+	{
+		Value = (int32)PointRecords[ PointID ].Type;
+		return true;
+	}
+
 	if ( !PointTypes.IsValidIndex( PointID ) )
 	{
 		Value = -1;
@@ -467,6 +805,12 @@ bool UHoudiniPointCache::GetPointType(const int32& PointID, int32& Value) const
 
 bool UHoudiniPointCache::GetPointLife(const int32& PointID, float& Value) const
 {
+	if ( PointRecords.IsValidIndex( PointID ) )
+	{
+		Value = PointRecords[ PointID ].Life;
+		return true;
+	}
+
 	if ( !LifeValues.IsValidIndex( PointID ) )
 	{
 		Value = -1.0f;
@@ -480,6 +824,12 @@ bool UHoudiniPointCache::GetPointLife(const int32& PointID, float& Value) const
 
 bool UHoudiniPointCache::GetPointLifeAtTime( const int32& PointID, const float& DesiredTime, float& Value ) const
 {
+	if ( PointRecords.IsValidIndex( PointID ) )
+	{
+		Value = PointRecords[ PointID ].Life;
+		return true;
+	}
+
 	if ( !SpawnTimes.IsValidIndex( PointID )  || !LifeValues.IsValidIndex( PointID ) )
 	{
 		Value = -1.0f;
@@ -540,17 +890,47 @@ bool UHoudiniPointCache::GetPointVectorValueAtTime( int32 PointID, int32 Attribu
 	if ( !GetSampleIndexesForPointAtTime( PointID, desiredTime, PrevSampleIndex, NextSampleIndex, PrevWeight ) )
 		return false;
 
+	return InterpolateVectorValue( PrevSampleIndex, NextSampleIndex, PrevWeight, AttributeIndex, Vector, DoSwap, DoScale );
+}
+
+bool UHoudiniPointCache::InterpolateVectorValue( const int32& PrevSampleIndex, const int32& NextSampleIndex, const float& PrevWeight, const int32& AttrIndex, FVector& Vector, const bool& DoSwap, const bool& DoScale ) const
+{
 	FVector PrevVector, NextVector;
-	if ( !GetVectorValue( PrevSampleIndex, AttributeIndex, PrevVector, DoSwap, DoScale ) )
+	if ( !GetVectorValue( PrevSampleIndex, AttrIndex, PrevVector, DoSwap, DoScale ) )
 		return false;
-	if ( !GetVectorValue( NextSampleIndex, AttributeIndex, NextVector, DoSwap, DoScale ) )
+	if ( !GetVectorValue( NextSampleIndex, AttrIndex, NextVector, DoSwap, DoScale ) )
 		return false;
 
-	Vector = FMath::Lerp(PrevVector, NextVector, PrevWeight);
+	Vector = FMath::Lerp( PrevVector, NextVector, PrevWeight );
+	if ( PrevSampleIndex == NextSampleIndex || !UsesHermiteInterpolation( AttrIndex ) )
+		return true;
+
+	// The tangents are the velocities, converted like the positions, scaled by the time between the two samples
+	const int32 VelocityAttrIndex = GetAttributeAttributeIndex( EHoudiniAttributes::VELOCITY );
+	const int32 TimeAttrIndex = GetAttributeAttributeIndex( EHoudiniAttributes::TIME );
+	FVector PrevVelocity, NextVelocity;
+	float PrevTime, NextTime;
+	if ( !GetVectorValue( PrevSampleIndex, VelocityAttrIndex, PrevVelocity, DoSwap, DoScale )
+		|| !GetVectorValue( NextSampleIndex, VelocityAttrIndex, NextVelocity, DoSwap, DoScale )
+		|| !GetFloatValue( PrevSampleIndex, TimeAttrIndex, PrevTime )
+		|| !GetFloatValue( NextSampleIndex, TimeAttrIndex, NextTime ) )
+		return true;
+
+	const float DeltaTime = NextTime - PrevTime;
+	Vector = FMath::CubicInterp( PrevVector, PrevVelocity * DeltaTime, NextVector, NextVelocity * DeltaTime, PrevWeight );
 
 	return true;
 }
 
+bool UHoudiniPointCache::UsesHermiteInterpolation( const int32& AttrIndex ) const
+{
+	return PositionInterpolation == EHoudiniPositionInterpolation::Hermite
+		&& AttrIndex >= 0
+		&& AttrIndex == GetAttributeAttributeIndex( EHoudiniAttributes::POSITION )
+		&& IsValidAttributeAttributeIndex( EHoudiniAttributes::VELOCITY )
+		&& IsValidAttributeAttributeIndex( EHoudiniAttributes::TIME );
+}
+
 bool UHoudiniPointCache::GetPointVectorValueAtTimeForString(int32 PointID, const FString& Attribute, float desiredTime, FVector& Vector, bool DoSwap, bool DoScale) const
 {
 	int32 AttrIndex = -1;
@@ -647,120 +1027,1440 @@ bool UHoudiniPointCache::GetPointInt32ValueAtTime( int32 PointID, int32 Attribut
 	if ( !GetSampleIndexesForPointAtTime( PointID, desiredTime, PrevSampleIndex, NextSampleIndex, PrevWeight ) )
 		return false;
 
-	float FloatValue;
-	if ( !GetFloatValue( PrevSampleIndex, AttributeIndex, FloatValue) )
-		return false;
+	return GetIntValue( PrevSampleIndex, AttributeIndex, Value );
+}
 
-	Value = FMath::FloorToInt(FloatValue);
-	return true;
+// Number of points evaluated by each task of EvaluatePointsAtTime
+static constexpr int32 EvaluatePointsChunkSize = 512;
+
+// Out[ i ] = Lerp( Prev[ i ], Next[ i ], Weights[ i ] ), four values at a time
+static void
+LerpValues(const float* Prev, const float* Next, const float* Weights, float* Out, const int32& Num)
+{
+	int32 i = 0;
+	for ( ; i + 4 <= Num; i += 4 )
+	{
+		const VectorRegister4Float PrevValues = VectorLoad( Prev + i );
+		const VectorRegister4Float NextValues = VectorLoad( Next + i );
+		VectorStore( VectorMultiplyAdd( VectorSubtract( NextValues, PrevValues ), VectorLoad( Weights + i ), PrevValues ), Out + i );
+	}
+
+	for ( ; i < Num; i++ )
+		Out[ i ] = FMath::Lerp( Prev[ i ], Next[ i ], Weights[ i ] );
 }
 
-int32 UHoudiniPointCache::GetMaxNumberOfPointValueIndexes() const
+// Same as above, with the same weight for all the values
+static void
+LerpValues(const float* Prev, const float* Next, const float& Weight, float* Out, const int32& Num)
 {
-	int32 MaxNum = 0;
-	for ( auto ValueIndexes : PointValueIndexes )
+	const VectorRegister4Float Weights = VectorSetFloat1( Weight );
+
+	int32 i = 0;
+	for ( ; i + 4 <= Num; i += 4 )
 	{
-		if ( MaxNum < ValueIndexes.SampleIndexes.Num() )
-			MaxNum = ValueIndexes.SampleIndexes.Num();
+		const VectorRegister4Float PrevValues = VectorLoad( Prev + i );
+		const VectorRegister4Float NextValues = VectorLoad( Next + i );
+		VectorStore( VectorMultiplyAdd( VectorSubtract( NextValues, PrevValues ), Weights, PrevValues ), Out + i );
 	}
 
-	return MaxNum;
+	for ( ; i < Num; i++ )
+		Out[ i ] = FMath::Lerp( Prev[ i ], Next[ i ], Weight );
 }
 
-bool UHoudiniPointCache::GetSampleIndexesForPointAtTime(const int32& PointID, const float& desiredTime, int32& PrevSampleIndex, int32& NextSampleIndex, float& PrevWeight ) const
+bool UHoudiniPointCache::EvaluatePointsAtTime(float desiredTime, const TArray<int32>& AttributeIndexes, TArray<float>& OutValues, int32 FirstPointID, int32 NumPoints) const
 {
-	float PrevTime = -FLT_MAX;
-	float NextTime = -FLT_MAX;
+	if ( NumPoints < 0 )
+		NumPoints = NumberOfPoints - FirstPointID;
 
-	// Invalid PointID
-	if ( PointID < 0 || PointID >= NumberOfPoints )
+	if ( FirstPointID < 0 || NumPoints < 0 || FirstPointID + NumPoints > NumberOfPoints )
 		return false;
 
-	// VA: Replace PointValueIndexes with TMAP for direct PointID lookups
-	// Get the sample indexes for this point
-	const TArray<int32>* SampleIndexes = nullptr;
-	if ( PointValueIndexes.IsValidIndex( PointID ) )
-		SampleIndexes = &( PointValueIndexes[ PointID ].SampleIndexes );
+	const int32 NumAttributes = AttributeIndexes.Num();
+	for ( const int32& AttributeIndex : AttributeIndexes )
+	{
+		if ( AttributeIndex < 0 || AttributeIndex >= NumberOfAttributes )
+			return false;
+	}
+
+	OutValues.SetNumZeroed( NumAttributes * NumPoints );
+	if ( NumAttributes <= 0 || NumPoints <= 0 )
+		return true;
+
+	// Attributes stored as floats for each sample are read directly in their FloatSampleData column,
+	// integer, quantized and per point attributes go through GetFloatValue
+	TArray<const float*, TInlineAllocator<16>> Columns;
+	Columns.SetNumUninitialized( NumAttributes );
+	for ( int32 n = 0; n < NumAttributes; n++ )
+	{
+		const int32& AttributeIndex = AttributeIndexes[ n ];
+		const bool bIsQuantized = QuantizationParams.Num() > 0 && QuantizationParams[ AttributeIndex * QuantizationParamsStride ] >= 0.0f;
+		const int32 Column = GetAttributeColumnIndex( AttributeIndex );
+		if ( GetAttributeIntColumnIndex( AttributeIndex ) < 0 && !bIsQuantized && Column >= 0 )
+			Columns[ n ] = FloatSampleData.GetData() + Column * NumberOfSamples;
+		else
+			Columns[ n ] = nullptr;
+	}
 
-	if ( !SampleIndexes )
+	// With a fixed topology, the frame bracket is the same for all points
+	int32 PrevFrameIndex = 0;
+	int32 NextFrameIndex = 0;
+	float FramePrevWeight = 1.0f;
+	if ( bHasFixedTopology && !GetFrameIndexesAtTime( desiredTime, PrevFrameIndex, NextFrameIndex, FramePrevWeight ) )
 		return false;
 
-	for ( auto n : *SampleIndexes )
+	const int32 NumChunks = FMath::DivideAndRoundUp( NumPoints, EvaluatePointsChunkSize );
+	ParallelFor( NumChunks, [&]( int32 ChunkIndex )
 	{
-		// Get the time
-		float currentTime = -FLT_MAX;
-		if ( !GetTimeValue(n, currentTime) )
-			currentTime = 0.0f;
+		const int32 ChunkStart = ChunkIndex * EvaluatePointsChunkSize;
+		const int32 ChunkNum = FMath::Min( EvaluatePointsChunkSize, NumPoints - ChunkStart );
+		const int32 ChunkFirstPointID = FirstPointID + ChunkStart;
 
-		if ( FMath::IsNearlyEqual(currentTime, desiredTime) )
+		if ( bHasFixedTopology )
 		{
-			PrevSampleIndex = n;
-			NextSampleIndex = n;
-			PrevWeight = 1.0f;
-			return true;
+			// The chunk's samples are contiguous on both frames
+			const int32 PrevSampleIndex = PrevFrameIndex * NumberOfPoints + ChunkFirstPointID;
+			const int32 NextSampleIndex = NextFrameIndex * NumberOfPoints + ChunkFirstPointID;
+			for ( int32 n = 0; n < NumAttributes; n++ )
+			{
+				float* Out = OutValues.GetData() + n * NumPoints + ChunkStart;
+				if ( Columns[ n ] )
+				{
+					LerpValues( Columns[ n ] + PrevSampleIndex, Columns[ n ] + NextSampleIndex, FramePrevWeight, Out, ChunkNum );
+					continue;
+				}
+
+				for ( int32 i = 0; i < ChunkNum; i++ )
+				{
+					float PrevValue = 0.0f;
+					float NextValue = 0.0f;
+					GetFloatValue( PrevSampleIndex + i, AttributeIndexes[ n ], PrevValue );
+					GetFloatValue( NextSampleIndex + i, AttributeIndexes[ n ], NextValue );
+					Out[ i ] = FMath::Lerp( PrevValue, NextValue, FramePrevWeight );
+				}
+			}
+			return;
 		}
-		else if ( currentTime < desiredTime )
+
+		// Otherwise, search each point's sample indexes once for all the attributes.
+		// Points that don't have samples are evaluated as zero.
+		int32 PrevSampleIndexes[ EvaluatePointsChunkSize ];
+		int32 NextSampleIndexes[ EvaluatePointsChunkSize ];
+		float PrevWeights[ EvaluatePointsChunkSize ];
+		for ( int32 i = 0; i < ChunkNum; i++ )
 		{
-			if ( FMath::IsNearlyEqual(PrevTime, -FLT_MAX) || PrevTime < currentTime )
+			if ( !GetSampleIndexesForPointAtTime( ChunkFirstPointID + i, desiredTime, PrevSampleIndexes[ i ], NextSampleIndexes[ i ], PrevWeights[ i ] ) )
 			{
-				PrevSampleIndex = n;
-				PrevTime = currentTime;
+				PrevSampleIndexes[ i ] = INDEX_NONE;
+				NextSampleIndexes[ i ] = INDEX_NONE;
+				PrevWeights[ i ] = 0.0f;
 			}
 		}
-		else
+
+		float PrevValues[ EvaluatePointsChunkSize ];
+		float NextValues[ EvaluatePointsChunkSize ];
+		for ( int32 n = 0; n < NumAttributes; n++ )
 		{
-			if ( FMath::IsNearlyEqual(NextTime, -FLT_MAX) || NextTime > currentTime)
+			const float* Column = Columns[ n ];
+			for ( int32 i = 0; i < ChunkNum; i++ )
 			{
-				NextSampleIndex = n;
-				NextTime = currentTime;
+				PrevValues[ i ] = 0.0f;
+				NextValues[ i ] = 0.0f;
+				if ( PrevSampleIndexes[ i ] < 0 )
+					continue;
+
+				if ( Column )
+				{
+					PrevValues[ i ] = Column[ PrevSampleIndexes[ i ] ];
+					NextValues[ i ] = Column[ NextSampleIndexes[ i ] ];
+				}
+				else
+				{
+					GetFloatValue( PrevSampleIndexes[ i ], AttributeIndexes[ n ], PrevValues[ i ] );
+					GetFloatValue( NextSampleIndexes[ i ], AttributeIndexes[ n ], NextValues[ i ] );
+				}
+			}
+
+			LerpValues( PrevValues, NextValues, PrevWeights, OutValues.GetData() + n * NumPoints + ChunkStart, ChunkNum );
+		}
+	}, NumChunks == 1 );
+
+	return true;
+}
 
-				// TODO: since the csv is sorted by time, we can break now
-				break;
+TSharedPtr<const FHoudiniPointCacheSharedEvaluation, ESPMode::ThreadSafe>
+UHoudiniPointCache::GetSharedEvaluationAtTime(const float& desiredTime, const TArray<int32>& AttributeIndexes) const
+{
+	if ( !bShareEvaluations || NumberOfPoints <= 0 || AttributeIndexes.Num() <= 0 )
+		return nullptr;
+
+	const int64 MaxMemory = (int64)( (double)SharedEvaluationsMaxMemoryMB * 1024.0 * 1024.0 );
+	const int64 EvaluationMemory = (int64)AttributeIndexes.Num() * NumberOfPoints * sizeof( float );
+	if ( EvaluationMemory > MaxMemory )
+		return nullptr;
+
+	const uint64 Frame = GFrameCounter;
+	{
+		FScopeLock ScopeLock( &SharedEvaluationsLock );
+		for ( const TSharedPtr<FHoudiniPointCacheSharedEvaluation, ESPMode::ThreadSafe>& Evaluation : SharedEvaluations )
+		{
+			if ( Evaluation->Time == desiredTime && Evaluation->AttributeIndexes == AttributeIndexes )
+			{
+				Evaluation->LastUsedFrame = Frame;
+				return Evaluation;
 			}
 		}
 	}
 
-	if ( PrevSampleIndex < 0 && NextSampleIndex < 0 )
-		return false;
+	// The values are computed outside of the lock, so that the data interfaces reading the other evaluations are not blocked
+	// by the ParallelFor in EvaluatePointsAtTime. Concurrent requests for the same evaluation may compute it more than once.
+	TSharedPtr<FHoudiniPointCacheSharedEvaluation, ESPMode::ThreadSafe> NewEvaluation = MakeShared<FHoudiniPointCacheSharedEvaluation, ESPMode::ThreadSafe>();
+	NewEvaluation->Time = desiredTime;
+	NewEvaluation->AttributeIndexes = AttributeIndexes;
+	NewEvaluation->LastUsedFrame = Frame;
+	if ( !EvaluatePointsAtTime( desiredTime, AttributeIndexes, NewEvaluation->Values ) )
+		return nullptr;
+
+	FScopeLock ScopeLock( &SharedEvaluationsLock );
 
-	if ( PrevSampleIndex < 0 )
+	// Keep the evaluation another data interface may have added in the meantime
+	int64 UsedMemory = 0;
+	for ( int32 n = SharedEvaluations.Num() - 1; n >= 0; n-- )
 	{
-		PrevWeight = 0.0f;
-		PrevSampleIndex = NextSampleIndex;
-		return true;
+		FHoudiniPointCacheSharedEvaluation& Evaluation = *SharedEvaluations[ n ];
+		if ( Evaluation.Time == desiredTime && Evaluation.AttributeIndexes == AttributeIndexes )
+		{
+			Evaluation.LastUsedFrame = Frame;
+			return SharedEvaluations[ n ];
+		}
+
+		// Time has moved on since this evaluation was last requested
+		if ( Evaluation.LastUsedFrame + 1 < Frame )
+		{
+			SharedEvaluations.RemoveAtSwap( n );
+			continue;
+		}
+
+		UsedMemory += Evaluation.Values.Num() * sizeof( float );
 	}
 
-	if ( NextSampleIndex < 0 )
+	// Release the least recently used evaluations until the new one fits,
+	// the data interfaces still reading them hold their own reference
+	while ( SharedEvaluations.Num() > 0 && UsedMemory + EvaluationMemory > MaxMemory )
 	{
-		PrevWeight = 1.0f;
-		NextSampleIndex = PrevSampleIndex;
-		return true;
+		int32 OldestIndex = 0;
+		for ( int32 n = 1; n < SharedEvaluations.Num(); n++ )
+		{
+			if ( SharedEvaluations[ n ]->LastUsedFrame < SharedEvaluations[ OldestIndex ]->LastUsedFrame )
+				OldestIndex = n;
+		}
+
+		UsedMemory -= SharedEvaluations[ OldestIndex ]->Values.Num() * sizeof( float );
+		SharedEvaluations.RemoveAtSwap( OldestIndex );
 	}
 
-	// Calculate the weight
-	PrevWeight = ( ( desiredTime - PrevTime) / ( NextTime - PrevTime ) );
+	SharedEvaluations.Add( NewEvaluation );
+	return NewEvaluation;
+}
 
-	return true;
+void UHoudiniPointCache::ResetSharedEvaluations()
+{
+	FScopeLock ScopeLock( &SharedEvaluationsLock );
+	SharedEvaluations.Empty();
 }
 
-bool UHoudiniPointCache::GetPointIDsToSpawnAtTime(
-	const float& desiredTime,
-	int32& MinID, int32& MaxID, int32& Count,
-	int32& LastSpawnedPointID, float& LastSpawnTime, float& LastSpawnTimeRequest) const
+#if !UE_BUILD_SHIPPING
+// Compares EvaluatePointsAtTime with the per point GetPointValueAtTime on all loaded point caches
+static FAutoConsoleCommand CCmdHoudiniNiagaraBenchmarkEvaluatePoints(
+	TEXT("HoudiniNiagara.BenchmarkEvaluatePoints"),
+	TEXT("Evaluates all the attributes of all the points of the loaded point caches with EvaluatePointsAtTime and with GetPointValueAtTime,\n")
+	TEXT("and reports the number of point attribute evaluations per second of both.\n")
+	TEXT("Usage: HoudiniNiagara.BenchmarkEvaluatePoints [NumTimes]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 NumTimes = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 16;
+		for (TObjectIterator<UHoudiniPointCache> It; It; ++It)
+		{
+			const UHoudiniPointCache* PointCache = *It;
+			const int32 NumPoints = PointCache->GetNumberOfPoints();
+			const int32 NumAttributes = PointCache->GetNumberOfAttributes();
+			if (NumPoints <= 0 || NumAttributes <= 0)
+				continue;
+
+			TArray<int32> AttributeIndexes;
+			for (int32 n = 0; n < NumAttributes; n++)
+				AttributeIndexes.Add(n);
+
+			// Query times evenly distributed over the sample time range
+			const float TimeStep = (PointCache->MaxSampleTime - PointCache->MinSampleTime) / NumTimes;
+
+			TArray<float> Values;
+			double BulkChecksum = 0.0;
+			double StartTime = FPlatformTime::Seconds();
+			for (int32 t = 0; t < NumTimes; t++)
+			{
+				PointCache->EvaluatePointsAtTime(PointCache->MinSampleTime + t * TimeStep, AttributeIndexes, Values);
+				for (const float& Value : Values)
+					BulkChecksum += Value;
+			}
+			const double BulkTime = FPlatformTime::Seconds() - StartTime;
+
+			double PerPointChecksum = 0.0;
+			StartTime = FPlatformTime::Seconds();
+			for (int32 t = 0; t < NumTimes; t++)
+			{
+				for (int32 n = 0; n < NumAttributes; n++)
+				{
+					for (int32 PointID = 0; PointID < NumPoints; PointID++)
+					{
+						float Value = 0.0f;
+						PointCache->GetPointValueAtTime(PointID, n, PointCache->MinSampleTime + t * TimeStep, Value);
+						PerPointChecksum += Value;
+					}
+				}
+			}
+			const double PerPointTime = FPlatformTime::Seconds() - StartTime;
+
+			const double NumEvaluations = (double)NumTimes * NumPoints * NumAttributes;
+			UE_LOG(LogHoudiniNiagara, Display, TEXT("%s: %d points, %d attributes, bulk: %.1f M evaluations/s, per point: %.1f M evaluations/s, results %s"),
+				*PointCache->GetName(), NumPoints, NumAttributes,
+				NumEvaluations / FMath::Max(BulkTime, 1e-9) * 1e-6, NumEvaluations / FMath::Max(PerPointTime, 1e-9) * 1e-6,
+				FMath::IsNearlyEqual(BulkChecksum, PerPointChecksum, FMath::Max(1.0, FMath::Abs(PerPointChecksum)) * 1e-4) ? TEXT("match") : TEXT("differ"));
+		}
+	})
+);
+#endif
+
+int32 UHoudiniPointCache::GetMaxNumberOfPointValueIndexes() const
 {
-	int32 lastID = 0;
-	if ( !GetLastPointIDToSpawnAtTime( desiredTime, lastID ) )
+	// With a fixed topology, every point has one sample per frame
+	if ( bHasFixedTopology )
+		return FrameTimes.Num();
+
+	int32 MaxNum = 0;
+	for ( int32 PointID = 0; PointID < PointSampleIndexOffsets.Num() - 1; PointID++ )
 	{
-		// The Point Cache doesn't have time informations, so always return all points in the file
-		MinID = 0;
-		MaxID = lastID;
-		Count = MaxID - MinID + 1;
+		const int32 NumSampleIndexes = PointSampleIndexOffsets[ PointID + 1 ] - PointSampleIndexOffsets[ PointID ];
+		if ( MaxNum < NumSampleIndexes )
+			MaxNum = NumSampleIndexes;
 	}
-	else
-	{
-		// The Point Cache has time informations
-		// First, detect if we need to reset LastSpawnedPointID (after a loop of the emitter)
-		 if ( lastID < LastSpawnedPointID || desiredTime <= LastSpawnTime || desiredTime <= LastSpawnTimeRequest )
+
+	return MaxNum;
+}
+
+bool UHoudiniPointCache::GetPointSampleIndexRange(const int32& PointID, int32& OutFirst, int32& OutCount) const
+{
+	OutFirst = 0;
+	OutCount = 0;
+	if ( PointID < 0 || PointID >= PointSampleIndexOffsets.Num() - 1 )
+		return false;
+
+	OutFirst = PointSampleIndexOffsets[ PointID ];
+	OutCount = PointSampleIndexOffsets[ PointID + 1 ] - OutFirst;
+
+	return true;
+}
+
+void UHoudiniPointCache::BuildPointSampleIndexes()
+{
+	// Samples are indexed per point, so they're not stored with a fixed topology
+	bHasFixedTopology = false;
+
+	const int32 NumPoints = FMath::Max( NumberOfPoints, 0 );
+	const int32 NumSamples = FMath::Max( NumberOfSamples, 0 );
+	const int32 IDAttributeIndex = GetAttributeAttributeIndex( EHoudiniAttributes::POINTID );
+
+	// The point ID attribute has already been remapped to our internal (0 to NumberOfPoints - 1) IDs by the loaders
+	// If we dont have Point ID informations, each sample is considered its own point
+	auto GetSamplePointID = [&]( int32 SampleIndex )
+	{
+		if ( IDAttributeIndex == INDEX_NONE )
+			return SampleIndex;
+
+		return static_cast<int32>( FloatSampleData[ SampleIndex + ( GetAttributeColumnIndex( IDAttributeIndex ) * NumSamples ) ] );
+	};
+
+	// First pass: count the number of samples for each point
+	PointSampleIndexOffsets.Init( 0, NumPoints + 1 );
+	for ( int32 SampleIndex = 0; SampleIndex < NumSamples; SampleIndex++ )
+	{
+		const int32 PointID = GetSamplePointID( SampleIndex );
+		if ( PointID >= 0 && PointID < NumPoints )
+			PointSampleIndexOffsets[ PointID + 1 ]++;
+	}
+
+	// Convert the counts to offsets
+	for ( int32 PointID = 0; PointID < NumPoints; PointID++ )
+		PointSampleIndexOffsets[ PointID + 1 ] += PointSampleIndexOffsets[ PointID ];
+
+	// Second pass: fill the sample indexes, they will be sorted by sample index (and thus by time) for each point
+	TArray<int32> WriteOffsets( PointSampleIndexOffsets.GetData(), NumPoints );
+	PointSampleIndexes.Empty( PointSampleIndexOffsets[ NumPoints ] );
+	PointSampleIndexes.SetNumUninitialized( PointSampleIndexOffsets[ NumPoints ] );
+	for ( int32 SampleIndex = 0; SampleIndex < NumSamples; SampleIndex++ )
+	{
+		const int32 PointID = GetSamplePointID( SampleIndex );
+		if ( PointID >= 0 && PointID < NumPoints )
+			PointSampleIndexes[ WriteOffsets[ PointID ]++ ] = SampleIndex;
+	}
+
+	BuildPointSampleTimes();
+}
+
+void UHoudiniPointCache::BuildFrameTable()
+{
+	FrameTimes.Empty();
+	FrameSampleIndexOffsets.Empty();
+
+	int32 TimeAttributeIndex = GetAttributeAttributeIndex( EHoudiniAttributes::TIME );
+	if ( TimeAttributeIndex < 0 || TimeAttributeIndex >= NumberOfAttributes || NumberOfSamples <= 0 )
+		return;
+
+	for ( int32 SampleIndex = 0; SampleIndex < NumberOfSamples; SampleIndex++ )
+	{
+		float SampleTime = 0.0f;
+		if ( !GetTimeValue( SampleIndex, SampleTime ) )
+			SampleTime = 0.0f;
+
+		if ( FrameTimes.Num() > 0 )
+		{
+			if ( SampleTime == FrameTimes.Last() )
+				continue;
+
+			if ( !( SampleTime > FrameTimes.Last() ) )
+			{
+				// The samples are not sorted by time, time lookups will have to iterate on the samples
+				FrameTimes.Empty();
+				FrameSampleIndexOffsets.Empty();
+				return;
+			}
+		}
+
+		// This sample starts a new frame
+		FrameTimes.Add( SampleTime );
+		FrameSampleIndexOffsets.Add( SampleIndex );
+	}
+
+	FrameSampleIndexOffsets.Add( NumberOfSamples );
+}
+
+float UHoudiniPointCache::GetKeyframeReductionTolerance( const int32& attrIndex ) const
+{
+	if ( !AttributeArray.IsValidIndex( attrIndex ) )
+		return KeyframeReductionTolerance;
+
+	// Look for the attribute name first (P.x), then for its vector attribute's name (P)
+	const FString& AttributeName = AttributeArray[ attrIndex ];
+	if ( const float* Tolerance = KeyframeReductionAttributeTolerances.Find( AttributeName ) )
+		return FMath::Max( *Tolerance, 0.0f );
+
+	int32 DotIndex = INDEX_NONE;
+	if ( AttributeName.FindLastChar( TEXT( '.' ), DotIndex ) )
+	{
+		if ( const float* Tolerance = KeyframeReductionAttributeTolerances.Find( AttributeName.Left( DotIndex ) ) )
+			return FMath::Max( *Tolerance, 0.0f );
+	}
+
+	return KeyframeReductionTolerance;
+}
+
+void UHoudiniPointCache::ReduceKeyframes()
+{
+	KeyframeReductionRatio = 1.0f;
+	if ( KeyframeReductionTolerance <= 0.0f && KeyframeReductionAttributeTolerances.Num() <= 0 )
+		return;
+
+	if ( TopologyMode == EHoudiniPointCacheTopology::Fixed || ResampleTimeStep > 0.0f )
+	{
+		UE_LOG( LogHoudiniNiagara, Warning, TEXT( "Point cache %s: keyframe reduction is not compatible with the fixed topology mode or uniform resampling and was skipped." ), *GetName() );
+		return;
+	}
+
+	// We need point IDs, time values and the point sample index table
+	int32 IDAttributeIndex = GetAttributeAttributeIndex( EHoudiniAttributes::POINTID );
+	int32 TimeAttributeIndex = GetAttributeAttributeIndex( EHoudiniAttributes::TIME );
+	if ( IDAttributeIndex < 0 || IDAttributeIndex >= NumberOfAttributes || TimeAttributeIndex < 0 || TimeAttributeIndex >= NumberOfAttributes
+		|| NumberOfPoints <= 0 || NumberOfSamples <= 0 || PointSampleIndexOffsets.Num() != NumberOfPoints + 1 )
+		return;
+
+	if ( FloatSampleData.Num() != NumberOfSamples * NumberOfAttributes || IntSampleData.Num() != NumberOfSamples * NumberOfIntColumns )
+		return;
+
+	// Removing samples would remove points from some frames: in Auto mode, a point cache with a fixed topology
+	// keeps all its samples so that BuildFixedTopology can still store them as a dense [frame][point] block.
+	if ( TopologyMode == EHoudiniPointCacheTopology::Auto )
+	{
+		BuildFrameTable();
+
+		TArray<int32> DenseSampleIndexes;
+		int32 NumMissingSamples = 0;
+		if ( FindDenseSampleIndexes( DenseSampleIndexes, false, NumMissingSamples ) )
+		{
+			UE_LOG( LogHoudiniNiagara, Log, TEXT( "Point cache %s: keyframe reduction was skipped to keep the fixed topology, set TopologyMode to Variable to reduce it." ), *GetName() );
+			return;
+		}
+	}
+
+	// The interpolation error is checked on every attribute, except for the point ID and time.
+	// Integer attributes are not interpolated, so their value must not change on the removed samples.
+	TArray<int32> FloatAttributes;
+	TArray<float> FloatTolerances;
+	for ( int32 AttrIndex = 0; AttrIndex < NumberOfAttributes; AttrIndex++ )
+	{
+		if ( AttrIndex == IDAttributeIndex || AttrIndex == TimeAttributeIndex || GetAttributeIntColumnIndex( AttrIndex ) >= 0 )
+			continue;
+
+		FloatAttributes.Add( AttrIndex );
+		FloatTolerances.Add( GetKeyframeReductionTolerance( AttrIndex ) );
+	}
+
+	const float* TimeValues = FloatSampleData.GetData() + TimeAttributeIndex * NumberOfSamples;
+
+	// Returns the interpolation error of a sample when interpolating between two other samples, relative to the attributes tolerances.
+	// Samples with an error greater than 1 must be kept.
+	auto GetInterpolationError = [&]( int32 StartSample, int32 SampleIndex, int32 EndSample )
+	{
+		const float Duration = TimeValues[ EndSample ] - TimeValues[ StartSample ];
+		if ( Duration <= 0.0f )
+			return FLT_MAX;
+
+		for ( int32 IntColumn = 0; IntColumn < NumberOfIntColumns; IntColumn++ )
+		{
+			const int32* Values = IntSampleData.GetData() + IntColumn * NumberOfSamples;
+			if ( Values[ SampleIndex ] != Values[ StartSample ] )
+				return FLT_MAX;
+		}
+
+		const float Weight = ( TimeValues[ SampleIndex ] - TimeValues[ StartSample ] ) / Duration;
+		float MaxError = 0.0f;
+		for ( int32 Idx = 0; Idx < FloatAttributes.Num(); Idx++ )
+		{
+			const float* Values = FloatSampleData.GetData() + FloatAttributes[ Idx ] * NumberOfSamples;
+			const float Error = FMath::Abs( FMath::Lerp( Values[ StartSample ], Values[ EndSample ], Weight ) - Values[ SampleIndex ] );
+			if ( Error <= 0.0f )
+				continue;
+
+			if ( FloatTolerances[ Idx ] <= 0.0f )
+				return FLT_MAX;
+
+			MaxError = FMath::Max( MaxError, Error / FloatTolerances[ Idx ] );
+		}
+
+		return MaxError;
+	};
+
+	// Simplify each point's samples by recursively keeping the sample with the largest interpolation error,
+	// until all the removed samples are within tolerance. The first and last sample of each point are always kept.
+	TBitArray<> KeepSample( true, NumberOfSamples );
+	TArray<TPair<int32, int32>> Segments;
+	for ( int32 PointID = 0; PointID < NumberOfPoints; PointID++ )
+	{
+		int32 FirstIndex = 0;
+		int32 NumSampleIndexes = 0;
+		if ( !GetPointSampleIndexRange( PointID, FirstIndex, NumSampleIndexes ) || NumSampleIndexes <= 2 )
+			continue;
+
+		// Only reduce points whose samples are sorted by time
+		const int32* SampleIndexes = PointSampleIndexes.GetData() + FirstIndex;
+		bool bSorted = true;
+		for ( int32 Idx = 1; Idx < NumSampleIndexes && bSorted; Idx++ )
+			bSorted = TimeValues[ SampleIndexes[ Idx ] ] >= TimeValues[ SampleIndexes[ Idx - 1 ] ];
+
+		if ( !bSorted )
+			continue;
+
+		for ( int32 Idx = 1; Idx < NumSampleIndexes - 1; Idx++ )
+			KeepSample[ SampleIndexes[ Idx ] ] = false;
+
+		Segments.Reset();
+		Segments.Add( TPair<int32, int32>( 0, NumSampleIndexes - 1 ) );
+		while ( Segments.Num() > 0 )
+		{
+			const TPair<int32, int32> Segment = Segments.Pop();
+
+			int32 WorstIdx = INDEX_NONE;
+			float WorstError = 1.0f;
+			for ( int32 Idx = Segment.Key + 1; Idx < Segment.Value; Idx++ )
+			{
+				const float Error = GetInterpolationError( SampleIndexes[ Segment.Key ], SampleIndexes[ Idx ], SampleIndexes[ Segment.Value ] );
+				if ( Error > WorstError )
+				{
+					WorstError = Error;
+					WorstIdx = Idx;
+				}
+			}
+
+			if ( WorstIdx == INDEX_NONE )
+				continue;
+
+			KeepSample[ SampleIndexes[ WorstIdx ] ] = true;
+			Segments.Add( TPair<int32, int32>( Segment.Key, WorstIdx ) );
+			Segments.Add( TPair<int32, int32>( WorstIdx, Segment.Value ) );
+		}
+	}
+
+	const int32 NumKeptSamples = KeepSample.CountSetBits();
+	if ( NumKeptSamples >= NumberOfSamples )
+	{
+		UE_LOG( LogHoudiniNiagara, Log, TEXT( "Point cache %s: keyframe reduction did not remove any sample." ), *GetName() );
+		return;
+	}
+
+	// Remove the samples from FloatSampleData and IntSampleData, keeping the samples order
+	TArray<int32> KeptSampleIndexes;
+	KeptSampleIndexes.Reserve( NumKeptSamples );
+	for ( TConstSetBitIterator<> It( KeepSample ); It; ++It )
+		KeptSampleIndexes.Add( It.GetIndex() );
+
+	TArray<float> SampleData;
+	SampleData.SetNumUninitialized( NumKeptSamples * NumberOfAttributes );
+	for ( int32 AttrIndex = 0; AttrIndex < NumberOfAttributes; AttrIndex++ )
+	{
+		const float* SourceValues = FloatSampleData.GetData() + AttrIndex * NumberOfSamples;
+		float* Values = SampleData.GetData() + AttrIndex * NumKeptSamples;
+		for ( int32 Idx = 0; Idx < NumKeptSamples; Idx++ )
+			Values[ Idx ] = SourceValues[ KeptSampleIndexes[ Idx ] ];
+	}
+
+	TArray<int32> IntData;
+	IntData.SetNumUninitialized( NumKeptSamples * NumberOfIntColumns );
+	for ( int32 IntColumn = 0; IntColumn < NumberOfIntColumns; IntColumn++ )
+	{
+		const int32* SourceValues = IntSampleData.GetData() + IntColumn * NumberOfSamples;
+		int32* Values = IntData.GetData() + IntColumn * NumKeptSamples;
+		for ( int32 Idx = 0; Idx < NumKeptSamples; Idx++ )
+			Values[ Idx ] = SourceValues[ KeptSampleIndexes[ Idx ] ];
+	}
+
+	KeyframeReductionRatio = (float)NumberOfSamples / (float)NumKeptSamples;
+	UE_LOG( LogHoudiniNiagara, Log, TEXT( "Point cache %s: keyframe reduction kept %d of %d samples (%.2fx reduction)." ),
+		*GetName(), NumKeptSamples, NumberOfSamples, KeyframeReductionRatio );
+
+	FloatSampleData = MoveTemp( SampleData );
+	IntSampleData = MoveTemp( IntData );
+	NumberOfSamples = NumKeptSamples;
+
+	BuildPointSampleIndexes();
+}
+
+void UHoudiniPointCache::ResampleUniformly()
+{
+	UniformSampleTimeStep = 0.0f;
+	if ( ResampleTimeStep <= 0.0f )
+		return;
+
+	if ( TopologyMode == EHoudiniPointCacheTopology::Fixed )
+	{
+		UE_LOG( LogHoudiniNiagara, Warning, TEXT( "Point cache %s: uniform resampling is not compatible with the fixed topology mode and was skipped." ), *GetName() );
+		return;
+	}
+
+	// We need point IDs, time values and the point sample index table
+	int32 IDAttributeIndex = GetAttributeAttributeIndex( EHoudiniAttributes::POINTID );
+	int32 TimeAttributeIndex = GetAttributeAttributeIndex( EHoudiniAttributes::TIME );
+	if ( IDAttributeIndex < 0 || IDAttributeIndex >= NumberOfAttributes || TimeAttributeIndex < 0 || TimeAttributeIndex >= NumberOfAttributes
+		|| NumberOfPoints <= 0 || NumberOfSamples <= 0 || PointSampleIndexOffsets.Num() != NumberOfPoints + 1 || PointSampleTimes.Num() != PointSampleIndexes.Num() )
+	{
+		UE_LOG( LogHoudiniNiagara, Warning, TEXT( "Point cache %s: uniform resampling requires point ids and time values and was skipped." ), *GetName() );
+		return;
+	}
+
+	if ( FloatSampleData.Num() != NumberOfSamples * NumberOfAttributes || IntSampleData.Num() != NumberOfSamples * NumberOfIntColumns )
+		return;
+
+	// Build the list of resampled samples, for each point from its first to its last sample time
+	struct FResampledSample
+	{
+		float Time;
+		int32 PointID;
+	};
+
+	TArray<FResampledSample> ResampledSamples;
+	for ( int32 PointID = 0; PointID < NumberOfPoints; PointID++ )
+	{
+		int32 FirstIndex = 0;
+		int32 NumSampleIndexes = 0;
+		if ( !GetPointSampleIndexRange( PointID, FirstIndex, NumSampleIndexes ) || NumSampleIndexes <= 0 )
+			continue;
+
+		float StartTime = PointSampleTimes[ FirstIndex ];
+		float EndTime = StartTime;
+		for ( int32 Idx = FirstIndex + 1; Idx < FirstIndex + NumSampleIndexes; Idx++ )
+		{
+			StartTime = FMath::Min( StartTime, PointSampleTimes[ Idx ] );
+			EndTime = FMath::Max( EndTime, PointSampleTimes[ Idx ] );
+		}
+
+		const int32 NumSteps = FMath::CeilToInt( ( EndTime - StartTime ) / ResampleTimeStep - KINDA_SMALL_NUMBER ) + 1;
+		for ( int32 Step = 0; Step < NumSteps; Step++ )
+			ResampledSamples.Add( { StartTime + Step * ResampleTimeStep, PointID } );
+	}
+
+	// Keep the samples sorted by time, the samples of each point stay sorted by step
+	ResampledSamples.StableSort( []( const FResampledSample& A, const FResampledSample& B ) { return A.Time < B.Time; } );
+
+	// Interpolate the values of each resampled sample from the source samples. Integer attributes are not interpolated.
+	const int32 NumResampledSamples = ResampledSamples.Num();
+	TArray<float> SampleData;
+	SampleData.SetNumUninitialized( NumResampledSamples * NumberOfAttributes );
+	TArray<int32> IntData;
+	IntData.SetNumUninitialized( NumResampledSamples * NumberOfIntColumns );
+	for ( int32 SampleIndex = 0; SampleIndex < NumResampledSamples; SampleIndex++ )
+	{
+		const FResampledSample& Sample = ResampledSamples[ SampleIndex ];
+
+		int32 PrevSampleIndex = 0;
+		int32 NextSampleIndex = 0;
+		float PrevWeight = 1.0f;
+		GetSampleIndexesForPointAtTime( Sample.PointID, Sample.Time, PrevSampleIndex, NextSampleIndex, PrevWeight );
+
+		for ( int32 AttrIndex = 0; AttrIndex < NumberOfAttributes; AttrIndex++ )
+		{
+			const float* SourceValues = FloatSampleData.GetData() + AttrIndex * NumberOfSamples;
+			SampleData[ SampleIndex + AttrIndex * NumResampledSamples ] = FMath::Lerp( SourceValues[ PrevSampleIndex ], SourceValues[ NextSampleIndex ], PrevWeight );
+		}
+
+		SampleData[ SampleIndex + IDAttributeIndex * NumResampledSamples ] = (float)Sample.PointID;
+		SampleData[ SampleIndex + TimeAttributeIndex * NumResampledSamples ] = Sample.Time;
+
+		for ( int32 IntColumn = 0; IntColumn < NumberOfIntColumns; IntColumn++ )
+			IntData[ SampleIndex + IntColumn * NumResampledSamples ] = IntSampleData[ PrevSampleIndex + IntColumn * NumberOfSamples ];
+	}
+
+	UE_LOG( LogHoudiniNiagara, Log, TEXT( "Point cache %s: resampled %d samples to %d samples with a time step of %g." ),
+		*GetName(), NumberOfSamples, NumResampledSamples, ResampleTimeStep );
+
+	FloatSampleData = MoveTemp( SampleData );
+	IntSampleData = MoveTemp( IntData );
+	NumberOfSamples = NumResampledSamples;
+
+	BuildPointSampleIndexes();
+
+	UniformSampleTimeStep = ResampleTimeStep;
+}
+
+void UHoudiniPointCache::BuildPointSampleTimes()
+{
+	PointSampleTimes.Empty( PointSampleIndexes.Num() );
+	PointSampleTimes.SetNumUninitialized( PointSampleIndexes.Num() );
+	for ( int32 Idx = 0; Idx < PointSampleIndexes.Num(); Idx++ )
+	{
+		// Samples without time informations are considered to be at time 0
+		float SampleTime = 0.0f;
+		if ( !GetTimeValue( PointSampleIndexes[ Idx ], SampleTime ) )
+			SampleTime = 0.0f;
+
+		PointSampleTimes[ Idx ] = SampleTime;
+	}
+}
+
+// Returns the first index in [Low, High) of a sorted sample times array for which IsBefore returns false, or High.
+// If Hint is in [Low, High], the search gallops from it first, so bounds close to the hint are found in a few steps.
+template<typename PredicateType>
+static int32
+SampleTimesLowerBound(const float* SampleTimes, int32 Low, int32 High, const int32& Hint, PredicateType IsBefore)
+{
+	if ( Hint >= Low && Hint <= High )
+	{
+		int32 Step = 1;
+		if ( Hint < High && IsBefore( SampleTimes[ Hint ] ) )
+		{
+			// The bound is after the hint
+			int32 Probe = Hint + 1;
+			Low = Probe;
+			while ( Probe < High && IsBefore( SampleTimes[ Probe ] ) )
+			{
+				Low = Probe + 1;
+				Probe = Low + Step;
+				Step *= 2;
+			}
+			High = FMath::Min( Probe, High );
+		}
+		else
+		{
+			// The bound is at or before the hint
+			int32 Probe = Hint - 1;
+			High = Hint;
+			while ( Probe >= Low && !IsBefore( SampleTimes[ Probe ] ) )
+			{
+				High = Probe;
+				Probe = High - Step;
+				Step *= 2;
+			}
+			Low = FMath::Max( Probe + 1, Low );
+		}
+	}
+
+	while ( Low < High )
+	{
+		const int32 Mid = Low + ( High - Low ) / 2;
+		if ( IsBefore( SampleTimes[ Mid ] ) )
+			Low = Mid + 1;
+		else
+			High = Mid;
+	}
+	return Low;
+}
+
+// Finds the previous and next entries surrounding desiredTime in an array of sorted sample times.
+// If several samples share the previous time value, the first one is used.
+// If InOutCursor is valid, the search starts from it, and it is then set to the index of the first sample not before desiredTime.
+// Returns false if the array is empty.
+static bool
+FindSampleTimesBracket(const float* SampleTimes, const int32& NumSampleTimes, const float& desiredTime, int32& PrevIdx, int32& NextIdx, float& PrevWeight, int32* InOutCursor = nullptr)
+{
+	if ( !SampleTimes || NumSampleTimes <= 0 )
+		return false;
+
+	const int32 Hint = InOutCursor ? *InOutCursor : INDEX_NONE;
+
+	// Find the first sample that is not before the desired time
+	NextIdx = SampleTimesLowerBound( SampleTimes, 0, NumSampleTimes, Hint, [&desiredTime]( float SampleTime )
+	{
+		return SampleTime < desiredTime && !FMath::IsNearlyEqual( SampleTime, desiredTime );
+	});
+
+	if ( InOutCursor )
+		*InOutCursor = NextIdx;
+
+	if ( NextIdx < NumSampleTimes && FMath::IsNearlyEqual( SampleTimes[ NextIdx ], desiredTime ) )
+	{
+		PrevIdx = NextIdx;
+		PrevWeight = 1.0f;
+		return true;
+	}
+
+	if ( NextIdx <= 0 )
+	{
+		// The desired time is before the first sample
+		PrevIdx = 0;
+		NextIdx = 0;
+		PrevWeight = 0.0f;
+		return true;
+	}
+
+	// When searching from a cursor, the first sample sharing the previous time is usually the previous one
+	const float PrevTime = SampleTimes[ NextIdx - 1 ];
+	PrevIdx = SampleTimesLowerBound( SampleTimes, 0, NextIdx - 1, InOutCursor ? NextIdx - 1 : INDEX_NONE, [&PrevTime]( float SampleTime ) { return SampleTime < PrevTime; } );
+
+	if ( NextIdx >= NumSampleTimes )
+	{
+		// The desired time is after the last sample
+		NextIdx = PrevIdx;
+		PrevWeight = 1.0f;
+		return true;
+	}
+
+	// Calculate the weight
+	const float NextTime = SampleTimes[ NextIdx ];
+	PrevWeight = ( ( desiredTime - PrevTime ) / ( NextTime - PrevTime ) );
+
+	return true;
+}
+
+bool UHoudiniPointCache::GetSampleIndexesForPointAtTime(const int32& PointID, const float& desiredTime, int32& PrevSampleIndex, int32& NextSampleIndex, float& PrevWeight ) const
+{
+	// Invalid PointID
+	if ( PointID < 0 || PointID >= NumberOfPoints )
+		return false;
+
+	// With uniformly resampled points, the sample indexes are computed from the point's first sample time
+	if ( UniformSampleTimeStep > 0.0f && !bHasFixedTopology )
+	{
+		int32 FirstIndex = 0;
+		int32 NumSampleIndexes = 0;
+		if ( !GetPointSampleIndexRange( PointID, FirstIndex, NumSampleIndexes ) || NumSampleIndexes <= 0 || !PointSampleTimes.IsValidIndex( FirstIndex ) )
+			return false;
+
+		const float Step = ( desiredTime - PointSampleTimes[ FirstIndex ] ) / UniformSampleTimeStep;
+		if ( Step <= 0.0f )
+		{
+			// The desired time is before or on the first sample
+			PrevSampleIndex = PointSampleIndexes[ FirstIndex ];
+			NextSampleIndex = PrevSampleIndex;
+			PrevWeight = Step < 0.0f ? 0.0f : 1.0f;
+			return true;
+		}
+
+		if ( Step >= NumSampleIndexes - 1 )
+		{
+			// The desired time is after or on the last sample
+			PrevSampleIndex = PointSampleIndexes[ FirstIndex + NumSampleIndexes - 1 ];
+			NextSampleIndex = PrevSampleIndex;
+			PrevWeight = 1.0f;
+			return true;
+		}
+
+		const int32 StepIndex = FMath::FloorToInt( Step );
+		PrevSampleIndex = PointSampleIndexes[ FirstIndex + StepIndex ];
+		NextSampleIndex = PointSampleIndexes[ FirstIndex + StepIndex + 1 ];
+		PrevWeight = Step - StepIndex;
+		return true;
+	}
+
+	// With a fixed topology, the point has a sample on every frame and its sample indexes can be computed directly
+	if ( bHasFixedTopology )
+	{
+		int32 PrevFrameIndex = 0;
+		int32 NextFrameIndex = 0;
+		if ( !GetFrameIndexesAtTime( desiredTime, PrevFrameIndex, NextFrameIndex, PrevWeight ) )
+			return false;
+
+		PrevSampleIndex = PrevFrameIndex * NumberOfPoints + PointID;
+		NextSampleIndex = NextFrameIndex * NumberOfPoints + PointID;
+		return true;
+	}
+
+	// Otherwise, the point's sorted sample times are read from the point sample index table
+	int32 FirstIndex = 0;
+	int32 NumSampleIndexes = 0;
+	if ( !GetPointSampleIndexRange( PointID, FirstIndex, NumSampleIndexes ) || NumSampleIndexes <= 0 )
+		return false;
+
+	if ( !PointSampleTimes.IsValidIndex( FirstIndex + NumSampleIndexes - 1 ) )
+		return false;
+
+	int32 PrevIdx = 0;
+	int32 NextIdx = 0;
+	if ( !FindSampleTimesBracket( PointSampleTimes.GetData() + FirstIndex, NumSampleIndexes, desiredTime, PrevIdx, NextIdx, PrevWeight ) )
+		return false;
+
+	PrevSampleIndex = PointSampleIndexes[ FirstIndex + PrevIdx ];
+	NextSampleIndex = PointSampleIndexes[ FirstIndex + NextIdx ];
+
+	return true;
+}
+
+bool UHoudiniPointCache::GetSampleIndexesForPointAtTimeWithCursor(const int32& PointID, const float& desiredTime, int32& SampleCursor, int32& PrevSampleIndex, int32& NextSampleIndex, float& PrevWeight) const
+{
+	// Uniformly resampled points are not searched, the cursor is left as is
+	if ( UniformSampleTimeStep > 0.0f && !bHasFixedTopology )
+		return GetSampleIndexesForPointAtTime( PointID, desiredTime, PrevSampleIndex, NextSampleIndex, PrevWeight );
+
+	// Invalid PointID
+	if ( PointID < 0 || PointID >= NumberOfPoints )
+		return false;
+
+	int32 PrevIdx = 0;
+	int32 NextIdx = 0;
+	if ( bHasFixedTopology )
+	{
+		if ( !FindSampleTimesBracket( FrameTimes.GetData(), FrameTimes.Num(), desiredTime, PrevIdx, NextIdx, PrevWeight, &SampleCursor ) )
+			return false;
+
+		PrevSampleIndex = PrevIdx * NumberOfPoints + PointID;
+		NextSampleIndex = NextIdx * NumberOfPoints + PointID;
+		return true;
+	}
+
+	int32 FirstIndex = 0;
+	int32 NumSampleIndexes = 0;
+	if ( !GetPointSampleIndexRange( PointID, FirstIndex, NumSampleIndexes ) || NumSampleIndexes <= 0 )
+		return false;
+
+	if ( !PointSampleTimes.IsValidIndex( FirstIndex + NumSampleIndexes - 1 ) )
+		return false;
+
+	if ( !FindSampleTimesBracket( PointSampleTimes.GetData() + FirstIndex, NumSampleIndexes, desiredTime, PrevIdx, NextIdx, PrevWeight, &SampleCursor ) )
+		return false;
+
+	PrevSampleIndex = PointSampleIndexes[ FirstIndex + PrevIdx ];
+	NextSampleIndex = PointSampleIndexes[ FirstIndex + NextIdx ];
+
+	return true;
+}
+
+bool UHoudiniPointCache::GetFrameIndexesAtTime(const float& desiredTime, int32& PrevFrameIndex, int32& NextFrameIndex, float& PrevWeight) const
+{
+	if ( !bHasFixedTopology )
+		return false;
+
+	return FindSampleTimesBracket( FrameTimes.GetData(), FrameTimes.Num(), desiredTime, PrevFrameIndex, NextFrameIndex, PrevWeight );
+}
+
+bool UHoudiniPointCache::FindDenseSampleIndexes( TArray<int32>& OutDenseSampleIndexes, const bool& bFillMissingSamples, int32& OutNumMissingSamples ) const
+{
+	OutDenseSampleIndexes.Empty();
+	OutNumMissingSamples = 0;
+
+	const int32 NumPoints = NumberOfPoints;
+	const int32 NumFrames = FrameTimes.Num();
+	int32 IDAttributeIndex = GetAttributeAttributeIndex( EHoudiniAttributes::POINTID );
+	if ( IDAttributeIndex < 0 || IDAttributeIndex >= NumberOfAttributes || NumPoints <= 0 || NumFrames <= 0 || FrameSampleIndexOffsets.Num() != NumFrames + 1 )
+		return false;
+
+	OutDenseSampleIndexes.Init( INDEX_NONE, NumFrames * NumPoints );
+	for ( int32 FrameIndex = 0; FrameIndex < NumFrames; FrameIndex++ )
+	{
+		for ( int32 SampleIndex = FrameSampleIndexOffsets[ FrameIndex ]; SampleIndex < FrameSampleIndexOffsets[ FrameIndex + 1 ]; SampleIndex++ )
+		{
+			const int32 PointID = (int32)FloatSampleData[ SampleIndex + ( GetAttributeColumnIndex( IDAttributeIndex ) * NumberOfSamples ) ];
+			if ( PointID < 0 || PointID >= NumPoints )
+				return false;
+
+			int32& DenseSampleIndex = OutDenseSampleIndexes[ FrameIndex * NumPoints + PointID ];
+			if ( DenseSampleIndex != INDEX_NONE )
+			{
+				// The point appears twice on the same frame
+				if ( !bFillMissingSamples )
+					return false;
+
+				continue;
+			}
+
+			DenseSampleIndex = SampleIndex;
+		}
+	}
+
+	// Check for missing samples, or fill them with the point's closest sample
+	for ( int32 FrameIndex = 0; FrameIndex < NumFrames; FrameIndex++ )
+	{
+		for ( int32 PointID = 0; PointID < NumPoints; PointID++ )
+		{
+			int32& DenseSampleIndex = OutDenseSampleIndexes[ FrameIndex * NumPoints + PointID ];
+			if ( DenseSampleIndex != INDEX_NONE )
+				continue;
+
+			if ( !bFillMissingSamples )
+				return false;
+
+			int32 PrevSampleIndex = INDEX_NONE;
+			int32 NextSampleIndex = INDEX_NONE;
+			float PrevWeight = 1.0f;
+			if ( !GetSampleIndexesForPointAtTime( PointID, FrameTimes[ FrameIndex ], PrevSampleIndex, NextSampleIndex, PrevWeight ) )
+				return false;
+
+			DenseSampleIndex = PrevWeight >= 0.5f ? PrevSampleIndex : NextSampleIndex;
+			OutNumMissingSamples++;
+		}
+	}
+
+	return true;
+}
+
+void UHoudiniPointCache::BuildFixedTopology()
+{
+	bHasFixedTopology = false;
+	if ( TopologyMode == EHoudiniPointCacheTopology::Variable || UniformSampleTimeStep > 0.0f )
+		return;
+
+	// We need point IDs, time values and a valid frame table
+	const int32 NumPoints = NumberOfPoints;
+	const int32 NumFrames = FrameTimes.Num();
+	int32 IDAttributeIndex = GetAttributeAttributeIndex( EHoudiniAttributes::POINTID );
+	int32 TimeAttributeIndex = GetAttributeAttributeIndex( EHoudiniAttributes::TIME );
+	if ( IDAttributeIndex < 0 || IDAttributeIndex >= NumberOfAttributes || TimeAttributeIndex < 0 || TimeAttributeIndex >= NumberOfAttributes 
+		|| NumPoints <= 0 || NumFrames <= 0 || FrameSampleIndexOffsets.Num() != NumFrames + 1 )
+	{
+		if ( TopologyMode == EHoudiniPointCacheTopology::Fixed )
+			UE_LOG( LogHoudiniNiagara, Warning, TEXT( "Point cache %s: fixed topology requires point ids and time values, using the point sample index table instead." ), *GetName() );
+		return;
+	}
+
+	// Find the source sample of each point on each frame
+	TArray<int32> DenseSampleIndexes;
+	int32 NumMissingSamples = 0;
+	if ( !FindDenseSampleIndexes( DenseSampleIndexes, TopologyMode == EHoudiniPointCacheTopology::Fixed, NumMissingSamples ) )
+		return;
+
+	// Copy the samples to the dense [frame][point] block, keeping the attribute-major layout
+	const int32 NumDenseSamples = NumFrames * NumPoints;
+	const int32 NumColumns = FloatSampleData.Num() / NumberOfSamples;
+	TArray<float> DenseFloatSampleData;
+	DenseFloatSampleData.SetNumUninitialized( NumDenseSamples * NumColumns );
+	for ( int32 ColumnIndex = 0; ColumnIndex < NumColumns; ColumnIndex++ )
+	{
+		const float* SourceValues = FloatSampleData.GetData() + ColumnIndex * NumberOfSamples;
+		float* DenseValues = DenseFloatSampleData.GetData() + ColumnIndex * NumDenseSamples;
+		for ( int32 DenseIndex = 0; DenseIndex < NumDenseSamples; DenseIndex++ )
+			DenseValues[ DenseIndex ] = SourceValues[ DenseSampleIndexes[ DenseIndex ] ];
+	}
+
+	TArray<int32> DenseIntSampleData;
+	DenseIntSampleData.SetNumUninitialized( NumDenseSamples * NumberOfIntColumns );
+	for ( int32 ColumnIndex = 0; ColumnIndex < NumberOfIntColumns; ColumnIndex++ )
+	{
+		const int32* SourceValues = IntSampleData.GetData() + ColumnIndex * NumberOfSamples;
+		int32* DenseValues = DenseIntSampleData.GetData() + ColumnIndex * NumDenseSamples;
+		for ( int32 DenseIndex = 0; DenseIndex < NumDenseSamples; DenseIndex++ )
+			DenseValues[ DenseIndex ] = SourceValues[ DenseSampleIndexes[ DenseIndex ] ];
+	}
+
+	// Filled samples are moved to their frame
+	for ( int32 FrameIndex = 0; FrameIndex < NumFrames; FrameIndex++ )
+	{
+		for ( int32 PointID = 0; PointID < NumPoints; PointID++ )
+			DenseFloatSampleData[ FrameIndex * NumPoints + PointID + GetAttributeColumnIndex( TimeAttributeIndex ) * NumDenseSamples ] = FrameTimes[ FrameIndex ];
+	}
+
+	if ( NumMissingSamples > 0 )
+		UE_LOG( LogHoudiniNiagara, Log, TEXT( "Point cache %s: filled %d missing samples to use a fixed topology." ), *GetName(), NumMissingSamples );
+
+	FloatSampleData = MoveTemp( DenseFloatSampleData );
+	IntSampleData = MoveTemp( DenseIntSampleData );
+	NumberOfSamples = NumDenseSamples;
+	for ( int32 FrameIndex = 0; FrameIndex <= NumFrames; FrameIndex++ )
+		FrameSampleIndexOffsets[ FrameIndex ] = FrameIndex * NumPoints;
+
+	// The point sample index table is no longer needed
+	PointSampleIndexOffsets.Empty();
+	PointSampleIndexes.Empty();
+	PointSampleTimes.Empty();
+
+	bHasFixedTopology = true;
+}
+
+void UHoudiniPointCache::ResetPointAttributes()
+{
+	AttributeColumnIndexes.Empty();
+	PointAttributeValues.Empty();
+	NumberOfPointAttributes = 0;
+}
+
+void UHoudiniPointCache::HoistPointAttributes()
+{
+	ResetPointAttributes();
+
+	// Without point IDs, each sample is its own point and there is nothing to gain
+	int32 IDAttributeIndex = GetAttributeAttributeIndex( EHoudiniAttributes::POINTID );
+	int32 TimeAttributeIndex = GetAttributeAttributeIndex( EHoudiniAttributes::TIME );
+	if ( IDAttributeIndex < 0 || IDAttributeIndex >= NumberOfAttributes || NumberOfPoints <= 0 || NumberOfPoints >= NumberOfSamples )
+		return;
+
+	if ( FloatSampleData.Num() != NumberOfSamples * NumberOfAttributes )
+		return;
+
+	// Find the attributes that have the same value on all the samples of each point
+	// The point ID and time attributes always stay in FloatSampleData, integer attributes stay in IntSampleData
+	const float* IDValues = FloatSampleData.GetData() + IDAttributeIndex * NumberOfSamples;
+	TArray<int32> PointAttributeIndexes;
+	TArray<float> PointValues;
+	TBitArray<> HasPointValue;
+	for ( int32 AttrIndex = 0; AttrIndex < NumberOfAttributes; AttrIndex++ )
+	{
+		if ( AttrIndex == IDAttributeIndex || AttrIndex == TimeAttributeIndex || GetAttributeIntColumnIndex( AttrIndex ) >= 0 )
+			continue;
+
+		const int32 FirstValue = PointValues.Num();
+		PointValues.AddZeroed( NumberOfPoints );
+		HasPointValue.Init( false, NumberOfPoints );
+
+		bool bIsConstant = true;
+		const float* Values = FloatSampleData.GetData() + AttrIndex * NumberOfSamples;
+		for ( int32 SampleIndex = 0; SampleIndex < NumberOfSamples && bIsConstant; SampleIndex++ )
+		{
+			const int32 PointID = (int32)IDValues[ SampleIndex ];
+			if ( PointID < 0 || PointID >= NumberOfPoints )
+			{
+				bIsConstant = false;
+			}
+			else if ( !HasPointValue[ PointID ] )
+			{
+				HasPointValue[ PointID ] = true;
+				PointValues[ FirstValue + PointID ] = Values[ SampleIndex ];
+			}
+			else if ( PointValues[ FirstValue + PointID ] != Values[ SampleIndex ] )
+			{
+				bIsConstant = false;
+			}
+		}
+
+		if ( bIsConstant )
+			PointAttributeIndexes.Add( AttrIndex );
+		else
+			PointValues.SetNum( FirstValue );
+	}
+
+	const int32 NumPointAttributes = PointAttributeIndexes.Num();
+	if ( NumPointAttributes <= 0 )
+		return;
+
+	// Store the point values interleaved, so all the values of a point are contiguous
+	PointAttributeValues.SetNumUninitialized( NumberOfPoints * NumPointAttributes );
+	for ( int32 PointAttrIndex = 0; PointAttrIndex < NumPointAttributes; PointAttrIndex++ )
+	{
+		for ( int32 PointID = 0; PointID < NumberOfPoints; PointID++ )
+			PointAttributeValues[ PointID * NumPointAttributes + PointAttrIndex ] = PointValues[ PointAttrIndex * NumberOfPoints + PointID ];
+	}
+
+	// Remove the point attributes columns from FloatSampleData
+	const int32 NumSampleColumns = NumberOfAttributes - NumPointAttributes;
+	TArray<float> SampleData;
+	SampleData.SetNumUninitialized( NumberOfSamples * NumSampleColumns );
+	AttributeColumnIndexes.SetNumUninitialized( NumberOfAttributes );
+	int32 SampleColumn = 0;
+	for ( int32 AttrIndex = 0; AttrIndex < NumberOfAttributes; AttrIndex++ )
+	{
+		const int32 PointAttrIndex = PointAttributeIndexes.Find( AttrIndex );
+		if ( PointAttrIndex != INDEX_NONE )
+		{
+			AttributeColumnIndexes[ AttrIndex ] = -1 - PointAttrIndex;
+			continue;
+		}
+
+		FPlatformMemory::Memcpy( SampleData.GetData() + SampleColumn * NumberOfSamples, FloatSampleData.GetData() + AttrIndex * NumberOfSamples, NumberOfSamples * sizeof( float ) );
+		AttributeColumnIndexes[ AttrIndex ] = SampleColumn++;
+	}
+
+	UE_LOG( LogHoudiniNiagara, Log, TEXT( "Point cache %s: %d of %d attributes are constant per point, sample data reduced from %d to %d values." ),
+		*GetName(), NumPointAttributes, NumberOfAttributes, FloatSampleData.Num(), SampleData.Num() + PointAttributeValues.Num() );
+
+	FloatSampleData = MoveTemp( SampleData );
+	NumberOfPointAttributes = NumPointAttributes;
+}
+
+void UHoudiniPointCache::ResetQuantizedAttributes()
+{
+	QuantizedSampleData.Empty();
+	QuantizationParams.Empty();
+	QuantizationMaxErrors.Empty();
+	NumberOfQuantizedColumns = 0;
+}
+
+EHoudiniAttributeQuantization UHoudiniPointCache::GetAttributeQuantization( const int32& attrIndex ) const
+{
+	if ( !AttributeArray.IsValidIndex( attrIndex ) )
+		return EHoudiniAttributeQuantization::None;
+
+	// Look for the attribute name first (P.x), then for its vector attribute's name (P)
+	const FString& AttributeName = AttributeArray[ attrIndex ];
+	if ( const EHoudiniAttributeQuantization* Quantization = AttributeQuantization.Find( AttributeName ) )
+		return *Quantization;
+
+	int32 DotIndex = INDEX_NONE;
+	if ( AttributeName.FindLastChar( TEXT( '.' ), DotIndex ) )
+	{
+		if ( const EHoudiniAttributeQuantization* Quantization = AttributeQuantization.Find( AttributeName.Left( DotIndex ) ) )
+			return *Quantization;
+	}
+
+	return EHoudiniAttributeQuantization::None;
+}
+
+void UHoudiniPointCache::QuantizeAttributes()
+{
+	ResetQuantizedAttributes();
+
+	if ( AttributeQuantization.Num() <= 0 || NumberOfSamples <= 0 || NumberOfAttributes <= 0 )
+		return;
+
+	const int32 NumColumns = FloatSampleData.Num() / NumberOfSamples;
+	if ( NumColumns * NumberOfSamples != FloatSampleData.Num() )
+		return;
+
+	// The point ID and time attributes are used for lookups and always keep their full precision
+	int32 IDAttributeIndex = GetAttributeAttributeIndex( EHoudiniAttributes::POINTID );
+	int32 TimeAttributeIndex = GetAttributeAttributeIndex( EHoudiniAttributes::TIME );
+
+	TArray<float> Params;
+	Params.SetNumUninitialized( NumberOfAttributes * QuantizationParamsStride );
+	TArray<int32> QuantizedColumns;
+	for ( int32 AttrIndex = 0; AttrIndex < NumberOfAttributes; AttrIndex++ )
+	{
+		float* AttrParams = Params.GetData() + AttrIndex * QuantizationParamsStride;
+		AttrParams[ 0 ] = -1.0f;
+		AttrParams[ 1 ] = (float)EHoudiniAttributeQuantization::None;
+		AttrParams[ 2 ] = 0.0f;
+		AttrParams[ 3 ] = 1.0f;
+
+		const EHoudiniAttributeQuantization Quantization = GetAttributeQuantization( AttrIndex );
+		if ( Quantization == EHoudiniAttributeQuantization::None || AttrIndex == IDAttributeIndex || AttrIndex == TimeAttributeIndex )
+			continue;
+
+		// Integer attributes are stored in IntSampleData
+		if ( GetAttributeIntColumnIndex( AttrIndex ) >= 0 )
+			continue;
+
+		// Only the attributes stored per sample can be quantized
+		const int32 Column = GetAttributeColumnIndex( AttrIndex );
+		if ( Column < 0 || Column >= NumColumns )
+			continue;
+
+		// Find the range used to normalize the values
+		float MinValue = FLT_MAX;
+		float MaxValue = -FLT_MAX;
+		const float* Values = FloatSampleData.GetData() + Column * NumberOfSamples;
+		for ( int32 SampleIndex = 0; SampleIndex < NumberOfSamples; SampleIndex++ )
+		{
+			MinValue = FMath::Min( MinValue, Values[ SampleIndex ] );
+			MaxValue = FMath::Max( MaxValue, Values[ SampleIndex ] );
+		}
+
+		AttrParams[ 0 ] = (float)QuantizedColumns.Num();
+		AttrParams[ 1 ] = (float)Quantization;
+		if ( Quantization == EHoudiniAttributeQuantization::UNorm16 )
+		{
+			AttrParams[ 2 ] = MinValue;
+			AttrParams[ 3 ] = MaxValue > MinValue ? ( MaxValue - MinValue ) / 65535.0f : 1.0f;
+		}
+		else if ( Quantization == EHoudiniAttributeQuantization::SNorm16 )
+		{
+			const float MaxAbsValue = FMath::Max( FMath::Abs( MinValue ), FMath::Abs( MaxValue ) );
+			AttrParams[ 3 ] = MaxAbsValue > 0.0f ? MaxAbsValue / 32767.0f : 1.0f;
+		}
+
+		QuantizedColumns.Add( Column );
+	}
+
+	const int32 NumQuantizedColumns = QuantizedColumns.Num();
+	if ( NumQuantizedColumns <= 0 )
+		return;
+
+	// Encode the quantized columns, and keep track of the error introduced for each attribute
+	QuantizedSampleData.SetNumUninitialized( NumberOfSamples * NumQuantizedColumns );
+	for ( int32 AttrIndex = 0; AttrIndex < NumberOfAttributes; AttrIndex++ )
+	{
+		const float* AttrParams = Params.GetData() + AttrIndex * QuantizationParamsStride;
+		if ( AttrParams[ 0 ] < 0.0f )
+			continue;
+
+		const int32 QuantizedColumn = (int32)AttrParams[ 0 ];
+		const float* Values = FloatSampleData.GetData() + QuantizedColumns[ QuantizedColumn ] * NumberOfSamples;
+		uint16* QuantizedValues = QuantizedSampleData.GetData() + QuantizedColumn * NumberOfSamples;
+		float MaxError = 0.0f;
+		for ( int32 SampleIndex = 0; SampleIndex < NumberOfSamples; SampleIndex++ )
+		{
+			QuantizedValues[ SampleIndex ] = EncodeQuantizedValue( Values[ SampleIndex ], AttrParams );
+			MaxError = FMath::Max( MaxError, FMath::Abs( DecodeQuantizedValue( QuantizedValues[ SampleIndex ], AttrParams ) - Values[ SampleIndex ] ) );
+		}
+
+		QuantizationMaxErrors.Add( AttributeArray[ AttrIndex ], MaxError );
+		UE_LOG( LogHoudiniNiagara, Log, TEXT( "Point cache %s: attribute %s quantized as %s, maximum error %g." ),
+			*GetName(), *AttributeArray[ AttrIndex ], *StaticEnum<EHoudiniAttributeQuantization>()->GetNameStringByValue( (int64)AttrParams[ 1 ] ), MaxError );
+	}
+
+	// Remove the quantized columns from FloatSampleData
+	TArray<int32> NewColumnIndexes;
+	NewColumnIndexes.SetNumUninitialized( NumColumns );
+	TArray<float> SampleData;
+	SampleData.SetNumUninitialized( NumberOfSamples * ( NumColumns - NumQuantizedColumns ) );
+	int32 SampleColumn = 0;
+	for ( int32 Column = 0; Column < NumColumns; Column++ )
+	{
+		if ( QuantizedColumns.Contains( Column ) )
+		{
+			NewColumnIndexes[ Column ] = INDEX_NONE;
+			continue;
+		}
+
+		FPlatformMemory::Memcpy( SampleData.GetData() + SampleColumn * NumberOfSamples, FloatSampleData.GetData() + Column * NumberOfSamples, NumberOfSamples * sizeof( float ) );
+		NewColumnIndexes[ Column ] = SampleColumn++;
+	}
+
+	TArray<int32> ColumnIndexes;
+	ColumnIndexes.SetNumUninitialized( NumberOfAttributes );
+	for ( int32 AttrIndex = 0; AttrIndex < NumberOfAttributes; AttrIndex++ )
+	{
+		const int32 Column = GetAttributeColumnIndex( AttrIndex );
+		ColumnIndexes[ AttrIndex ] = Column >= 0 ? NewColumnIndexes[ Column ] : Column;
+	}
+
+	UE_LOG( LogHoudiniNiagara, Log, TEXT( "Point cache %s: %d attributes quantized, sample data reduced from %d to %d bytes." ),
+		*GetName(), NumQuantizedColumns, FloatSampleData.Num() * (int32)sizeof( float ), SampleData.Num() * (int32)sizeof( float ) + QuantizedSampleData.Num() * (int32)sizeof( uint16 ) );
+
+	FloatSampleData = MoveTemp( SampleData );
+	AttributeColumnIndexes = MoveTemp( ColumnIndexes );
+	QuantizationParams = MoveTemp( Params );
+	NumberOfQuantizedColumns = NumQuantizedColumns;
+}
+
+void UHoudiniPointCache::ResetIntAttributes()
+{
+	IntSampleData.Empty();
+	AttributeIntColumnIndexes.Empty();
+	NumberOfIntColumns = 0;
+}
+
+void UHoudiniPointCache::InitIntAttributes( const TArray<bool>& IsIntAttribute )
+{
+	ResetIntAttributes();
+
+	int32 NumIntColumns = 0;
+	for ( int32 AttrIndex = 0; AttrIndex < NumberOfAttributes; AttrIndex++ )
+	{
+		if ( IsIntAttribute.IsValidIndex( AttrIndex ) && IsIntAttribute[ AttrIndex ] )
+			NumIntColumns++;
+	}
+
+	if ( NumIntColumns <= 0 || NumberOfSamples <= 0 )
+		return;
+
+	AttributeIntColumnIndexes.Init( INDEX_NONE, NumberOfAttributes );
+	int32 IntColumn = 0;
+	for ( int32 AttrIndex = 0; AttrIndex < NumberOfAttributes; AttrIndex++ )
+	{
+		if ( IsIntAttribute.IsValidIndex( AttrIndex ) && IsIntAttribute[ AttrIndex ] )
+			AttributeIntColumnIndexes[ AttrIndex ] = IntColumn++;
+	}
+
+	IntSampleData.SetNumZeroed( NumberOfSamples * NumIntColumns );
+	NumberOfIntColumns = NumIntColumns;
+}
+
+void UHoudiniPointCache::CompactIntAttributes()
+{
+	if ( NumberOfIntColumns <= 0 || NumberOfSamples <= 0 )
+		return;
+
+	const int32 NumColumns = FloatSampleData.Num() / NumberOfSamples;
+	if ( NumColumns * NumberOfSamples != FloatSampleData.Num() )
+		return;
+
+	// Find the FloatSampleData columns that are also stored in IntSampleData
+	TArray<int32> NewColumnIndexes;
+	NewColumnIndexes.Init( 0, NumColumns );
+	for ( int32 AttrIndex = 0; AttrIndex < NumberOfAttributes; AttrIndex++ )
+	{
+		const int32 Column = GetAttributeColumnIndex( AttrIndex );
+		if ( GetAttributeIntColumnIndex( AttrIndex ) >= 0 && Column >= 0 && Column < NumColumns )
+			NewColumnIndexes[ Column ] = INDEX_NONE;
+	}
+
+	// Remove them from FloatSampleData
+	TArray<float> SampleData;
+	SampleData.Reserve( FloatSampleData.Num() );
+	int32 SampleColumn = 0;
+	for ( int32 Column = 0; Column < NumColumns; Column++ )
+	{
+		if ( NewColumnIndexes[ Column ] == INDEX_NONE )
+			continue;
+
+		SampleData.Append( FloatSampleData.GetData() + Column * NumberOfSamples, NumberOfSamples );
+		NewColumnIndexes[ Column ] = SampleColumn++;
+	}
+
+	if ( SampleColumn == NumColumns )
+		return;
+
+	TArray<int32> ColumnIndexes;
+	ColumnIndexes.SetNumUninitialized( NumberOfAttributes );
+	for ( int32 AttrIndex = 0; AttrIndex < NumberOfAttributes; AttrIndex++ )
+	{
+		const int32 Column = GetAttributeColumnIndex( AttrIndex );
+		ColumnIndexes[ AttrIndex ] = Column >= 0 && Column < NumColumns ? NewColumnIndexes[ Column ] : Column;
+	}
+
+	FloatSampleData = MoveTemp( SampleData );
+	AttributeColumnIndexes = MoveTemp( ColumnIndexes );
+}
+
+bool UHoudiniPointCache::GetPointIDsToSpawnAtTime(
+	const float& desiredTime,
+	int32& MinID, int32& MaxID, int32& Count,
+	int32& LastSpawnedPointID, float& LastSpawnTime, float& LastSpawnTimeRequest) const
+{
+	int32 lastID = 0;
+	if ( !GetLastPointIDToSpawnAtTime( desiredTime, lastID ) )
+	{
+		// The Point Cache doesn't have time informations, so always return all points in the file
+		MinID = 0;
+		MaxID = lastID;
+		Count = MaxID - MinID + 1;
+	}
+	else
+	{
+		// The Point Cache has time informations
+		// First, detect if we need to reset LastSpawnedPointID (after a loop of the emitter)
+		 if ( lastID < LastSpawnedPointID || desiredTime <= LastSpawnTime || desiredTime <= LastSpawnTimeRequest )
 		 	LastSpawnedPointID = -1;
 
 		if ( lastID < 0 )
@@ -906,9 +2606,54 @@ bool UHoudiniPointCache::GetAttributeIndexInArrayFromString(const FString& InAtt
 }
 
 // Returns the attribute index for a given string
+void UHoudiniPointCache::BuildAttributeIndexMap(const TArray<FString>& InAttributeArray, TMap<FName, int32>& OutAttributeIndexMap)
+{
+	OutAttributeIndexMap.Empty( InAttributeArray.Num() );
+
+	// Exact attribute names first, the first attribute wins if a name is used twice
+	for ( int32 Index = 0; Index < InAttributeArray.Num(); Index++ )
+	{
+		const FName AttributeName( *InAttributeArray[ Index ] );
+		if ( !OutAttributeIndexMap.Contains( AttributeName ) )
+			OutAttributeIndexMap.Add( AttributeName, Index );
+	}
+
+	// Then the vector attribute names (P for P.x), mapped to their first component
+	for ( int32 Index = 0; Index < InAttributeArray.Num(); Index++ )
+	{
+		int32 DotIndex = INDEX_NONE;
+		if ( !InAttributeArray[ Index ].FindChar( TEXT( '.' ), DotIndex ) || DotIndex <= 0 )
+			continue;
+
+		const FName VectorAttributeName( *InAttributeArray[ Index ].Left( DotIndex ) );
+		if ( !OutAttributeIndexMap.Contains( VectorAttributeName ) )
+			OutAttributeIndexMap.Add( VectorAttributeName, Index );
+	}
+}
+
+bool UHoudiniPointCache::GetAttributeIndexFromName( const FName& Attribute, int32& AttributeIndex ) const
+{
+	if ( const int32* FoundIndex = AttributeIndexMap.Find( Attribute ) )
+	{
+		AttributeIndex = *FoundIndex;
+		return true;
+	}
+
+	return false;
+}
+
 bool UHoudiniPointCache::GetAttributeIndexFromString( const FString& Attribute, int32& AttributeIndex ) const
 {
-   return GetAttributeIndexInArrayFromString(Attribute, AttributeArray, AttributeIndex);
+	// The map is only missing while importing
+	if ( AttributeIndexMap.Num() <= 0 )
+		return GetAttributeIndexInArrayFromString( Attribute, AttributeArray, AttributeIndex );
+
+	// Names that have never been added as FNames can't be attributes, and looking them up doesn't allocate
+	const FName AttributeName( *Attribute, FNAME_Find );
+	if ( AttributeName.IsNone() )
+		return false;
+
+	return GetAttributeIndexFromName( AttributeName, AttributeIndex );
 }
 
 // Returns the float value at a given point in the Point Cache
@@ -921,6 +2666,41 @@ bool UHoudiniPointCache::GetFloatValueForString( const int32& sampleIndex, const
     return GetFloatValue( sampleIndex, AttrIndex, value );
 }
 
+// Returns the integer value at a given point in the Point Cache
+bool UHoudiniPointCache::GetIntValue( const int32& sampleIndex, const int32& attrIndex, int32& value ) const
+{
+    if ( sampleIndex < 0 || sampleIndex >= NumberOfSamples )
+		return false;
+
+    const int32 IntColumn = GetAttributeIntColumnIndex( attrIndex );
+    if ( IntColumn < 0 )
+    {
+		// Not an integer attribute, round the float value down
+		float FloatValue = 0.0f;
+		if ( !GetFloatValue( sampleIndex, attrIndex, FloatValue ) )
+			return false;
+
+		value = FMath::FloorToInt( FloatValue );
+		return true;
+    }
+
+    int32 Index = sampleIndex + ( IntColumn * NumberOfSamples );
+    if ( !IntSampleData.IsValidIndex( Index ) )
+		return false;
+
+    value = IntSampleData[ Index ];
+    return true;
+}
+
+bool UHoudiniPointCache::GetIntValueForString( const int32& sampleIndex, const FString& Attribute, int32& value ) const
+{
+    int32 AttrIndex = -1;
+    if ( !GetAttributeIndexFromString( Attribute, AttrIndex ) )
+		return false;
+
+    return GetIntValue( sampleIndex, AttrIndex, value );
+}
+
 /*
 // Returns the string value at a given point in the CSV file
 bool UHoudiniPointCache::GetCSVStringValue( const int32& sampleIndex, const FString& Attribute, FString& value )
@@ -929,9 +2709,40 @@ bool UHoudiniPointCache::GetCSVStringValue( const int32& sampleIndex, const FStr
     if ( !GetAttributeIndexFromString( Attribute, AttrIndex ) )
 		return false;
 
-    return GetCSVStringValue( sampleIndex, AttrIndex, value );
+    return GetCSVStringValue( sampleIndex, AttrIndex, value );
+}
+*/
+
+void
+UHoudiniPointCache::PostLoad()
+{
+	Super::PostLoad();
+
+	// Convert the legacy per-point sample index arrays to the flat point / sample index table
+	if ( PointValueIndexes_DEPRECATED.Num() > 0 && PointSampleIndexOffsets.Num() <= 0 )
+	{
+		const int32 NumPoints = PointValueIndexes_DEPRECATED.Num();
+		PointSampleIndexOffsets.Empty( NumPoints + 1 );
+		PointSampleIndexOffsets.Add( 0 );
+		PointSampleIndexes.Empty();
+		for ( const FPointIndexes& ValueIndexes : PointValueIndexes_DEPRECATED )
+		{
+			PointSampleIndexes.Append( ValueIndexes.SampleIndexes );
+			PointSampleIndexOffsets.Add( PointSampleIndexes.Num() );
+		}
+	}
+	PointValueIndexes_DEPRECATED.Empty();
+
+	BuildPointSampleTimes();
+	UpdateSpawnTimesSorted();
+	BuildPointRecords();
+	BuildAliveIntervalIndex();
+	BuildAttributeIndexMap();
+
+	// Point caches imported before the frame table was added need to build it now
+	if ( FrameTimes.Num() <= 0 )
+		BuildFrameTable();
 }
-*/
 
 #if WITH_EDITOR
 void
@@ -957,6 +2768,42 @@ UHoudiniPointCache::PostEditChangeProperty(FPropertyChangedEvent & PropertyChang
 		UseCustomCSVTitleRow = true;
 		UpdateFromFile( FileName );
 	}
+	else if ( PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED( UHoudiniPointCache, TopologyMode )
+		|| PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED( UHoudiniPointCache, ResampleTimeStep ) )
+	{
+		UpdateFromFile( FileName );
+	}
+	else if ( PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED( UHoudiniPointCache, AttributeQuantization ) )
+	{
+		UpdateFromFile( FileName );
+	}
+	else if ( PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED( UHoudiniPointCache, KeyframeReductionTolerance )
+		|| PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED( UHoudiniPointCache, KeyframeReductionAttributeTolerances ) )
+	{
+		UpdateFromFile( FileName );
+	}
+	else if ( PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED( UHoudiniPointCache, bInterleaveVectorAttributes ) )
+	{
+		UpdateFromFile( FileName );
+	}
+	else if ( PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED( UHoudiniPointCache, PositionInterpolation ) )
+	{
+		// The GPU data has already been pushed, only update the interpolation used by the shaders
+		const int32 NewPositionInterpolation = (int32)( UsesHermiteInterpolation( GetAttributeAttributeIndex( EHoudiniAttributes::POSITION ) ) ? EHoudiniPositionInterpolation::Hermite : EHoudiniPositionInterpolation::Linear );
+		FHoudiniPointCacheResource* ThisResource = Resource.Get();
+		ENQUEUE_RENDER_COMMAND(FHoudiniPointCache_UpdatePositionInterpolation) (
+			[ThisResource, NewPositionInterpolation](FRHICommandListImmediate& CmdList)
+		{
+			if (ThisResource)
+				ThisResource->PositionInterpolation = NewPositionInterpolation;
+		}
+		);
+	}
+	else if ( PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED( UHoudiniPointCache, bShareEvaluations )
+		|| PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED( UHoudiniPointCache, SharedEvaluationsMaxMemoryMB ) )
+	{
+		ResetSharedEvaluations();
+	}
 	
 }
 #endif
@@ -971,6 +2818,7 @@ UHoudiniPointCache::GetAssetRegistryTags(TArray< FAssetRegistryTag > & OutTags)
 	OutTags.Add(FAssetRegistryTag("Number of Samples", FString::FromInt(NumberOfSamples), FAssetRegistryTag::TT_Numerical));
 	OutTags.Add(FAssetRegistryTag("Number of Attributes", FString::FromInt(NumberOfAttributes), FAssetRegistryTag::TT_Numerical));
 	OutTags.Add(FAssetRegistryTag("Number of Points", FString::FromInt(NumberOfPoints), FAssetRegistryTag::TT_Numerical));
+	OutTags.Add(FAssetRegistryTag("Keyframe Reduction Ratio", FString::SanitizeFloat(KeyframeReductionRatio), FAssetRegistryTag::TT_Numerical));
 	OutTags.Add(FAssetRegistryTag("Number of Frames (as exported)", FString::FromInt(NumberOfFrames), FAssetRegistryTag::TT_Numerical));
 	OutTags.Add(FAssetRegistryTag("First Frame (as exported)", FString::FromInt(FirstFrame), FAssetRegistryTag::TT_Numerical));
 	OutTags.Add(FAssetRegistryTag("Last Frame (as exported)", FString::FromInt(LastFrame), FAssetRegistryTag::TT_Numerical));
@@ -1034,6 +2882,7 @@ UHoudiniPointCache::GetAssetRegistryTags(TArray< FAssetRegistryTag > & OutTags)
 void UHoudiniPointCache::BeginDestroy()
 {
 	Super::BeginDestroy();
+	ResetSharedEvaluations();
 	FHoudiniPointCacheResource* ThisResource = Resource.Get();
 	ENQUEUE_RENDER_COMMAND(FHoudiniPointCache_ToRT) (
 		[ThisResource](FRHICommandListImmediate& CmdList) mutable
@@ -1046,6 +2895,87 @@ void UHoudiniPointCache::BeginDestroy()
 	);
 }
 
+void UHoudiniPointCache::GetShaderLayout(FHoudiniPointCacheShaderLayout& OutLayout) const
+{
+	OutLayout.SpecialAttributeIndexes.SetNum( EHoudiniAttributes::HOUDINI_ATTR_SIZE );
+	for ( int32 Attr = 0; Attr < EHoudiniAttributes::HOUDINI_ATTR_SIZE; Attr++ )
+		OutLayout.SpecialAttributeIndexes[ Attr ] = GetAttributeAttributeIndex( (EHoudiniAttributes)Attr );
+
+	OutLayout.NumAttributes = GetNumberOfAttributes();
+
+	// The optional buffers are only pushed when their data is valid
+	OutLayout.NumPointAttributes = ( NumberOfPointAttributes > 0 && PointAttributeValues.Num() > 0 && AttributeColumnIndexes.Num() > 0 ) ? NumberOfPointAttributes : 0;
+	OutLayout.NumQuantizedColumns = ( NumberOfQuantizedColumns > 0 && QuantizedSampleData.Num() > 0 && QuantizationParams.Num() > 0 ) ? NumberOfQuantizedColumns : 0;
+	OutLayout.NumIntColumns = ( NumberOfIntColumns > 0 && IntSampleData.Num() > 0 && AttributeIntColumnIndexes.Num() > 0 ) ? NumberOfIntColumns : 0;
+
+	TArray<int32> VectorColumnIndexes;
+	TArray<int32> VectorSourceColumns;
+	OutLayout.NumVectorColumns = GetInterleavedVectorLayout( VectorColumnIndexes, VectorSourceColumns );
+}
+
+int32 UHoudiniPointCache::GetInterleavedVectorLayout(TArray<int32>& OutVectorColumnIndexes, TArray<int32>& OutSourceColumns) const
+{
+	OutVectorColumnIndexes.Empty();
+	OutSourceColumns.Empty();
+	if ( !bInterleaveVectorAttributes || NumberOfAttributes <= 0 || NumberOfSamples <= 0 || FloatSampleData.Num() <= 0 )
+		return 0;
+
+	// Only the components stored per sample in FloatSampleData can be interleaved
+	auto GetFloatColumn = [this]( const int32& attrIndex )
+	{
+		if ( GetAttributeIntColumnIndex( attrIndex ) >= 0 )
+			return (int32)INDEX_NONE;
+
+		if ( QuantizationParams.IsValidIndex( attrIndex * QuantizationParamsStride ) && QuantizationParams[ attrIndex * QuantizationParamsStride ] >= 0.0f )
+			return (int32)INDEX_NONE;
+
+		const int32 Column = GetAttributeColumnIndex( attrIndex );
+		return Column >= 0 ? Column : (int32)INDEX_NONE;
+	};
+
+	const int32 NumAttributes = FMath::Min( NumberOfAttributes, AttributeArray.Num() );
+	OutVectorColumnIndexes.Init( INDEX_NONE, NumberOfAttributes );
+
+	int32 NumRows = 0;
+	int32 attrIndex = 0;
+	while ( attrIndex < NumAttributes )
+	{
+		// The components of a vector attribute are consecutive and share their name's prefix (P.x, P.y, P.z)
+		int32 DotIndex = INDEX_NONE;
+		if ( !AttributeArray[ attrIndex ].FindChar( TEXT( '.' ), DotIndex ) || DotIndex <= 0 )
+		{
+			attrIndex++;
+			continue;
+		}
+
+		const FString Prefix = AttributeArray[ attrIndex ].Left( DotIndex + 1 );
+		int32 NumComponents = 1;
+		while ( attrIndex + NumComponents < NumAttributes && AttributeArray[ attrIndex + NumComponents ].StartsWith( Prefix, ESearchCase::CaseSensitive ) )
+			NumComponents++;
+
+		int32 SourceColumns[ 4 ] = { INDEX_NONE, INDEX_NONE, INDEX_NONE, INDEX_NONE };
+		bool bInterleave = NumComponents == 3 || NumComponents == 4;
+		for ( int32 n = 0; bInterleave && n < NumComponents; n++ )
+		{
+			SourceColumns[ n ] = GetFloatColumn( attrIndex + n );
+			bInterleave = SourceColumns[ n ] >= 0;
+		}
+
+		if ( bInterleave )
+		{
+			OutVectorColumnIndexes[ attrIndex ] = ( NumRows << 1 ) | ( NumComponents == 4 ? 1 : 0 );
+			OutSourceColumns.Append( SourceColumns, 4 );
+			NumRows++;
+		}
+
+		attrIndex += NumComponents;
+	}
+
+	if ( NumRows <= 0 )
+		OutVectorColumnIndexes.Empty();
+
+	return NumRows;
+}
 
 void UHoudiniPointCache::RequestPushToGPU()
 {
@@ -1061,7 +2991,18 @@ void UHoudiniPointCache::RequestPushToGPU()
 	DataToPass->NumSamples = GetNumberOfSamples();
 	DataToPass->NumAttributes = GetNumberOfAttributes();
 	DataToPass->NumPoints = GetNumberOfPoints();
-	DataToPass->MaxNumIndexesPerPoint = GetMaxNumberOfPointValueIndexes() + 1;
+	DataToPass->MaxNumIndexesPerPoint = GetMaxNumberOfPointValueIndexes();
+	DataToPass->NumPointsPerFrame = bHasFixedTopology ? NumberOfPoints : 0;
+	DataToPass->SampleTimeStep = bHasFixedTopology ? 0.0f : UniformSampleTimeStep;
+	DataToPass->PositionInterpolation = (int32)( UsesHermiteInterpolation( GetAttributeAttributeIndex( EHoudiniAttributes::POSITION ) ) ? EHoudiniPositionInterpolation::Hermite : EHoudiniPositionInterpolation::Linear );
+	DataToPass->SpawnTimesSorted = bSpawnTimesSorted ? 1 : 0;
+
+	FHoudiniPointCacheShaderLayout Layout;
+	GetShaderLayout(Layout);
+	DataToPass->NumPointAttributes = 0;
+	DataToPass->NumQuantizedColumns = 0;
+	DataToPass->NumIntColumns = 0;
+	DataToPass->NumVectorColumns = 0;
 
 	{
 		uint32 NumElements = FloatSampleData.Num() ;
@@ -1089,40 +3030,82 @@ void UHoudiniPointCache::RequestPushToGPU()
 	}
 
 	{
-		uint32 NumElements = LifeValues.Num();
-		if (NumElements > 0)
+		// Spawn time, life and type of each point, fetched with a single load by the GPU
+		if (PointRecords.Num() > 0)
 		{
-			DataToPass->LifeValues = (LifeValues);
+			DataToPass->PointRecords = (PointRecords);
 		}
 	}
 
 	{
-		uint32 NumElements =  PointTypes.Num();
-		if (NumElements > 0)
+		// The point / sample index table is already flat, so it can be uploaded as is
+		if (PointSampleIndexOffsets.Num() > 0 && PointSampleIndexes.Num() > 0)
 		{
-			DataToPass->PointTypes = (PointTypes);
+			DataToPass->PointSampleIndexOffsets = (PointSampleIndexOffsets);
+			DataToPass->PointSampleIndexes = (PointSampleIndexes);
 		}
 	}
 
 	{
-		uint32 NumPoints = PointValueIndexes.Num();
-		// Add an extra to the max number so all indexes end by a -1
-		uint32 MaxNumIndexesPerPoint = GetMaxNumberOfPointValueIndexes() + 1;
-		uint32 NumElements = NumPoints * MaxNumIndexesPerPoint;
+		// Only upload a valid frame table
+		if (FrameTimes.Num() > 0 && FrameSampleIndexOffsets.Num() == FrameTimes.Num() + 1)
+		{
+			DataToPass->FrameTimes = (FrameTimes);
+			DataToPass->FrameSampleIndexOffsets = (FrameSampleIndexOffsets);
+		}
+	}
 
-		if (NumElements > 0)
+	{
+		// Attributes that are constant for each point
+		if (Layout.NumPointAttributes > 0)
 		{
-			DataToPass->PointValueIndexes.Init(-1, NumElements);
-			
-			// We need to flatten the nested array for HLSL conversion
-			for (int32 PointID = 0; PointID < PointValueIndexes.Num(); PointID++)
-			{
-				TArray<int32> SampleIndexes = PointValueIndexes[PointID].SampleIndexes;
-				for (int32 Idx = 0; Idx < SampleIndexes.Num(); Idx++)
-				{
-					(DataToPass->PointValueIndexes)[PointID * MaxNumIndexesPerPoint + Idx] = SampleIndexes[Idx];
-				}
-			}
+			DataToPass->PointAttributeValues = (PointAttributeValues);
+			DataToPass->NumPointAttributes = Layout.NumPointAttributes;
+		}
+	}
+
+	{
+		// Quantized attributes
+		if (Layout.NumQuantizedColumns > 0)
+		{
+			DataToPass->QuantizedData = (QuantizedSampleData);
+			DataToPass->QuantizationParams = (QuantizationParams);
+			DataToPass->NumQuantizedColumns = Layout.NumQuantizedColumns;
+		}
+	}
+
+	{
+		// Integer attributes
+		if (Layout.NumIntColumns > 0)
+		{
+			DataToPass->IntData = (IntSampleData);
+			DataToPass->AttributeIntColumnIndexes = (AttributeIntColumnIndexes);
+			DataToPass->NumIntColumns = Layout.NumIntColumns;
+		}
+	}
+
+	{
+		// Alive interval index, used by GetAlivePointsAtTime
+		if (AliveIntervalIndex.Num() > 0)
+		{
+			DataToPass->AliveIntervalIndex = (AliveIntervalIndex);
+		}
+	}
+
+	{
+		// Vector attributes interleaved by InitRHI, one float4 per sample
+		if (Layout.NumVectorColumns > 0)
+		{
+			GetInterleavedVectorLayout(DataToPass->VectorColumnIndexes, DataToPass->VectorSourceColumns);
+			DataToPass->NumVectorColumns = Layout.NumVectorColumns;
+		}
+	}
+
+	{
+		// Column of each attribute, when some attributes are not stored in FloatSampleData
+		if (AttributeColumnIndexes.Num() > 0)
+		{
+			DataToPass->AttributeColumnIndexes = (AttributeColumnIndexes);
 		}
 	}
 
@@ -1131,6 +3114,7 @@ void UHoudiniPointCache::RequestPushToGPU()
 		if (NumAttributes > 0)
 		{
 			DataToPass->Attributes = (AttributeArray);
+			DataToPass->AttributeIndexMap = (AttributeIndexMap);
 		}
 	}
 
@@ -1246,98 +3230,402 @@ void FHoudiniPointCacheResource::InitRHI()
 #endif
 	}
 
-	if (CachedData->LifeValues.Num())
+	if (CachedData->PointRecords.Num())
+	{
+		uint32 NumElements = CachedData->PointRecords.Num();
+
+		PointRecordsGPUBuffer.Release();
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		PointRecordsGPUBuffer.Initialize(RHICmdList, TEXT("HoudiniGPUBufferPointRecords"), sizeof(FHoudiniPointRecord), NumElements, EPixelFormat::PF_A32B32G32R32F, BUF_Static);
+#else
+		PointRecordsGPUBuffer.Initialize(TEXT("HoudiniGPUBufferPointRecords"), sizeof(FHoudiniPointRecord), NumElements, EPixelFormat::PF_A32B32G32R32F, BUF_Static);
+#endif
+
+		uint32 BufferSize = NumElements * sizeof(FHoudiniPointRecord);
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		FHoudiniPointRecord* BufferData = static_cast<FHoudiniPointRecord*>(RHICmdList.LockBuffer(PointRecordsGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+#else
+		FHoudiniPointRecord* BufferData = static_cast<FHoudiniPointRecord*>(RHILockBuffer(PointRecordsGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+#endif
+
+		FPlatformMemory::Memcpy(BufferData, CachedData->PointRecords.GetData(), BufferSize);
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		RHICmdList.UnlockBuffer(PointRecordsGPUBuffer.Buffer);
+#else
+		RHIUnlockBuffer(PointRecordsGPUBuffer.Buffer);
+#endif
+	}
+
+	if (CachedData->PointSampleIndexOffsets.Num())
+	{
+		uint32 NumElements = CachedData->PointSampleIndexOffsets.Num();
+
+		PointSampleIndexOffsetsGPUBuffer.Release();
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		PointSampleIndexOffsetsGPUBuffer.Initialize(RHICmdList, TEXT("HoudiniGPUBufferPointSampleIndexOffsets"), sizeof(int32), NumElements, EPixelFormat::PF_R32_SINT, BUF_Static);
+#else
+		PointSampleIndexOffsetsGPUBuffer.Initialize(TEXT("HoudiniGPUBufferPointSampleIndexOffsets"), sizeof(int32), NumElements, EPixelFormat::PF_R32_SINT, BUF_Static);
+#endif
+
+		uint32 BufferSize = NumElements * sizeof(int32);
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		int32* BufferData = static_cast<int32*>(RHICmdList.LockBuffer(PointSampleIndexOffsetsGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+#else
+		int32* BufferData = static_cast<int32*>(RHILockBuffer(PointSampleIndexOffsetsGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+#endif
+		FPlatformMemory::Memcpy(BufferData, CachedData->PointSampleIndexOffsets.GetData(), BufferSize);
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		RHICmdList.UnlockBuffer(PointSampleIndexOffsetsGPUBuffer.Buffer);
+#else
+		RHIUnlockBuffer(PointSampleIndexOffsetsGPUBuffer.Buffer);
+#endif
+	}
+
+	if (CachedData->PointSampleIndexes.Num())
+	{
+		uint32 NumElements = CachedData->PointSampleIndexes.Num();
+
+		PointSampleIndexesGPUBuffer.Release();
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		PointSampleIndexesGPUBuffer.Initialize(RHICmdList, TEXT("HoudiniGPUBufferPointSampleIndexes"), sizeof(int32), NumElements, EPixelFormat::PF_R32_SINT, BUF_Static);
+#else
+		PointSampleIndexesGPUBuffer.Initialize(TEXT("HoudiniGPUBufferPointSampleIndexes"), sizeof(int32), NumElements, EPixelFormat::PF_R32_SINT, BUF_Static);
+#endif
+
+		uint32 BufferSize = NumElements * sizeof(int32);
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		int32* BufferData = static_cast<int32*>(RHICmdList.LockBuffer(PointSampleIndexesGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+#else
+		int32* BufferData = static_cast<int32*>(RHILockBuffer(PointSampleIndexesGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+#endif
+		FPlatformMemory::Memcpy(BufferData, CachedData->PointSampleIndexes.GetData(), BufferSize);
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		RHICmdList.UnlockBuffer(PointSampleIndexesGPUBuffer.Buffer);
+#else
+		RHIUnlockBuffer(PointSampleIndexesGPUBuffer.Buffer);
+#endif
+	}
+
+	if (CachedData->FrameTimes.Num())
 	{
-		uint32 NumElements = CachedData->LifeValues.Num();
+		uint32 NumElements = CachedData->FrameTimes.Num();
 
-		LifeValuesGPUBuffer.Release();
+		FrameTimesGPUBuffer.Release();
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
-		LifeValuesGPUBuffer.Initialize(RHICmdList, TEXT("HoudiniGPUBufferLifeValues"), sizeof(float), NumElements, EPixelFormat::PF_R32_FLOAT, BUF_Static);
+		FrameTimesGPUBuffer.Initialize(RHICmdList, TEXT("HoudiniGPUBufferFrameTimes"), sizeof(float), NumElements, EPixelFormat::PF_R32_FLOAT, BUF_Static);
 #else
-		LifeValuesGPUBuffer.Initialize(TEXT("HoudiniGPUBufferLifeValues"), sizeof(float), NumElements, EPixelFormat::PF_R32_FLOAT, BUF_Static);
+		FrameTimesGPUBuffer.Initialize(TEXT("HoudiniGPUBufferFrameTimes"), sizeof(float), NumElements, EPixelFormat::PF_R32_FLOAT, BUF_Static);
 #endif
 
 		uint32 BufferSize = NumElements * sizeof(float);
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
-		float* BufferData = static_cast<float*>(RHICmdList.LockBuffer(LifeValuesGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+		float* BufferData = static_cast<float*>(RHICmdList.LockBuffer(FrameTimesGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+#else
+		float* BufferData = static_cast<float*>(RHILockBuffer(FrameTimesGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+#endif
+		FPlatformMemory::Memcpy(BufferData, CachedData->FrameTimes.GetData(), BufferSize);
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		RHICmdList.UnlockBuffer(FrameTimesGPUBuffer.Buffer);
+#else
+		RHIUnlockBuffer(FrameTimesGPUBuffer.Buffer);
+#endif
+	}
+
+	if (CachedData->FrameSampleIndexOffsets.Num())
+	{
+		uint32 NumElements = CachedData->FrameSampleIndexOffsets.Num();
+
+		FrameSampleIndexOffsetsGPUBuffer.Release();
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		FrameSampleIndexOffsetsGPUBuffer.Initialize(RHICmdList, TEXT("HoudiniGPUBufferFrameSampleIndexOffsets"), sizeof(int32), NumElements, EPixelFormat::PF_R32_SINT, BUF_Static);
+#else
+		FrameSampleIndexOffsetsGPUBuffer.Initialize(TEXT("HoudiniGPUBufferFrameSampleIndexOffsets"), sizeof(int32), NumElements, EPixelFormat::PF_R32_SINT, BUF_Static);
+#endif
+
+		uint32 BufferSize = NumElements * sizeof(int32);
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		int32* BufferData = static_cast<int32*>(RHICmdList.LockBuffer(FrameSampleIndexOffsetsGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
 #else
-		float* BufferData = static_cast<float*>(RHILockBuffer(LifeValuesGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+		int32* BufferData = static_cast<int32*>(RHILockBuffer(FrameSampleIndexOffsetsGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
 #endif
+		FPlatformMemory::Memcpy(BufferData, CachedData->FrameSampleIndexOffsets.GetData(), BufferSize);
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		RHICmdList.UnlockBuffer(FrameSampleIndexOffsetsGPUBuffer.Buffer);
+#else
+		RHIUnlockBuffer(FrameSampleIndexOffsetsGPUBuffer.Buffer);
+#endif
+	}
 
-		FPlatformMemory::Memcpy(BufferData, CachedData->LifeValues.GetData(), BufferSize);
+	if (CachedData->PointAttributeValues.Num())
+	{
+		uint32 NumElements = CachedData->PointAttributeValues.Num();
+
+		PointAttributeValuesGPUBuffer.Release();
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		PointAttributeValuesGPUBuffer.Initialize(RHICmdList, TEXT("HoudiniGPUBufferPointAttributeValues"), sizeof(float), NumElements, EPixelFormat::PF_R32_FLOAT, BUF_Static);
+#else
+		PointAttributeValuesGPUBuffer.Initialize(TEXT("HoudiniGPUBufferPointAttributeValues"), sizeof(float), NumElements, EPixelFormat::PF_R32_FLOAT, BUF_Static);
+#endif
 
+		uint32 BufferSize = NumElements * sizeof(float);
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		float* BufferData = static_cast<float*>(RHICmdList.LockBuffer(PointAttributeValuesGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+#else
+		float* BufferData = static_cast<float*>(RHILockBuffer(PointAttributeValuesGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+#endif
+		FPlatformMemory::Memcpy(BufferData, CachedData->PointAttributeValues.GetData(), BufferSize);
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
-		RHICmdList.UnlockBuffer(LifeValuesGPUBuffer.Buffer);
+		RHICmdList.UnlockBuffer(PointAttributeValuesGPUBuffer.Buffer);
 #else
-		RHIUnlockBuffer(LifeValuesGPUBuffer.Buffer);
+		RHIUnlockBuffer(PointAttributeValuesGPUBuffer.Buffer);
 #endif
 	}
 
-	if (CachedData->PointTypes.Num())
+	if (CachedData->AttributeColumnIndexes.Num())
 	{
-		uint32 NumElements = CachedData->PointTypes.Num();
+		uint32 NumElements = CachedData->AttributeColumnIndexes.Num();
 
-		PointTypesGPUBuffer.Release();
+		AttributeColumnIndexesGPUBuffer.Release();
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
-		PointTypesGPUBuffer.Initialize(RHICmdList, TEXT("HoudiniGPUBufferPointTypes"), sizeof(int32), NumElements, EPixelFormat::PF_R32_SINT, BUF_Static);
+		AttributeColumnIndexesGPUBuffer.Initialize(RHICmdList, TEXT("HoudiniGPUBufferAttributeColumnIndexes"), sizeof(int32), NumElements, EPixelFormat::PF_R32_SINT, BUF_Static);
 #else
-		PointTypesGPUBuffer.Initialize(TEXT("HoudiniGPUBufferPointTypes"), sizeof(int32), NumElements, EPixelFormat::PF_R32_SINT, BUF_Static);
+		AttributeColumnIndexesGPUBuffer.Initialize(TEXT("HoudiniGPUBufferAttributeColumnIndexes"), sizeof(int32), NumElements, EPixelFormat::PF_R32_SINT, BUF_Static);
 #endif
 
 		uint32 BufferSize = NumElements * sizeof(int32);
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
-		int32* BufferData = static_cast<int32*>(RHICmdList.LockBuffer(PointTypesGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+		int32* BufferData = static_cast<int32*>(RHICmdList.LockBuffer(AttributeColumnIndexesGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+#else
+		int32* BufferData = static_cast<int32*>(RHILockBuffer(AttributeColumnIndexesGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+#endif
+		FPlatformMemory::Memcpy(BufferData, CachedData->AttributeColumnIndexes.GetData(), BufferSize);
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		RHICmdList.UnlockBuffer(AttributeColumnIndexesGPUBuffer.Buffer);
 #else
-		int32* BufferData = static_cast<int32*>(RHILockBuffer(PointTypesGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+		RHIUnlockBuffer(AttributeColumnIndexesGPUBuffer.Buffer);
 #endif
+	}
+
+	if (CachedData->IntData.Num())
+	{
+		uint32 NumElements = CachedData->IntData.Num();
 
-		FPlatformMemory::Memcpy(BufferData, CachedData->PointTypes.GetData(), BufferSize);
+		IntValuesGPUBuffer.Release();
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		IntValuesGPUBuffer.Initialize(RHICmdList, TEXT("HoudiniGPUBufferIntValues"), sizeof(int32), NumElements, EPixelFormat::PF_R32_SINT, BUF_Static);
+#else
+		IntValuesGPUBuffer.Initialize(TEXT("HoudiniGPUBufferIntValues"), sizeof(int32), NumElements, EPixelFormat::PF_R32_SINT, BUF_Static);
+#endif
 
+		uint32 BufferSize = NumElements * sizeof(int32);
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		int32* BufferData = static_cast<int32*>(RHICmdList.LockBuffer(IntValuesGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+#else
+		int32* BufferData = static_cast<int32*>(RHILockBuffer(IntValuesGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+#endif
+		FPlatformMemory::Memcpy(BufferData, CachedData->IntData.GetData(), BufferSize);
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
-		RHICmdList.UnlockBuffer(PointTypesGPUBuffer.Buffer);
+		RHICmdList.UnlockBuffer(IntValuesGPUBuffer.Buffer);
 #else
-		RHIUnlockBuffer(PointTypesGPUBuffer.Buffer);
+		RHIUnlockBuffer(IntValuesGPUBuffer.Buffer);
 #endif
 	}
 
-	if (CachedData->PointValueIndexes.Num())
+	if (CachedData->AttributeIntColumnIndexes.Num())
 	{
-		uint32 NumElements = CachedData->PointValueIndexes.Num();
+		uint32 NumElements = CachedData->AttributeIntColumnIndexes.Num();
 
-		PointValueIndexesGPUBuffer.Release();
+		AttributeIntColumnIndexesGPUBuffer.Release();
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
-		PointValueIndexesGPUBuffer.Initialize(RHICmdList, TEXT("HoudiniGPUBufferPointValuesIndexes"), sizeof(int32), NumElements, EPixelFormat::PF_R32_SINT, BUF_Static);
+		AttributeIntColumnIndexesGPUBuffer.Initialize(RHICmdList, TEXT("HoudiniGPUBufferAttributeIntColumnIndexes"), sizeof(int32), NumElements, EPixelFormat::PF_R32_SINT, BUF_Static);
 #else
-		PointValueIndexesGPUBuffer.Initialize(TEXT("HoudiniGPUBufferPointValuesIndexes"), sizeof(int32), NumElements, EPixelFormat::PF_R32_SINT, BUF_Static);
+		AttributeIntColumnIndexesGPUBuffer.Initialize(TEXT("HoudiniGPUBufferAttributeIntColumnIndexes"), sizeof(int32), NumElements, EPixelFormat::PF_R32_SINT, BUF_Static);
 #endif
 
 		uint32 BufferSize = NumElements * sizeof(int32);
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
-		int32* BufferData = static_cast<int32*>(RHICmdList.LockBuffer(PointValueIndexesGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+		int32* BufferData = static_cast<int32*>(RHICmdList.LockBuffer(AttributeIntColumnIndexesGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+#else
+		int32* BufferData = static_cast<int32*>(RHILockBuffer(AttributeIntColumnIndexesGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+#endif
+		FPlatformMemory::Memcpy(BufferData, CachedData->AttributeIntColumnIndexes.GetData(), BufferSize);
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		RHICmdList.UnlockBuffer(AttributeIntColumnIndexesGPUBuffer.Buffer);
+#else
+		RHIUnlockBuffer(AttributeIntColumnIndexesGPUBuffer.Buffer);
+#endif
+	}
+
+	if (CachedData->AliveIntervalIndex.Num())
+	{
+		uint32 NumElements = CachedData->AliveIntervalIndex.Num();
+
+		AliveIntervalIndexGPUBuffer.Release();
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		AliveIntervalIndexGPUBuffer.Initialize(RHICmdList, TEXT("HoudiniGPUBufferAliveIntervalIndex"), sizeof(float), NumElements, EPixelFormat::PF_R32_FLOAT, BUF_Static);
+#else
+		AliveIntervalIndexGPUBuffer.Initialize(TEXT("HoudiniGPUBufferAliveIntervalIndex"), sizeof(float), NumElements, EPixelFormat::PF_R32_FLOAT, BUF_Static);
+#endif
+
+		uint32 BufferSize = NumElements * sizeof(float);
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		float* BufferData = static_cast<float*>(RHICmdList.LockBuffer(AliveIntervalIndexGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+#else
+		float* BufferData = static_cast<float*>(RHILockBuffer(AliveIntervalIndexGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+#endif
+
+		FPlatformMemory::Memcpy(BufferData, CachedData->AliveIntervalIndex.GetData(), BufferSize);
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		RHICmdList.UnlockBuffer(AliveIntervalIndexGPUBuffer.Buffer);
+#else
+		RHIUnlockBuffer(AliveIntervalIndexGPUBuffer.Buffer);
+#endif
+	}
+
+	if (CachedData->NumVectorColumns > 0 && CachedData->VectorColumnIndexes.Num() && CachedData->FloatData.Num())
+	{
+		// Interleave the components of the vector attributes, the record of sample S of row R is S + R * NumSamples
+		const int32 NumRows = CachedData->NumVectorColumns;
+		const int32 NumVectorSamples = CachedData->NumSamples;
+		uint32 NumElements = NumRows * NumVectorSamples;
+
+		VectorValuesGPUBuffer.Release();
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		VectorValuesGPUBuffer.Initialize(RHICmdList, TEXT("HoudiniGPUBufferVectorValues"), sizeof(float) * 4, NumElements, EPixelFormat::PF_A32B32G32R32F, BUF_Static);
+#else
+		VectorValuesGPUBuffer.Initialize(TEXT("HoudiniGPUBufferVectorValues"), sizeof(float) * 4, NumElements, EPixelFormat::PF_A32B32G32R32F, BUF_Static);
+#endif
+
+		uint32 BufferSize = NumElements * sizeof(float) * 4;
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		float* BufferData = static_cast<float*>(RHICmdList.LockBuffer(VectorValuesGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+#else
+		float* BufferData = static_cast<float*>(RHILockBuffer(VectorValuesGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+#endif
+
+		const TArray<float>& FloatData = CachedData->FloatData;
+		const TArray<int32>& SourceColumns = CachedData->VectorSourceColumns;
+		for (int32 Row = 0; Row < NumRows; Row++)
+		{
+			for (int32 Sample = 0; Sample < NumVectorSamples; Sample++)
+			{
+				float* Record = BufferData + (Sample + Row * NumVectorSamples) * 4;
+				for (int32 n = 0; n < 4; n++)
+				{
+					const int32 Column = SourceColumns.IsValidIndex(Row * 4 + n) ? SourceColumns[Row * 4 + n] : INDEX_NONE;
+					const int32 Index = Sample + Column * NumVectorSamples;
+					Record[n] = (Column >= 0 && FloatData.IsValidIndex(Index)) ? FloatData[Index] : 0.0f;
+				}
+			}
+		}
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		RHICmdList.UnlockBuffer(VectorValuesGPUBuffer.Buffer);
+#else
+		RHIUnlockBuffer(VectorValuesGPUBuffer.Buffer);
+#endif
+
+		NumElements = CachedData->VectorColumnIndexes.Num();
+
+		VectorColumnIndexesGPUBuffer.Release();
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		VectorColumnIndexesGPUBuffer.Initialize(RHICmdList, TEXT("HoudiniGPUBufferVectorColumnIndexes"), sizeof(int32), NumElements, EPixelFormat::PF_R32_SINT, BUF_Static);
+#else
+		VectorColumnIndexesGPUBuffer.Initialize(TEXT("HoudiniGPUBufferVectorColumnIndexes"), sizeof(int32), NumElements, EPixelFormat::PF_R32_SINT, BUF_Static);
+#endif
+
+		BufferSize = NumElements * sizeof(int32);
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		int32* IndexBufferData = static_cast<int32*>(RHICmdList.LockBuffer(VectorColumnIndexesGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+#else
+		int32* IndexBufferData = static_cast<int32*>(RHILockBuffer(VectorColumnIndexesGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+#endif
+
+		FPlatformMemory::Memcpy(IndexBufferData, CachedData->VectorColumnIndexes.GetData(), BufferSize);
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		RHICmdList.UnlockBuffer(VectorColumnIndexesGPUBuffer.Buffer);
+#else
+		RHIUnlockBuffer(VectorColumnIndexesGPUBuffer.Buffer);
+#endif
+	}
+
+	if (CachedData->QuantizedData.Num())
+	{
+		uint32 NumElements = CachedData->QuantizedData.Num();
+
+		QuantizedValuesGPUBuffer.Release();
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		QuantizedValuesGPUBuffer.Initialize(RHICmdList, TEXT("HoudiniGPUBufferQuantizedValues"), sizeof(uint16), NumElements, EPixelFormat::PF_R16_UINT, BUF_Static);
+#else
+		QuantizedValuesGPUBuffer.Initialize(TEXT("HoudiniGPUBufferQuantizedValues"), sizeof(uint16), NumElements, EPixelFormat::PF_R16_UINT, BUF_Static);
+#endif
+
+		uint32 BufferSize = NumElements * sizeof(uint16);
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		uint16* BufferData = static_cast<uint16*>(RHICmdList.LockBuffer(QuantizedValuesGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+#else
+		uint16* BufferData = static_cast<uint16*>(RHILockBuffer(QuantizedValuesGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+#endif
+		FPlatformMemory::Memcpy(BufferData, CachedData->QuantizedData.GetData(), BufferSize);
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		RHICmdList.UnlockBuffer(QuantizedValuesGPUBuffer.Buffer);
+#else
+		RHIUnlockBuffer(QuantizedValuesGPUBuffer.Buffer);
+#endif
+	}
+
+	if (CachedData->QuantizationParams.Num())
+	{
+		uint32 NumElements = CachedData->QuantizationParams.Num();
+
+		QuantizationParamsGPUBuffer.Release();
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		QuantizationParamsGPUBuffer.Initialize(RHICmdList, TEXT("HoudiniGPUBufferQuantizationParams"), sizeof(float), NumElements, EPixelFormat::PF_R32_FLOAT, BUF_Static);
+#else
+		QuantizationParamsGPUBuffer.Initialize(TEXT("HoudiniGPUBufferQuantizationParams"), sizeof(float), NumElements, EPixelFormat::PF_R32_FLOAT, BUF_Static);
+#endif
+
+		uint32 BufferSize = NumElements * sizeof(float);
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		float* BufferData = static_cast<float*>(RHICmdList.LockBuffer(QuantizationParamsGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
 #else
-		int32* BufferData = static_cast<int32*>(RHILockBuffer(PointValueIndexesGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+		float* BufferData = static_cast<float*>(RHILockBuffer(QuantizationParamsGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
 #endif
-		FPlatformMemory::Memcpy(BufferData, CachedData->PointValueIndexes.GetData(), BufferSize);
+		FPlatformMemory::Memcpy(BufferData, CachedData->QuantizationParams.GetData(), BufferSize);
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
-		RHICmdList.UnlockBuffer(PointValueIndexesGPUBuffer.Buffer);
+		RHICmdList.UnlockBuffer(QuantizationParamsGPUBuffer.Buffer);
 #else
-		RHIUnlockBuffer(PointValueIndexesGPUBuffer.Buffer);
+		RHIUnlockBuffer(QuantizationParamsGPUBuffer.Buffer);
 #endif
 	}
 
 	if (CachedData->Attributes.Num())
 	{
 		Attributes = (CachedData->Attributes);
+		AttributeIndexMap = (CachedData->AttributeIndexMap);
 	}
 	else
 	{
 		Attributes.Empty();
+		AttributeIndexMap.Empty();
 	}
 
 	NumSamples = CachedData->NumSamples;
 	NumAttributes = CachedData->NumAttributes;
 	NumPoints = CachedData->NumPoints;
 	MaxNumberOfIndexesPerPoint = CachedData->MaxNumIndexesPerPoint;
+	NumFrames = CachedData->FrameTimes.Num();
+	NumPointsPerFrame = NumFrames > 0 ? CachedData->NumPointsPerFrame : 0;
+	SampleTimeStep = CachedData->PointSampleIndexes.Num() > 0 ? CachedData->SampleTimeStep : 0.0f;
+	PositionInterpolation = CachedData->PositionInterpolation;
+	SpawnTimesSorted = CachedData->SpawnTimes.Num() > 0 ? CachedData->SpawnTimesSorted : 0;
+	NumPointAttributes = CachedData->NumPointAttributes;
+	NumQuantizedColumns = CachedData->NumQuantizedColumns;
+	NumIntColumns = CachedData->NumIntColumns;
+	NumVectorColumns = CachedData->VectorColumnIndexes.Num() > 0 && CachedData->FloatData.Num() > 0 ? CachedData->NumVectorColumns : 0;
 
 	CachedData.Reset();
 }
@@ -1347,8 +3635,19 @@ void FHoudiniPointCacheResource::ReleaseRHI()
 	FloatValuesGPUBuffer.Release();
 	SpecialAttributeIndexesGPUBuffer.Release();
 	SpawnTimesGPUBuffer.Release();
-	LifeValuesGPUBuffer.Release();
-	PointTypesGPUBuffer.Release();
-	PointValueIndexesGPUBuffer.Release();
+	PointRecordsGPUBuffer.Release();
+	PointSampleIndexOffsetsGPUBuffer.Release();
+	PointSampleIndexesGPUBuffer.Release();
+	FrameTimesGPUBuffer.Release();
+	FrameSampleIndexOffsetsGPUBuffer.Release();
+	PointAttributeValuesGPUBuffer.Release();
+	AttributeColumnIndexesGPUBuffer.Release();
+	QuantizedValuesGPUBuffer.Release();
+	QuantizationParamsGPUBuffer.Release();
+	IntValuesGPUBuffer.Release();
+	AttributeIntColumnIndexesGPUBuffer.Release();
+	AliveIntervalIndexGPUBuffer.Release();
+	VectorColumnIndexesGPUBuffer.Release();
+	VectorValuesGPUBuffer.Release();
 }	
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
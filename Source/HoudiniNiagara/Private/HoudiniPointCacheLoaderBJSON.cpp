@@ -117,7 +117,7 @@ bool FHoudiniPointCacheLoaderBJSON::LoadToAsset(UHoudiniPointCache *InAsset)
 	// we expect that the point IDs start at zero, and increment as the points are spawned
 	// Make sure this is the case by converting the point IDs as we read them
 	int32 NextPointID = 0;
-	TMap<int32, int32> HoudiniIDToNiagaraIDMap;
+	TMap<int64, int32> HoudiniIDToNiagaraIDMap;
 
     // Expect cache_data key, object start, frames key
     if (!ReadNonContainerValue(ObjectKey, false, MarkerTypeString) || ObjectKey != TEXT("cache_data"))
@@ -136,7 +136,7 @@ bool FHoudiniPointCacheLoaderBJSON::LoadToAsset(UHoudiniPointCache *InAsset)
 
     uint32 NumFramesRead = 0;
     uint32 FrameStartSampleIndex = 0;
-    TArray<TArray<float>> TempFrameData;
+    TArray<TArray<double>> TempFrameData;
     while (!Reader->AtEnd() && !IsNext(MarkerArrayEnd))
     {
         // Expect object start
@@ -175,7 +175,7 @@ bool FHoudiniPointCacheLoaderBJSON::LoadToAsset(UHoudiniPointCache *InAsset)
 
         // Ensure we have enough space in our FrameData array to read the samples for this frame
         TempFrameData.SetNum(NumPointsInFrame);
-        float PreviousAge = 0.0f;
+        double PreviousAge = 0.0;
         bool bNeedToSort = false;
         for (uint32 SampleIndex = 0; SampleIndex < NumPointsInFrame; ++SampleIndex)
         {
@@ -188,7 +188,7 @@ bool FHoudiniPointCacheLoaderBJSON::LoadToAsset(UHoudiniPointCache *InAsset)
 
             for (uint32 AttrIndex = 0; AttrIndex < NumAttributesPerFileSample; ++AttrIndex)
             {
-                float& Value = TempFrameData[SampleIndex][AttrIndex];
+                double& Value = TempFrameData[SampleIndex][AttrIndex];
                 // Read a value
                 if (!ReadNonContainerValue(Value, false, Header.AttributeComponentDataTypes[AttrIndex]))
                     return false;
@@ -249,6 +249,20 @@ bool FHoudiniPointCacheLoaderBJSON::LoadToAsset(UHoudiniPointCache *InAsset)
     if (!ReadMarker(Marker) || Marker != MarkerObjectEnd)
         return false;
 
+    // Now that all the frames have been processed, build the sample indexes for each point
+    InAsset->BuildPointSampleIndexes();
+    InAsset->ReduceKeyframes();
+    InAsset->ResampleUniformly();
+    InAsset->BuildFrameTable();
+    InAsset->UpdateSpawnTimesSorted();
+    InAsset->BuildPointRecords();
+    InAsset->BuildAliveIntervalIndex();
+    InAsset->BuildFixedTopology();
+    InAsset->HoistPointAttributes();
+    InAsset->QuantizeAttributes();
+    InAsset->CompactIntAttributes();
+    InAsset->BuildAttributeIndexMap();
+
     // We have finished ingesting the data.
     // Finalize data loading by compressing raw data.
     CompressRawData(InAsset);
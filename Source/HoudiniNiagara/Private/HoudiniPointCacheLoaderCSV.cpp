@@ -84,7 +84,6 @@ bool FHoudiniPointCacheLoaderCSV::UpdateFromStringArray(UHoudiniPointCache *InAs
     TArray<float> &LifeValues = InAsset->GetLifeValues();
     TArray<int32> &PointTypes = InAsset->GetPointTypes();
     TArray<int32> &SpecialAttributeIndexes = InAsset->GetSpecialAttributeIndexes();
-    TArray<FPointIndexes> &PointValueIndexes = InAsset->GetPointValueIndexes();
 
 	// Reset the column indexes of the special attributes
 	SpecialAttributeIndexes.Init( INDEX_NONE, EHoudiniAttributes::HOUDINI_ATTR_SIZE );
@@ -207,6 +206,9 @@ bool FHoudiniPointCacheLoaderCSV::UpdateFromStringArray(UHoudiniPointCache *InAs
 	}
 
     // Initialize our different buffers
+    InAsset->ResetPointAttributes();
+    InAsset->ResetQuantizedAttributes();
+    InAsset->ResetIntAttributes();
     FloatSampleData.Empty();
     FloatSampleData.SetNumZeroed( InAsset->NumberOfSamples * InAsset->NumberOfAttributes );
 
@@ -225,9 +227,6 @@ bool FHoudiniPointCacheLoaderCSV::UpdateFromStringArray(UHoudiniPointCache *InAs
 	//float lastTimeValue = 0.0;
 	//TimeValuesIndexes.Empty();
 
-	// And the row indexes for each point
-	PointValueIndexes.Empty();
-
     // Extract all the values from the table to the float & string buffers
     TArray<FString> CurrentParsedRow;
     for ( int rowIdx = 0; rowIdx < ParsedStringArrays.Num(); rowIdx++ )
@@ -267,36 +266,28 @@ bool FHoudiniPointCacheLoaderCSV::UpdateFromStringArray(UHoudiniPointCache *InAs
 				{
 					// We found a new point, so we add it to the ID map
 					HoudiniIDToNiagaraIDMap.Add( PointID, NextPointID++ );
-
-					// Add a new array for that point's indexes
-					PointValueIndexes.Add( FPointIndexes() );
 				}
 
 				// Get the Niagara ID from the Houdini ID
 				CurrentID = HoudiniIDToNiagaraIDMap[ PointID ];
 				FloatValue = (float)CurrentID;
-
-				// Add the current row to this point's row index list
-				PointValueIndexes[ CurrentID ].SampleIndexes.Add( rowIdx );
 			}
 
 			// Store the Value in the buffer
 			FloatSampleData[ rowIdx + ( colIdx * InAsset->NumberOfSamples ) ] = FloatValue;
 		}
-
-		// If we dont have Point ID informations, we still want to fill the PointValueIndexes array
-		if ( !InAsset->IsValidAttributeAttributeIndex( EHoudiniAttributes::POINTID ) )
-		{
-			// Each row is considered its own point
-			PointValueIndexes.Add(FPointIndexes());
-			PointValueIndexes[ rowIdx ].SampleIndexes.Add( rowIdx );
-		}
     }
 	
 	InAsset->NumberOfPoints = HoudiniIDToNiagaraIDMap.Num();
 	if ( InAsset->NumberOfPoints <= 0 )
 		InAsset->NumberOfPoints = InAsset->NumberOfSamples;
 
+	// Build the row indexes for each point
+	InAsset->BuildPointSampleIndexes();
+	InAsset->ReduceKeyframes();
+	InAsset->ResampleUniformly();
+	InAsset->BuildFrameTable();
+
 	// Look for point specific attributes to build some helper arrays
 	int32 LifeAttributeIndex = InAsset->GetAttributeAttributeIndex(EHoudiniAttributes::LIFE);
 	//int32 AgeAttributeIndex = InAsset->GetAttributeAttributeIndex(EHoudiniAttributes::AGE);
@@ -374,6 +365,16 @@ bool FHoudiniPointCacheLoaderCSV::UpdateFromStringArray(UHoudiniPointCache *InAs
 		}
 
 	}
+
+	InAsset->UpdateSpawnTimesSorted();
+	InAsset->BuildPointRecords();
+	InAsset->BuildAliveIntervalIndex();
+	InAsset->BuildFixedTopology();
+	InAsset->HoistPointAttributes();
+	InAsset->QuantizeAttributes();
+	InAsset->CompactIntAttributes();
+	InAsset->BuildAttributeIndexMap();
+
     return true;
 }
 #endif
@@ -88,7 +88,7 @@ bool FHoudiniPointCacheLoaderJSON::LoadToAsset(UHoudiniPointCache *InAsset)
 	// we expect that the point IDs start at zero, and increment as the points are spawned
 	// Make sure this is the case by converting the point IDs as we read them
 	int32 NextPointID = 0;
-	TMap<int32, int32> HoudiniIDToNiagaraIDMap;
+	TMap<int64, int32> HoudiniIDToNiagaraIDMap;
 
     // Expect cache_data key, object start, frames key
     const TSharedPtr<FJsonObject> &CacheDataObject = PointCacheObject->GetObjectField("cache_data");
@@ -104,7 +104,7 @@ bool FHoudiniPointCacheLoaderJSON::LoadToAsset(UHoudiniPointCache *InAsset)
     }
     
     uint32 FrameStartSampleIndex = 0;
-    TArray<TArray<float>> TempFrameData;
+    TArray<TArray<double>> TempFrameData;
     for (const TSharedPtr<FJsonValue> &FrameEntryAsValue : Frames)
     {
         const TSharedPtr<FJsonObject> &FrameEntryObject = FrameEntryAsValue->AsObject();
@@ -119,7 +119,7 @@ bool FHoudiniPointCacheLoaderJSON::LoadToAsset(UHoudiniPointCache *InAsset)
 
         // Ensure we have enough space in our FrameData array to read the samples for this frame
         TempFrameData.SetNum(NumPointsInFrame);
-        float PreviousAge = 0.0f;
+        double PreviousAge = 0.0;
         bool bNeedToSort = false;
         uint32 SampleIndex = 0;
         for (const TSharedPtr<FJsonValue> &SampleAsValue : FrameData)
@@ -141,7 +141,7 @@ bool FHoudiniPointCacheLoaderJSON::LoadToAsset(UHoudiniPointCache *InAsset)
                     return false;
                 }
 
-                float& Value = TempFrameData[SampleIndex][AttrIndex];
+                double& Value = TempFrameData[SampleIndex][AttrIndex];
                 Value = AttrEntryAsValue->AsNumber();
 
                 if (AgeAttributeIndex != INDEX_NONE && AttrIndex == AgeAttributeIndex)
@@ -172,6 +172,20 @@ bool FHoudiniPointCacheLoaderJSON::LoadToAsset(UHoudiniPointCache *InAsset)
         FrameStartSampleIndex += NumPointsInFrame;
     }
 
+    // Now that all the frames have been processed, build the sample indexes for each point
+    InAsset->BuildPointSampleIndexes();
+    InAsset->ReduceKeyframes();
+    InAsset->ResampleUniformly();
+    InAsset->BuildFrameTable();
+    InAsset->UpdateSpawnTimesSorted();
+    InAsset->BuildPointRecords();
+    InAsset->BuildAliveIntervalIndex();
+    InAsset->BuildFixedTopology();
+    InAsset->HoistPointAttributes();
+    InAsset->QuantizeAttributes();
+    InAsset->CompactIntAttributes();
+    InAsset->BuildAttributeIndexMap();
+
     // Load uncompressed raw data into asset.
     // TODO: Rebuild JSON string from this buffer to avoid loading data twice. 
 	if (!LoadRawPointCacheData(InAsset, *GetFilePath()))
@@ -169,7 +169,6 @@ bool FHoudiniPointCacheLoaderJSONBase::ParseAttributesAndInitAsset(UHoudiniPoint
     TArray<float> &SpawnTimes = InAsset->GetSpawnTimes();
     TArray<float> &LifeValues = InAsset->GetLifeValues();
     TArray<int32> &PointTypes = InAsset->GetPointTypes();
-    TArray<FPointIndexes> &PointValueIndexes = InAsset->GetPointValueIndexes();
 
     // Pre-allocate arrays in the point cache asset based off of the header
     InAsset->NumberOfPoints = InHeader.NumPoints;
@@ -180,29 +179,65 @@ bool FHoudiniPointCacheLoaderJSONBase::ParseAttributesAndInitAsset(UHoudiniPoint
     InAsset->MinSampleTime = FLT_MAX;
     InAsset->MaxSampleTime = -FLT_MAX;
 
+    InAsset->ResetPointAttributes();
+    InAsset->ResetQuantizedAttributes();
     FloatSampleData.Empty(InAsset->NumberOfSamples * InAsset->NumberOfAttributes);
     FloatSampleData.Init(-FLT_MAX, InAsset->NumberOfSamples * InAsset->NumberOfAttributes);
+
+    // Integer attributes are also stored in their own columns, without going through floats.
+    // Point ids are remapped to Niagara ids and stay float, time values always come from the frame.
+    TArray<bool> IsIntAttribute;
+    IsIntAttribute.Init(false, InAsset->NumberOfAttributes);
+    for (int32 ComponentIndex = 0; ComponentIndex < InHeader.AttributeComponentDataTypes.Num() && ComponentIndex < InAsset->NumberOfAttributes; ++ComponentIndex)
+    {
+        if (ComponentIndex == SpecialAttributeIndexes[EHoudiniAttributes::POINTID] || ComponentIndex == SpecialAttributeIndexes[EHoudiniAttributes::TIME])
+            continue;
+
+        IsIntAttribute[ComponentIndex] = IsIntegerDataType(InHeader.AttributeComponentDataTypes[ComponentIndex]);
+    }
+    InAsset->InitIntAttributes(IsIntAttribute);
     SpawnTimes.Empty(InAsset->NumberOfPoints);
     SpawnTimes.Init(-FLT_MAX, InAsset->NumberOfPoints);
     LifeValues.Empty(InAsset->NumberOfPoints);
     LifeValues.Init(-FLT_MAX, InAsset->NumberOfPoints);
     PointTypes.Empty(InAsset->NumberOfPoints);
     PointTypes.Init(-1, InAsset->NumberOfPoints);
-    PointValueIndexes.Empty(InAsset->NumberOfPoints);
-    PointValueIndexes.Init(FPointIndexes(), InAsset->NumberOfPoints);
+    // The point / sample index table is built once all the frames have been processed
+    InAsset->GetPointSampleIndexOffsets().Empty();
+    InAsset->GetPointSampleIndexes().Empty();
 
 	return true;
 }
 
 
-bool FHoudiniPointCacheLoaderJSONBase::ProcessFrame(UHoudiniPointCache *InAsset, float InFrameNumber, const TArray<TArray<float>> &InFrameData, float InFrameTime, uint32 InFrameStartSampleIndex, uint32 InNumPointsInFrame, uint32 InNumAttributesPerPoint, const FHoudiniPointCacheJSONHeader &InHeader, TMap<int32, int32>& InHoudiniIDToNiagaraIDMap, int32 &OutNextPointID) const
+bool FHoudiniPointCacheLoaderJSONBase::IsIntegerDataType(unsigned char InDataType)
+{
+    switch (InDataType)
+    {
+        case 'b':
+        case 'B':
+        case '?':
+        case 'h':
+        case 'H':
+        case 'l':
+        case 'L':
+        case 'q':
+        case 'Q':
+            return true;
+        default:
+            return false;
+    }
+}
+
+
+bool FHoudiniPointCacheLoaderJSONBase::ProcessFrame(UHoudiniPointCache *InAsset, float InFrameNumber, const TArray<TArray<double>> &InFrameData, float InFrameTime, uint32 InFrameStartSampleIndex, uint32 InNumPointsInFrame, uint32 InNumAttributesPerPoint, const FHoudiniPointCacheJSONHeader &InHeader, TMap<int64, int32>& InHoudiniIDToNiagaraIDMap, int32 &OutNextPointID) const
 {
     // Get references to the various data arrays of the asset
     TArray<float> &FloatSampleData = InAsset->GetFloatSampleData();
+    TArray<int32> &IntSampleData = InAsset->GetIntSampleData();
     TArray<float> &SpawnTimes = InAsset->GetSpawnTimes();
     TArray<float> &LifeValues = InAsset->GetLifeValues();
     TArray<int32> &PointTypes = InAsset->GetPointTypes();
-    TArray<FPointIndexes> &PointValueIndexes = InAsset->GetPointValueIndexes();
 
     // Set Min/Max Time seen in asset
     if (InFrameTime < InAsset->MinSampleTime)
@@ -249,24 +284,30 @@ bool FHoudiniPointCacheLoaderJSONBase::ProcessFrame(UHoudiniPointCache *InAsset,
         }
         for (uint32 AttrIndex = 0; AttrIndex < InNumAttributesPerPoint; ++AttrIndex)
         {
-            // Get the float value for the attribute
-            float FloatValue = InFrameData[FrameSampleIndex][AttrIndex];
+            // Get the value for the attribute
+            const double Value = InFrameData[FrameSampleIndex][AttrIndex];
+            float FloatValue = static_cast<float>(Value);
+
+            // Integer attributes are stored without conversion to float
+            const int32 IntColumn = InAsset->GetAttributeIntColumnIndex(AttrIndex);
+            if (IntColumn >= 0)
+            {
+                IntSampleData[SampleIndex + (IntColumn * InAsset->NumberOfSamples)] = static_cast<int32>(Value);
+            }
 
             // Handle point IDs here
             if (AttrIndex == IDAttributeIndex)
             {
                 // If the point ID doesn't exist in the Houdini/Niagara mapping, create a new a entry.
                 // Otherwise, replace the point ID with the Niagara ID.
-                int32 PointID = FMath::FloorToInt(FloatValue);
+                // The ID is read from the double value, so large ids don't collide.
+                int64 PointID = static_cast<int64>(FMath::FloorToDouble(Value));
 
                 // The point ID may need to be replaced
                 if (!InHoudiniIDToNiagaraIDMap.Contains(PointID))
                 {
                     // We found a new point, so we add it to the ID map
                     InHoudiniIDToNiagaraIDMap.Add(PointID, OutNextPointID++);
-
-                    // // Add a new array for that point's indexes
-                    // PointValueIndexes.Add(FPointIndexes());
                 }
 
                 // Get the Niagara ID from the Houdini ID
@@ -281,9 +322,6 @@ bool FHoudiniPointCacheLoaderJSONBase::ProcessFrame(UHoudiniPointCache *InAsset,
                 }
 
                 FloatValue = static_cast<float>(CurrentID);
-
-                // Add the current sample index to this point's sample index list
-                PointValueIndexes[CurrentID].SampleIndexes.Add(SampleIndex);
             }
 
             // Store the Value in the buffer
@@ -296,14 +334,6 @@ bool FHoudiniPointCacheLoaderJSONBase::ProcessFrame(UHoudiniPointCache *InAsset,
             FloatSampleData[SampleIndex + (TimeAttributeIndex * InAsset->NumberOfSamples)] = InFrameTime;
         }
 
-        // If we dont have Point ID information, we still want to fill the PointValueIndexes array
-        if (IDAttributeIndex == INDEX_NONE)
-        {
-            // Each sample is considered its own point
-            // PointValueIndexes.Add(FPointIndexes());
-            PointValueIndexes[SampleIndex].SampleIndexes.Add(SampleIndex);
-        }
-
         // Calculate SpawnTimes, LifeValues and PointTypes
         // Get the reconstructed point id
         if (IDAttributeIndex != INDEX_NONE)
@@ -359,7 +389,10 @@ bool FHoudiniPointCacheLoaderJSONBase::ProcessFrame(UHoudiniPointCache *InAsset,
         if (PointTypes[CurrentID] < 0)
         {
             float CurrentType = 0.0f;
-            if (TypeAttributeIndex != INDEX_NONE)
+            const int32 TypeIntColumn = InAsset->GetAttributeIntColumnIndex(TypeAttributeIndex);
+            if (TypeIntColumn >= 0)
+                CurrentType = IntSampleData[SampleIndex + (TypeIntColumn * InAsset->NumberOfSamples)];
+            else if (TypeAttributeIndex != INDEX_NONE)
                 CurrentType = FloatSampleData[SampleIndex + (TypeAttributeIndex * InAsset->NumberOfSamples)];
 
             PointTypes[CurrentID] = static_cast<int32>(CurrentType);
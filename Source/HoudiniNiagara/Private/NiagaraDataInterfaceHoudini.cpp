@@ -26,18 +26,112 @@
 #include "HoudiniPointCache.h"
 
 #include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
 #include "HAL/PlatformProcess.h"
 #include "Misc/CoreMiscDefines.h"
 #include "Misc/EngineVersionComparison.h"
 #include "Misc/Paths.h"
+#include "NiagaraComponent.h"
 #include "NiagaraRenderer.h"
 #include "NiagaraShader.h"
+#include "NiagaraSystem.h"
+#include "NiagaraSystemInstance.h"
 #include "NiagaraTypes.h"
 #include "ShaderCompiler.h"
 #include "ShaderParameterUtils.h"
+#include "UObject/UObjectIterator.h"
 
 #define LOCTEXT_NAMESPACE "HoudiniNiagaraDataInterface"
 
+// Spawn range search of GetPointIDsToSpawnAtTime, written in the syntax common to HLSL and C++.
+// GetFunctionHLSL emits it as a string, and it is compiled as is in GetPointIDsToSpawnAtTimeGPU,
+// so that HoudiniNiagara.CheckSpawnRangeParity runs the same code as the shaders.
+// Only C style comments can be used in it. The spawn times are read from spawn_times_buffer, which is replaced by the DI's buffer in the HLSL.
+#define HOUDINI_SPAWN_RANGE_SOURCE(Emit) Emit( \
+	if ( !has_time_attr ) \
+	{ \
+		Out_Count = num_points; Out_MinID = 0; Out_MaxID = Out_Count - 1; \
+		Out_LastSpawnTime = In_LastSpawnTime; Out_LastSpawnTimeRequest = In_Time; Out_LastSpawnPointID = In_LastSpawnedPointID; \
+		return; \
+	} \
+	\
+	/* GetLastPointIDToSpawnAtTime */ \
+	int last_id = -1; \
+	if ( spawn_times_sorted != 0 ) \
+	{ \
+		/* Binary search for the first point with a spawn time higher than In_Time */ \
+		int low = 0; \
+		int high = num_points; \
+		while ( low < high ) \
+		{ \
+			int mid = ( low + high ) / 2; \
+			if ( spawn_times_buffer[ mid ] <= In_Time ) { low = mid + 1; } \
+			else { high = mid; } \
+		} \
+		last_id = low - 1; \
+	} \
+	else if ( spawn_times_buffer[ num_points - 1 ] < In_Time ) \
+	{ \
+		last_id = num_points - 1; \
+	} \
+	else \
+	{ \
+		/* Legacy point caches with unsorted spawn times, same linear search as the CPU */ \
+		for ( int n = 0; n < num_points; n++ ) \
+		{ \
+			if ( spawn_times_buffer[ n ] > In_Time ) { break; } \
+			last_id = n; \
+		} \
+	} \
+	\
+	/* First, detect if we need to reset LastSpawnedPointID (after a loop of the emitter) */ \
+	if ( last_id < In_LastSpawnedPointID || In_Time <= In_LastSpawnTime || In_Time <= In_LastSpawnTimeRequest ) \
+		{ In_LastSpawnedPointID = -1; } \
+	\
+	if ( last_id < 0 ) \
+	{ \
+		/* Nothing to spawn, t is lower than the point's time */ \
+		In_LastSpawnedPointID = -1; \
+		Out_MinID = last_id; \
+		Out_MaxID = last_id; \
+		Out_Count = 0; \
+	} \
+	else \
+	{ \
+		/* The last time value in the CSV is lower than t, spawn everything if we didnt already! */ \
+		if ( last_id >= num_points ) \
+			{ last_id = last_id - 1; } \
+		\
+		if ( last_id == In_LastSpawnedPointID ) \
+		{ \
+			/* We dont have any new point to spawn */ \
+			Out_MinID = last_id; \
+			Out_MaxID = last_id; \
+			Out_Count = 0; \
+		} \
+		else \
+		{ \
+			/* We have points to spawn at time t */ \
+			Out_MinID = In_LastSpawnedPointID + 1; \
+			Out_MaxID = last_id; \
+			Out_Count = Out_MaxID - Out_MinID + 1; \
+			\
+			In_LastSpawnedPointID = Out_MaxID; \
+			In_LastSpawnTime = In_Time; \
+		} \
+	} \
+	\
+	In_LastSpawnTimeRequest = In_Time; \
+	\
+	/* Output the sim state variables */ \
+	Out_LastSpawnTimeRequest = In_LastSpawnTimeRequest; \
+	Out_LastSpawnTime = In_LastSpawnTime; \
+	Out_LastSpawnPointID = In_LastSpawnedPointID; \
+)
+
+#define HOUDINI_SHARED_SOURCE_CODE(...) __VA_ARGS__
+#define HOUDINI_SHARED_SOURCE_STRING(...) #__VA_ARGS__
+
 
 #if ENGINE_MAJOR_VERSION==5 && ENGINE_MINOR_VERSION < 1
 
@@ -45,16 +139,43 @@
 const FString UNiagaraDataInterfaceHoudini::NumberOfSamplesBaseName(TEXT("NumberOfSamples_"));
 const FString UNiagaraDataInterfaceHoudini::NumberOfAttributesBaseName(TEXT("NumberOfAttributes_"));
 const FString UNiagaraDataInterfaceHoudini::NumberOfPointsBaseName(TEXT("NumberOfPoints_"));
+const FString UNiagaraDataInterfaceHoudini::NumberOfFramesBaseName(TEXT("NumberOfFrames_"));
+const FString UNiagaraDataInterfaceHoudini::NumberOfPointsPerFrameBaseName(TEXT("NumberOfPointsPerFrame_"));
+const FString UNiagaraDataInterfaceHoudini::NumberOfPointAttributesBaseName(TEXT("NumberOfPointAttributes_"));
+const FString UNiagaraDataInterfaceHoudini::NumberOfQuantizedColumnsBaseName(TEXT("NumberOfQuantizedColumns_"));
+const FString UNiagaraDataInterfaceHoudini::NumberOfIntColumnsBaseName(TEXT("NumberOfIntColumns_"));
+const FString UNiagaraDataInterfaceHoudini::NumberOfVectorColumnsBaseName(TEXT("NumberOfVectorColumns_"));
+const FString UNiagaraDataInterfaceHoudini::SampleTimeStepBaseName(TEXT("SampleTimeStep_"));
+const FString UNiagaraDataInterfaceHoudini::PositionInterpolationBaseName(TEXT("PositionInterpolation_"));
+const FString UNiagaraDataInterfaceHoudini::SpawnTimesSortedBaseName(TEXT("SpawnTimesSorted_"));
 const FString UNiagaraDataInterfaceHoudini::FloatValuesBufferBaseName(TEXT("FloatValuesBuffer_"));
 const FString UNiagaraDataInterfaceHoudini::SpecialAttributeIndexesBufferBaseName(TEXT("SpecialAttributeIndexesBuffer_"));
 const FString UNiagaraDataInterfaceHoudini::SpawnTimesBufferBaseName(TEXT("SpawnTimesBuffer_"));
-const FString UNiagaraDataInterfaceHoudini::LifeValuesBufferBaseName(TEXT("LifeValuesBuffer_"));
-const FString UNiagaraDataInterfaceHoudini::PointTypesBufferBaseName(TEXT("PointTypesBuffer_"));
+const FString UNiagaraDataInterfaceHoudini::PointRecordsBufferBaseName(TEXT("PointRecordsBuffer_"));
 const FString UNiagaraDataInterfaceHoudini::MaxNumberOfIndexesPerPointBaseName(TEXT("MaxNumberOfIndexesPerPoint_"));
-const FString UNiagaraDataInterfaceHoudini::PointValueIndexesBufferBaseName(TEXT("PointValueIndexesBuffer_"));
+const FString UNiagaraDataInterfaceHoudini::PointSampleIndexOffsetsBufferBaseName(TEXT("PointSampleIndexOffsetsBuffer_"));
+const FString UNiagaraDataInterfaceHoudini::PointSampleIndexesBufferBaseName(TEXT("PointSampleIndexesBuffer_"));
+const FString UNiagaraDataInterfaceHoudini::FrameTimesBufferBaseName(TEXT("FrameTimesBuffer_"));
+const FString UNiagaraDataInterfaceHoudini::FrameSampleIndexOffsetsBufferBaseName(TEXT("FrameSampleIndexOffsetsBuffer_"));
+const FString UNiagaraDataInterfaceHoudini::PointAttributeValuesBufferBaseName(TEXT("PointAttributeValuesBuffer_"));
+const FString UNiagaraDataInterfaceHoudini::AttributeColumnIndexesBufferBaseName(TEXT("AttributeColumnIndexesBuffer_"));
+const FString UNiagaraDataInterfaceHoudini::QuantizedValuesBufferBaseName(TEXT("QuantizedValuesBuffer_"));
+const FString UNiagaraDataInterfaceHoudini::QuantizationParamsBufferBaseName(TEXT("QuantizationParamsBuffer_"));
+const FString UNiagaraDataInterfaceHoudini::IntValuesBufferBaseName(TEXT("IntValuesBuffer_"));
+const FString UNiagaraDataInterfaceHoudini::AttributeIntColumnIndexesBufferBaseName(TEXT("AttributeIntColumnIndexesBuffer_"));
+const FString UNiagaraDataInterfaceHoudini::AliveIntervalIndexBufferBaseName(TEXT("AliveIntervalIndexBuffer_"));
+const FString UNiagaraDataInterfaceHoudini::VectorColumnIndexesBufferBaseName(TEXT("VectorColumnIndexesBuffer_"));
+const FString UNiagaraDataInterfaceHoudini::VectorValuesBufferBaseName(TEXT("VectorValuesBuffer_"));
 const FString UNiagaraDataInterfaceHoudini::LastSpawnedPointIdBaseName(TEXT("LastSpawnedPointId_"));
 const FString UNiagaraDataInterfaceHoudini::LastSpawnTimeBaseName(TEXT("LastSpawnTime_"));
 const FString UNiagaraDataInterfaceHoudini::LastSpawnTimeRequestBaseName(TEXT("LastSpawnTimeRequest_"));
+const FString UNiagaraDataInterfaceHoudini::SpawnMinPointIdBaseName(TEXT("SpawnMinPointId_"));
+const FString UNiagaraDataInterfaceHoudini::SpawnMaxPointIdBaseName(TEXT("SpawnMaxPointId_"));
+const FString UNiagaraDataInterfaceHoudini::SpawnCountBaseName(TEXT("SpawnCount_"));
+const FString UNiagaraDataInterfaceHoudini::InstanceTimeBaseName(TEXT("InstanceTime_"));
+const FString UNiagaraDataInterfaceHoudini::InstancePrevFrameIndexBaseName(TEXT("InstancePrevFrameIndex_"));
+const FString UNiagaraDataInterfaceHoudini::InstanceNextFrameIndexBaseName(TEXT("InstanceNextFrameIndex_"));
+const FString UNiagaraDataInterfaceHoudini::InstanceFramePrevWeightBaseName(TEXT("InstanceFramePrevWeight_"));
 const FString UNiagaraDataInterfaceHoudini::FunctionIndexToAttributeIndexBufferBaseName(TEXT("FunctionIndexToAttributeIndexBuffer_"));
 
 #else
@@ -73,16 +194,43 @@ IMPLEMENT_TYPE_LAYOUT(FNiagaraDataInterfaceParametersCS_Houdini);
 const FString UNiagaraDataInterfaceHoudini::NumberOfSamplesBaseName(TEXT("_NumberOfSamples"));
 const FString UNiagaraDataInterfaceHoudini::NumberOfAttributesBaseName(TEXT("_NumberOfAttributes"));
 const FString UNiagaraDataInterfaceHoudini::NumberOfPointsBaseName(TEXT("_NumberOfPoints"));
+const FString UNiagaraDataInterfaceHoudini::NumberOfFramesBaseName(TEXT("_NumberOfFrames"));
+const FString UNiagaraDataInterfaceHoudini::NumberOfPointsPerFrameBaseName(TEXT("_NumberOfPointsPerFrame"));
+const FString UNiagaraDataInterfaceHoudini::NumberOfPointAttributesBaseName(TEXT("_NumberOfPointAttributes"));
+const FString UNiagaraDataInterfaceHoudini::NumberOfQuantizedColumnsBaseName(TEXT("_NumberOfQuantizedColumns"));
+const FString UNiagaraDataInterfaceHoudini::NumberOfIntColumnsBaseName(TEXT("_NumberOfIntColumns"));
+const FString UNiagaraDataInterfaceHoudini::NumberOfVectorColumnsBaseName(TEXT("_NumberOfVectorColumns"));
+const FString UNiagaraDataInterfaceHoudini::SampleTimeStepBaseName(TEXT("_SampleTimeStep"));
+const FString UNiagaraDataInterfaceHoudini::PositionInterpolationBaseName(TEXT("_PositionInterpolation"));
+const FString UNiagaraDataInterfaceHoudini::SpawnTimesSortedBaseName(TEXT("_SpawnTimesSorted"));
 const FString UNiagaraDataInterfaceHoudini::FloatValuesBufferBaseName(TEXT("_FloatValuesBuffer"));
 const FString UNiagaraDataInterfaceHoudini::SpecialAttributeIndexesBufferBaseName(TEXT("_SpecialAttributeIndexesBuffer"));
 const FString UNiagaraDataInterfaceHoudini::SpawnTimesBufferBaseName(TEXT("_SpawnTimesBuffer"));
-const FString UNiagaraDataInterfaceHoudini::LifeValuesBufferBaseName(TEXT("_LifeValuesBuffer"));
-const FString UNiagaraDataInterfaceHoudini::PointTypesBufferBaseName(TEXT("_PointTypesBuffer"));
+const FString UNiagaraDataInterfaceHoudini::PointRecordsBufferBaseName(TEXT("_PointRecordsBuffer"));
 const FString UNiagaraDataInterfaceHoudini::MaxNumberOfIndexesPerPointBaseName(TEXT("_MaxNumberOfIndexesPerPoint"));
-const FString UNiagaraDataInterfaceHoudini::PointValueIndexesBufferBaseName(TEXT("_PointValueIndexesBuffer"));
+const FString UNiagaraDataInterfaceHoudini::PointSampleIndexOffsetsBufferBaseName(TEXT("_PointSampleIndexOffsetsBuffer"));
+const FString UNiagaraDataInterfaceHoudini::PointSampleIndexesBufferBaseName(TEXT("_PointSampleIndexesBuffer"));
+const FString UNiagaraDataInterfaceHoudini::FrameTimesBufferBaseName(TEXT("_FrameTimesBuffer"));
+const FString UNiagaraDataInterfaceHoudini::FrameSampleIndexOffsetsBufferBaseName(TEXT("_FrameSampleIndexOffsetsBuffer"));
+const FString UNiagaraDataInterfaceHoudini::PointAttributeValuesBufferBaseName(TEXT("_PointAttributeValuesBuffer"));
+const FString UNiagaraDataInterfaceHoudini::AttributeColumnIndexesBufferBaseName(TEXT("_AttributeColumnIndexesBuffer"));
+const FString UNiagaraDataInterfaceHoudini::QuantizedValuesBufferBaseName(TEXT("_QuantizedValuesBuffer"));
+const FString UNiagaraDataInterfaceHoudini::QuantizationParamsBufferBaseName(TEXT("_QuantizationParamsBuffer"));
+const FString UNiagaraDataInterfaceHoudini::IntValuesBufferBaseName(TEXT("_IntValuesBuffer"));
+const FString UNiagaraDataInterfaceHoudini::AttributeIntColumnIndexesBufferBaseName(TEXT("_AttributeIntColumnIndexesBuffer"));
+const FString UNiagaraDataInterfaceHoudini::AliveIntervalIndexBufferBaseName(TEXT("_AliveIntervalIndexBuffer"));
+const FString UNiagaraDataInterfaceHoudini::VectorColumnIndexesBufferBaseName(TEXT("_VectorColumnIndexesBuffer"));
+const FString UNiagaraDataInterfaceHoudini::VectorValuesBufferBaseName(TEXT("_VectorValuesBuffer"));
 const FString UNiagaraDataInterfaceHoudini::LastSpawnedPointIdBaseName(TEXT("_LastSpawnedPointId"));
 const FString UNiagaraDataInterfaceHoudini::LastSpawnTimeBaseName(TEXT("_LastSpawnTime"));
 const FString UNiagaraDataInterfaceHoudini::LastSpawnTimeRequestBaseName(TEXT("_LastSpawnTimeRequest"));
+const FString UNiagaraDataInterfaceHoudini::SpawnMinPointIdBaseName(TEXT("_SpawnMinPointId"));
+const FString UNiagaraDataInterfaceHoudini::SpawnMaxPointIdBaseName(TEXT("_SpawnMaxPointId"));
+const FString UNiagaraDataInterfaceHoudini::SpawnCountBaseName(TEXT("_SpawnCount"));
+const FString UNiagaraDataInterfaceHoudini::InstanceTimeBaseName(TEXT("_InstanceTime"));
+const FString UNiagaraDataInterfaceHoudini::InstancePrevFrameIndexBaseName(TEXT("_InstancePrevFrameIndex"));
+const FString UNiagaraDataInterfaceHoudini::InstanceNextFrameIndexBaseName(TEXT("_InstanceNextFrameIndex"));
+const FString UNiagaraDataInterfaceHoudini::InstanceFramePrevWeightBaseName(TEXT("_InstanceFramePrevWeight"));
 const FString UNiagaraDataInterfaceHoudini::FunctionIndexToAttributeIndexBufferBaseName(TEXT("_FunctionIndexToAttributeIndexBuffer"));
 
 
@@ -101,6 +249,7 @@ static const FName GetVector4ValueName("GetVector4Value");
 static const FName GetVector4ValueByStringName("GetVector4ValueByString");
 static const FName GetQuatValueName("GetQuatValue");
 static const FName GetQuatValueByStringName("GetQuatValueByString");
+static const FName GetIntValueName("GetIntValue");
 
 static const FName GetPositionName("GetPosition");
 static const FName GetNormalName("GetNormal");
@@ -116,6 +265,8 @@ static const FName GetNumberOfAttributesName("GetNumberOfAttributes");
 
 static const FName GetLastSampleIndexAtTimeName("GetLastSampleIndexAtTime");
 static const FName GetPointIDsToSpawnAtTimeName("GetPointIDsToSpawnAtTime");
+static const FName GetPointIDsToSpawnName("GetPointIDsToSpawn");
+static const FName GetAlivePointsAtTimeName("GetAlivePointsAtTime");
 static const FName GetSampleIndexesForPointAtTimeName("GetSampleIndexesForPointAtTime");
 
 static const FName GetPointPositionAtTimeName("GetPointPositionAtTime");
@@ -129,6 +280,24 @@ static const FName GetPointVectorValueAtTimeExName("GetPointVectorValueAtTimeEx"
 static const FName GetPointVectorValueAtTimeExByStringName("GetPointVectorValueAtTimeExByString");
 static const FName GetPointQuatValueAtTimeName("GetPointQuatValueAtTime");
 static const FName GetPointQuatValueAtTimeByStringName("GetPointQuatValueAtTimeByString");
+static const FName GetPointIntValueAtTimeName("GetPointIntValueAtTime");
+// Sample cursor variants of the GetPoint*AtTime functions, resuming the sample search from a cursor stored by the particle
+static const FName GetSampleIndexesForPointAtTimeWithCursorName("GetSampleIndexesForPointAtTimeWithCursor");
+static const FName GetPointPositionAtTimeWithCursorName("GetPointPositionAtTimeWithCursor");
+static const FName GetPointValueAtTimeWithCursorName("GetPointValueAtTimeWithCursor");
+static const FName GetPointValueAtTimeWithCursorByStringName("GetPointValueAtTimeWithCursorByString");
+static const FName GetPointVectorValueAtTimeWithCursorName("GetPointVectorValueAtTimeWithCursor");
+static const FName GetPointVectorValueAtTimeWithCursorByStringName("GetPointVectorValueAtTimeWithCursorByString");
+static const FName GetPointVectorValueAtTimeExWithCursorName("GetPointVectorValueAtTimeExWithCursor");
+static const FName GetPointVectorValueAtTimeExWithCursorByStringName("GetPointVectorValueAtTimeExWithCursorByString");
+static const FName GetPointVector4ValueAtTimeWithCursorName("GetPointVector4ValueAtTimeWithCursor");
+static const FName GetPointVector4ValueAtTimeWithCursorByStringName("GetPointVector4ValueAtTimeWithCursorByString");
+static const FName GetPointQuatValueAtTimeWithCursorName("GetPointQuatValueAtTimeWithCursor");
+static const FName GetPointQuatValueAtTimeWithCursorByStringName("GetPointQuatValueAtTimeWithCursorByString");
+static const FName GetPointNormalAtTimeWithCursorName("GetPointNormalAtTimeWithCursor");
+static const FName GetPointColorAtTimeWithCursorName("GetPointColorAtTimeWithCursor");
+static const FName GetPointAlphaAtTimeWithCursorName("GetPointAlphaAtTimeWithCursor");
+static const FName GetPointVelocityAtTimeWithCursorName("GetPointVelocityAtTimeWithCursor");
 
 static const FName GetPointLifeName("GetPointLife");
 static const FName GetPointLifeAtTimeName("GetPointLifeAtTime");
@@ -138,6 +307,7 @@ static const FName GetPointNormalAtTimeName("GetPointNormalAtTime");
 static const FName GetPointColorAtTimeName("GetPointColorAtTime");
 static const FName GetPointAlphaAtTimeName("GetPointAlphaAtTime");
 static const FName GetPointVelocityAtTimeName("GetPointVelocityAtTime");
+static const FName GetPointAttributesAtTimeName("GetPointAttributesAtTime");
 static const FName GetPointImpulseAtTimeName("GetPointImpulseAtTime");
 static const FName GetPointTypeAtTimeName("GetPointTypeAtTime");
 
@@ -147,6 +317,7 @@ UNiagaraDataInterfaceHoudini::UNiagaraDataInterfaceHoudini(FObjectInitializer co
 	: Super(ObjectInitializer)
 {
     HoudiniPointCacheAsset = nullptr;
+	bSpecializeShaders = false;
 
 	Proxy.Reset(new FNiagaraDataInterfaceProxyHoudini());
 }
@@ -192,6 +363,48 @@ void UNiagaraDataInterfaceHoudini::PostEditChangeProperty(struct FPropertyChange
     }
 }
 
+
+void UNiagaraDataInterfaceHoudini::RequestCompileOfSpecializedShaders(const UHoudiniPointCache* PointCache)
+{
+	TSet<UNiagaraSystem*> Systems;
+	for ( TObjectIterator<UNiagaraDataInterfaceHoudini> It; It; ++It )
+	{
+		const UNiagaraDataInterfaceHoudini* HoudiniDI = *It;
+		if ( !HoudiniDI->bSpecializeShaders || HoudiniDI->HoudiniPointCacheAsset != PointCache || HoudiniDI->HasAnyFlags( RF_ClassDefaultObject ) )
+			continue;
+
+		if ( UNiagaraSystem* System = HoudiniDI->GetTypedOuter<UNiagaraSystem>() )
+			Systems.Add( System );
+	}
+
+	// The compile hash of the scripts using these data interfaces includes the point cache's layout,
+	// only the out of date scripts are recompiled
+	for ( UNiagaraSystem* System : Systems )
+		System->RequestCompile( false );
+}
+
+void UNiagaraDataInterfaceHoudini::ReinitializeSystemsUsingPointCache(const UHoudiniPointCache* PointCache)
+{
+	FNiagaraSystemUpdateContext UpdateContext;
+	TSet<UNiagaraSystem*> Systems;
+	for ( TObjectIterator<UNiagaraDataInterfaceHoudini> It; It; ++It )
+	{
+		UNiagaraDataInterfaceHoudini* HoudiniDI = *It;
+		if ( HoudiniDI->HoudiniPointCacheAsset != PointCache || HoudiniDI->HasAnyFlags( RF_ClassDefaultObject ) )
+			continue;
+
+		// The point cache's GPU resource might have been recreated
+		HoudiniDI->PushToRenderThreadImpl();
+
+		UNiagaraSystem* System = HoudiniDI->GetTypedOuter<UNiagaraSystem>();
+		if ( System && !Systems.Contains( System ) )
+		{
+			Systems.Add( System );
+			UpdateContext.Add( System, true );
+		}
+	}
+}
+
 #endif
 
 bool UNiagaraDataInterfaceHoudini::CopyToInternal(UNiagaraDataInterface* Destination) const
@@ -204,6 +417,7 @@ bool UNiagaraDataInterfaceHoudini::CopyToInternal(UNiagaraDataInterface* Destina
 		return false;
 
     CastedInterface->HoudiniPointCacheAsset = HoudiniPointCacheAsset;
+	CastedInterface->bSpecializeShaders = bSpecializeShaders;
 	CastedInterface->MarkRenderDataDirty(); 
 
     return true;
@@ -218,6 +432,9 @@ bool UNiagaraDataInterfaceHoudini::Equals(const UNiagaraDataInterface* Other) co
 
     if ( OtherHN != nullptr && OtherHN->HoudiniPointCacheAsset != nullptr && HoudiniPointCacheAsset )
     {
+		if ( OtherHN->bSpecializeShaders != bSpecializeShaders )
+			return false;
+
 		// Just make sure the two interfaces point to the same file
 		return OtherHN->HoudiniPointCacheAsset->FileName.Equals( HoudiniPointCacheAsset->FileName );
     }
@@ -225,6 +442,113 @@ bool UNiagaraDataInterfaceHoudini::Equals(const UNiagaraDataInterface* Other) co
     return false;
 }
 
+bool UNiagaraDataInterfaceHoudini::InitPerInstanceData(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance)
+{
+	new (PerInstanceData) FHoudiniNiagaraInstanceData();
+	return true;
+}
+
+void UNiagaraDataInterfaceHoudini::DestroyPerInstanceData(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance)
+{
+	FHoudiniNiagaraInstanceData* InstData = static_cast<FHoudiniNiagaraInstanceData*>(PerInstanceData);
+	InstData->~FHoudiniNiagaraInstanceData();
+
+	FNiagaraDataInterfaceProxyHoudini* ThisProxy = GetProxyAs<FNiagaraDataInterfaceProxyHoudini>();
+	ENQUEUE_RENDER_COMMAND(FNiagaraDIHoudiniPointCache_RemoveInstance) (
+		[ThisProxy, InstanceID = SystemInstance->GetId()](FRHICommandListImmediate& CmdList)
+	{
+		ThisProxy->SystemInstancesToInstanceData.Remove(InstanceID);
+	}
+	);
+}
+
+bool UNiagaraDataInterfaceHoudini::PerInstanceTick(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance, float DeltaSeconds)
+{
+	FHoudiniNiagaraInstanceData* InstData = static_cast<FHoudiniNiagaraInstanceData*>(PerInstanceData);
+	if ( !InstData )
+		return true;
+
+	const float Time = SystemInstance->GetAge();
+	const bool bTimeHasChanged = Time != InstData->Time;
+
+	// The system has been reset or has looped, start spawning from the first point again
+	if ( Time < InstData->Time )
+		InstData->ResetSpawnState();
+
+	InstData->Time = Time;
+	InstData->SpawnMinID = InstData->LastSpawnedPointID;
+	InstData->SpawnMaxID = InstData->LastSpawnedPointID;
+	InstData->SpawnCount = 0;
+	InstData->bHasFrameIndexes = false;
+
+	if ( !HoudiniPointCacheAsset )
+		return false;
+
+	// The spawn state is only advanced when the time changes, so a paused system doesn't spawn the same points again
+	if ( bTimeHasChanged )
+	{
+		HoudiniPointCacheAsset->GetPointIDsToSpawnAtTime(
+			Time, InstData->SpawnMinID, InstData->SpawnMaxID, InstData->SpawnCount,
+			InstData->LastSpawnedPointID, InstData->LastSpawnTime, InstData->LastSpawnTimeRequest );
+	}
+
+	if ( HoudiniPointCacheAsset->HasFixedTopology() )
+	{
+		InstData->bHasFrameIndexes = HoudiniPointCacheAsset->GetFrameIndexesAtTime(
+			Time, InstData->PrevFrameIndex, InstData->NextFrameIndex, InstData->FramePrevWeight );
+	}
+
+	return false;
+}
+
+void UNiagaraDataInterfaceHoudini::ProvidePerInstanceDataForRenderThread(void* DataForRenderThread, void* PerInstanceData, const FNiagaraSystemInstanceID& SystemInstance)
+{
+	// The instance data is plain old data, send a copy of this tick's values to the proxy
+	new (DataForRenderThread) FHoudiniNiagaraInstanceData( *static_cast<const FHoudiniNiagaraInstanceData*>(PerInstanceData) );
+}
+
+// Attributes read by GetPointAttributesAtTime
+enum EHoudiniPointAttributesMask
+{
+	HOUDINI_POINT_ATTR_POSITION = 1 << 0,
+	HOUDINI_POINT_ATTR_VELOCITY = 1 << 1,
+	HOUDINI_POINT_ATTR_NORMAL = 1 << 2,
+	HOUDINI_POINT_ATTR_COLOR = 1 << 3,
+	HOUDINI_POINT_ATTR_ALPHA = 1 << 4,
+	HOUDINI_POINT_ATTR_ALL = ( 1 << 5 ) - 1
+};
+
+// Converts the Attributes specifier of GetPointAttributesAtTime (ie "Position, Velocity, Color") to an attribute mask.
+// If the specifier is missing or empty, all the attributes are read.
+static int32
+GetPointAttributesMaskFromSpecifier(const FName* Specifier)
+{
+	if ( !Specifier || Specifier->IsNone() )
+		return HOUDINI_POINT_ATTR_ALL;
+
+	TArray<FString> AttributeNames;
+	Specifier->ToString().ParseIntoArrayWS( AttributeNames, TEXT(",") );
+
+	int32 Mask = 0;
+	for ( const FString& AttributeName : AttributeNames )
+	{
+		if ( AttributeName.Equals( TEXT("Position"), ESearchCase::IgnoreCase ) )
+			Mask |= HOUDINI_POINT_ATTR_POSITION;
+		else if ( AttributeName.Equals( TEXT("Velocity"), ESearchCase::IgnoreCase ) )
+			Mask |= HOUDINI_POINT_ATTR_VELOCITY;
+		else if ( AttributeName.Equals( TEXT("Normal"), ESearchCase::IgnoreCase ) )
+			Mask |= HOUDINI_POINT_ATTR_NORMAL;
+		else if ( AttributeName.Equals( TEXT("Color"), ESearchCase::IgnoreCase ) )
+			Mask |= HOUDINI_POINT_ATTR_COLOR;
+		else if ( AttributeName.Equals( TEXT("Alpha"), ESearchCase::IgnoreCase ) )
+			Mask |= HOUDINI_POINT_ATTR_ALPHA;
+		else
+			UE_LOG( LogHoudiniNiagara, Warning, TEXT("GetPointAttributesAtTime: Unknown attribute '%s', expected Position, Velocity, Normal, Color or Alpha."), *AttributeName );
+	}
+
+	return Mask != 0 ? Mask : HOUDINI_POINT_ATTR_ALL;
+}
+
 // Returns the signature of all the functions avaialable in the data interface
 void UNiagaraDataInterfaceHoudini::GetFunctions(TArray<FNiagaraFunctionSignature>& OutFunctions)
 {
@@ -245,6 +569,23 @@ void UNiagaraDataInterfaceHoudini::GetFunctions(TArray<FNiagaraFunctionSignature
 		OutFunctions.Add( Sig );
     }
 
+    {
+		// GetIntValue
+		FNiagaraFunctionSignature Sig;
+		Sig.Name = GetIntValueName;
+		Sig.bMemberFunction = true;
+		Sig.bRequiresContext = false;
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleIndex")));		// SampleIndex In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("AttributeIndex")));	// AttributeIndex In
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("Value")));    		// Int Out
+
+		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetIntValue",
+			"Returns the integer value in the point cache for a given Sample Index and Attribute Index.\nInteger attributes are read without conversion, other attributes are rounded down." ) );
+
+		OutFunctions.Add( Sig );
+    }
+
     {
 		// GetFloatValueByString
 		FNiagaraFunctionSignature Sig;
@@ -609,6 +950,45 @@ void UNiagaraDataInterfaceHoudini::GetFunctions(TArray<FNiagaraFunctionSignature
 		OutFunctions.Add(Sig);
     }
 
+	{
+		// GetAlivePointsAtTime
+		FNiagaraFunctionSignature Sig;
+		Sig.Name = GetAlivePointsAtTimeName;
+		Sig.bMemberFunction = true;
+		Sig.bRequiresContext = false;
+		Sig.Inputs.Add(FNiagaraVariable( FNiagaraTypeDefinition(GetClass()), TEXT("PointCache") ) );		// PointCache in
+		Sig.Inputs.Add(FNiagaraVariable( FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time") ) );		    // Time in
+
+		Sig.Outputs.Add(FNiagaraVariable( FNiagaraTypeDefinition::GetIntDef(), TEXT("MinID") ) );			// Int Out
+		Sig.Outputs.Add(FNiagaraVariable( FNiagaraTypeDefinition::GetIntDef(), TEXT("MaxID") ) );			// Int Out
+		Sig.Outputs.Add(FNiagaraVariable( FNiagaraTypeDefinition::GetIntDef(), TEXT("Count") ) );		    // Int Out
+
+		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetAlivePointsAtTime",
+			"Returns the number of points alive (spawned and not dead yet) at a given time value, and the range of point IDs [MinID, MaxID] containing them.\n"
+			"The range can also contain points that are not alive at that time. An empty range is returned as MinID = 0, MaxID = -1." ) );
+
+		OutFunctions.Add(Sig);
+	}
+
+	{
+		// GetPointIDsToSpawn
+		FNiagaraFunctionSignature Sig;
+		Sig.Name = GetPointIDsToSpawnName;
+		Sig.bMemberFunction = true;
+		Sig.bRequiresContext = false;
+		Sig.Inputs.Add(FNiagaraVariable( FNiagaraTypeDefinition(GetClass()), TEXT("PointCache") ) );		// PointCache in
+
+		Sig.Outputs.Add(FNiagaraVariable( FNiagaraTypeDefinition::GetIntDef(), TEXT("MinID") ) );			// Int Out
+		Sig.Outputs.Add(FNiagaraVariable( FNiagaraTypeDefinition::GetIntDef(), TEXT("MaxID") ) );			// Int Out
+		Sig.Outputs.Add(FNiagaraVariable( FNiagaraTypeDefinition::GetIntDef(), TEXT("Count") ) );		    // Int Out
+
+		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointIDsToSpawn",
+			"Returns the count and point IDs of the points that should spawn during this tick.\n"
+			"The spawn range is computed once per tick for the system instance, using the system's age as time, and the spawn state is kept by the data interface." ) );
+
+		OutFunctions.Add(Sig);
+	}
+
 	{
 		// GetSampleIndexesForPointAtTime
 		FNiagaraFunctionSignature Sig;
@@ -663,6 +1043,24 @@ void UNiagaraDataInterfaceHoudini::GetFunctions(TArray<FNiagaraFunctionSignature
 		OutFunctions.Add(Sig);
 	}
 
+	{
+		// GetPointIntValueAtTime
+		FNiagaraFunctionSignature Sig;
+		Sig.Name = GetPointIntValueAtTimeName;
+		Sig.bMemberFunction = true;
+		Sig.bRequiresContext = false;
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point Number In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("AttributeIndex")));	// AttributeIndex In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		    // Time in
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("Value")));		    // Int Out
+
+		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointIntValueAtTime",
+			"Returns the integer value in the specified attribute for a given point at the last sample before a given time. No value interpolation will take place." ) );
+
+		OutFunctions.Add(Sig);
+	}
+
 	{
 		// GetPointValueAtTimeByString
 		FNiagaraFunctionSignature Sig;
@@ -720,563 +1118,1054 @@ void UNiagaraDataInterfaceHoudini::GetFunctions(TArray<FNiagaraFunctionSignature
 	}
 
 	{
-		// GetPointVector4ValueAtTime
+		// GetSampleIndexesForPointAtTimeWithCursor
 		FNiagaraFunctionSignature Sig;
-		Sig.Name = GetPointVector4ValueAtTimeName;
+		Sig.Name = GetSampleIndexesForPointAtTimeWithCursorName;
 		Sig.bMemberFunction = true;
 		Sig.bRequiresContext = false;
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point ID In
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("AttributeIndex")));	// AttributeIndex In
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		    // Time in		
-		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec4Def(), TEXT("Value")));			// Vector4 Out
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));				// PointCache in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));					// Point Number In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));					// Time in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));			// Cursor In
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PreviousSampleIndex")));	// Int Out
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("NextSampleIndex")));		// Int Out
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("PrevWeight")));			// Float Out
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));			// Cursor Out
 
-		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointVector4ValueAtTime",
-			"Helper function returning the linearly interpolated Vector4 value in the specified Attribute Index for a given point at a given time.\nThe returned Vector is converted from Houdini's coordinate system to Unreal's." ) );
+		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetSampleIndexesForPointAtTimeWithCursor",
+			"Returns the sample indexes for a given point at a given time, resuming the search from a sample cursor.\nStore the returned cursor in a particle attribute initialized to -1 and pass it back on the next call for the same point: the search will then only take a few steps.") );
 
 		OutFunctions.Add(Sig);
 	}
 
 	{
-		// GetPointVectorValueAtTimeByString
+		// GetPointPositionAtTimeWithCursor
 		FNiagaraFunctionSignature Sig;
-		Sig.Name = GetPointVector4ValueAtTimeByStringName;
+		Sig.Name = GetPointPositionAtTimeWithCursorName;
 		Sig.bMemberFunction = true;
 		Sig.bRequiresContext = false;
 		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point ID In
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		    // Time in		
-		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec4Def(), TEXT("Value")));			// Vector4 Out
-
-		Sig.FunctionSpecifiers.Add(FName("Attribute"));
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point Number In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		    // Time in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));	// Cursor In
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("Position")));		// Vector3 Out
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));	// Cursor Out
 
-		Sig.SetDescription(LOCTEXT("DataInterfaceHoudini_GetPointVector4ValueAtTimeByString",
-			"Helper function returning the linearly interpolated Vector4 value in the specified attribute (by name) for a given point at a given time.\nThe returned Vector is converted from Houdini's coordinate system to Unreal's."));
+		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointPositionAtTimeWithCursor",
+			"Same as GetPointPositionAtTime, resuming the search from a sample cursor.\nStore the returned cursor in a particle attribute initialized to -1 and pass it back on the next call for the same point.") );
 
 		OutFunctions.Add(Sig);
 	}
 
 	{
-		// GetPointVectorValueAtTimeEx
+		// GetPointValueAtTimeWithCursor
 		FNiagaraFunctionSignature Sig;
-		Sig.Name = GetPointVectorValueAtTimeExName;
+		Sig.Name = GetPointValueAtTimeWithCursorName;
 		Sig.bMemberFunction = true;
 		Sig.bRequiresContext = false;
 		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point ID In
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("AttributeIndex")));	 // AttributeIndex In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point Number In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("AttributeIndex")));	// AttributeIndex In
 		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		    // Time in
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetBoolDef(), TEXT("DoSwap")));			// DoSwap in
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetBoolDef(), TEXT("DoScale")));		// DoScale in
-		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("Value")));			// Vector3 Out
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));	// Cursor In
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Value")));		// Float Out
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));	// Cursor Out
 
-		Sig.SetDescription(LOCTEXT("DataInterfaceHoudini_GetPointVectorValueAtTime",
-			"Helper function returning the linearly interpolated Vector value in the specified attribute index for a given point at a given time.\nThe DoSwap parameter indicates if the vector should be converted from Houdini*s coordinate system to Unreal's.\nThe DoScale parameter decides if the Vector value should be converted from meters (Houdini) to centimeters (Unreal)." ) );
+		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointValueAtTimeWithCursor",
+			"Same as GetPointValueAtTime, resuming the search from a sample cursor.\nStore the returned cursor in a particle attribute initialized to -1 and pass it back on the next call for the same point.") );
 
 		OutFunctions.Add(Sig);
 	}
 
 	{
-		// GetPointVectorValueAtTimeExByString
+		// GetPointVectorValueAtTimeWithCursor
 		FNiagaraFunctionSignature Sig;
-		Sig.Name = GetPointVectorValueAtTimeExByStringName;
+		Sig.Name = GetPointVectorValueAtTimeWithCursorName;
 		Sig.bMemberFunction = true;
 		Sig.bRequiresContext = false;
 		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
 		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point ID In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("AttributeIndex")));	// AttributeIndex In
 		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		    // Time in
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetBoolDef(), TEXT("DoSwap")));			// DoSwap in
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetBoolDef(), TEXT("DoScale")));		// DoScale in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));	// Cursor In
 		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("Value")));			// Vector3 Out
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));	// Cursor Out
 
-		Sig.FunctionSpecifiers.Add(FName("Attribute"));
-
-		Sig.SetDescription(LOCTEXT("DataInterfaceHoudini_GetPointVectorValueAtTimeByString",
-			"Helper function returning the linearly interpolated Vector value in the specified attribute (by name) for a given point at a given time.\nThe DoSwap parameter indicates if the vector should be converted from Houdini*s coordinate system to Unreal's.\nThe DoScale parameter decides if the Vector value should be converted from meters (Houdini) to centimeters (Unreal)."));
+		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointVectorValueAtTimeWithCursor",
+			"Same as GetPointVectorValueAtTime, resuming the search from a sample cursor.\nStore the returned cursor in a particle attribute initialized to -1 and pass it back on the next call for the same point.") );
 
 		OutFunctions.Add(Sig);
 	}
 
 	{
-		// GetPointQuatValueAtTime
+		// GetPointValueAtTimeWithCursorByString
 		FNiagaraFunctionSignature Sig;
-		Sig.Name = GetPointQuatValueAtTimeName;
+		Sig.Name = GetPointValueAtTimeWithCursorByStringName;
 		Sig.bMemberFunction = true;
 		Sig.bRequiresContext = false;
 		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point ID In
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("AttributeIndex")));	 // AttributeIndex In
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		    // Time in
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetBoolDef(), TEXT("DoHoudiniToUnrealConversion")));		// DoHoudiniToUnrealConversion in
-		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetQuatDef(), TEXT("Value")));			// Quat Out
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));		// Point ID In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		// Time in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));	// Cursor In
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Value")));		// Float Out
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));	// Cursor Out
 
-		Sig.SetDescription(LOCTEXT("DataInterfaceHoudini_GetPointQuatValueAtTime",
-			"Helper function returning the linearly interpolated Quat value in the specified attribute index for a given point at a given time.\nThe DoHoudiniToUnrealConversion parameter indicates if the vector4 should be converted from Houdini*s coordinate system to Unreal's.\n" ) );
+		Sig.FunctionSpecifiers.Add(FName("Attribute"));
+
+		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointValueAtTimeWithCursorByString",
+			"Same as GetPointValueAtTimeByString, resuming the search from a sample cursor.\nStore the returned cursor in a particle attribute initialized to -1 and pass it back on the next call for the same point.") );
 
 		OutFunctions.Add(Sig);
 	}
 
 	{
-		// GetPointQuatValueAtTimeByString
+		// GetPointVectorValueAtTimeWithCursorByString
 		FNiagaraFunctionSignature Sig;
-		Sig.Name = GetPointQuatValueAtTimeByStringName;
+		Sig.Name = GetPointVectorValueAtTimeWithCursorByStringName;
 		Sig.bMemberFunction = true;
 		Sig.bRequiresContext = false;
 		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point ID In
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		    // Time in
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetBoolDef(), TEXT("DoHoudiniToUnrealConversion")));		// DoHoudiniToUnrealConversion in
-		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetQuatDef(), TEXT("Value")));			// Quat Out
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));		// Point ID In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		// Time in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));	// Cursor In
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("Value")));		// Vector3 Out
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));	// Cursor Out
 
 		Sig.FunctionSpecifiers.Add(FName("Attribute"));
 
-		Sig.SetDescription(LOCTEXT("DataInterfaceHoudini_GetPointQuatValueAtTimeByString",
-			"Helper function returning the linearly interpolated Quat value in the specified attribute (by name) for a given point at a given time.\nThe DoHoudiniToUnrealConversion parameter indicates if the vector should be converted from Houdini*s coordinate system to Unreal's.\n"));
+		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointVectorValueAtTimeWithCursorByString",
+			"Same as GetPointVectorValueAtTimeByString, resuming the search from a sample cursor.\nStore the returned cursor in a particle attribute initialized to -1 and pass it back on the next call for the same point.") );
 
 		OutFunctions.Add(Sig);
 	}
 
 	{
-		// GetPointLife
+		// GetPointVectorValueAtTimeExWithCursor
 		FNiagaraFunctionSignature Sig;
-		Sig.Name = GetPointLifeName;
+		Sig.Name = GetPointVectorValueAtTimeExWithCursorName;
 		Sig.bMemberFunction = true;
 		Sig.bRequiresContext = false;
 		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point Number In		
-		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Life")));			// Float Out
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));		// Point ID In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("AttributeIndex")));		// AttributeIndex In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		// Time in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetBoolDef(), TEXT("DoSwap")));		// DoSwap in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetBoolDef(), TEXT("DoScale")));		// DoScale in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));	// Cursor In
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("Value")));		// Vector3 Out
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));	// Cursor Out
 
-		Sig.SetDescription(LOCTEXT("DataInterfaceHoudini_GetPointLife",
-			"Helper function returning the life value for a given point when spawned.\nThe life value is either calculated from the alive attribute or is the life attribute at spawn time."));
+		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointVectorValueAtTimeExWithCursor",
+			"Same as GetPointVectorValueAtTimeEx, resuming the search from a sample cursor.\nStore the returned cursor in a particle attribute initialized to -1 and pass it back on the next call for the same point.") );
 
 		OutFunctions.Add(Sig);
 	}
 
 	{
-		// GetPointLifeAtTime
+		// GetPointVectorValueAtTimeExWithCursorByString
 		FNiagaraFunctionSignature Sig;
-		Sig.Name = GetPointLifeAtTimeName;
+		Sig.Name = GetPointVectorValueAtTimeExWithCursorByStringName;
 		Sig.bMemberFunction = true;
 		Sig.bRequiresContext = false;
 		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point Number In		
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		    // Time in		
-		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Life")));			// Float Out
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));		// Point ID In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		// Time in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetBoolDef(), TEXT("DoSwap")));		// DoSwap in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetBoolDef(), TEXT("DoScale")));		// DoScale in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));	// Cursor In
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("Value")));		// Vector3 Out
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));	// Cursor Out
 
-		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointLifeAtTime",
-			"Helper function returning the remaining life for a given point in the point cache at a given time." ) );
+		Sig.FunctionSpecifiers.Add(FName("Attribute"));
+
+		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointVectorValueAtTimeExWithCursorByString",
+			"Same as GetPointVectorValueAtTimeExByString, resuming the search from a sample cursor.\nStore the returned cursor in a particle attribute initialized to -1 and pass it back on the next call for the same point.") );
 
 		OutFunctions.Add(Sig);
 	}
 
 	{
-		// GetPointType
+		// GetPointVector4ValueAtTimeWithCursor
 		FNiagaraFunctionSignature Sig;
-		Sig.Name = GetPointTypeName;
+		Sig.Name = GetPointVector4ValueAtTimeWithCursorName;
 		Sig.bMemberFunction = true;
 		Sig.bRequiresContext = false;
 		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point Number In		
-		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("Type")));			// Int Out
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));		// Point ID In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("AttributeIndex")));		// AttributeIndex In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		// Time in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));	// Cursor In
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec4Def(), TEXT("Value")));		// Vector4 Out
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));	// Cursor Out
 
-		Sig.SetDescription(LOCTEXT("DataInterfaceHoudini_GetPointType",
-			"Helper function returning the type value for a given point when spawned.\n"));
+		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointVector4ValueAtTimeWithCursor",
+			"Same as GetPointVector4ValueAtTime, resuming the search from a sample cursor.\nStore the returned cursor in a particle attribute initialized to -1 and pass it back on the next call for the same point.") );
 
 		OutFunctions.Add(Sig);
 	}
 
 	{
-		// GetPointNormalAtTime
+		// GetPointVector4ValueAtTimeWithCursorByString
 		FNiagaraFunctionSignature Sig;
-		Sig.Name = GetPointNormalAtTimeName;
+		Sig.Name = GetPointVector4ValueAtTimeWithCursorByStringName;
 		Sig.bMemberFunction = true;
 		Sig.bRequiresContext = false;
 		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point Number In
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		    // Time in
-		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("Normal")));		// Vector3 Out
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));		// Point ID In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		// Time in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));	// Cursor In
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec4Def(), TEXT("Value")));		// Vector4 Out
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));	// Cursor Out
 
-		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointNormalAtTime",
-			"Helper function returning the linearly interpolated normal for a given point at a given time.\nThe returned vector is converted from Houdini's coordinate system to Unreal's.") );
+		Sig.FunctionSpecifiers.Add(FName("Attribute"));
+
+		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointVector4ValueAtTimeWithCursorByString",
+			"Same as GetPointVector4ValueAtTimeByString, resuming the search from a sample cursor.\nStore the returned cursor in a particle attribute initialized to -1 and pass it back on the next call for the same point.") );
 
 		OutFunctions.Add(Sig);
 	}
 
 	{
-		// GetPointColorAtTime
+		// GetPointQuatValueAtTimeWithCursor
 		FNiagaraFunctionSignature Sig;
-		Sig.Name = GetPointColorAtTimeName;
+		Sig.Name = GetPointQuatValueAtTimeWithCursorName;
 		Sig.bMemberFunction = true;
 		Sig.bRequiresContext = false;
 		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point Number In
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		    // Time in
-		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("Color")));		    // Vector3 Out
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));		// Point ID In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("AttributeIndex")));		// AttributeIndex In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		// Time in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetBoolDef(), TEXT("DoHoudiniToUnrealConversion")));		// DoHoudiniToUnrealConversion in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));	// Cursor In
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetQuatDef(), TEXT("Value")));		// Quat Out
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));	// Cursor Out
 
-		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointColorAtTime",
-			"Helper function returning the linearly interpolated color for a given point at a given time.") );
+		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointQuatValueAtTimeWithCursor",
+			"Same as GetPointQuatValueAtTime, resuming the search from a sample cursor.\nStore the returned cursor in a particle attribute initialized to -1 and pass it back on the next call for the same point.") );
 
 		OutFunctions.Add(Sig);
 	}
 
 	{
-		// GetPointAlphaAtTime
+		// GetPointQuatValueAtTimeWithCursorByString
 		FNiagaraFunctionSignature Sig;
-		Sig.Name = GetPointAlphaAtTimeName;
+		Sig.Name = GetPointQuatValueAtTimeWithCursorByStringName;
 		Sig.bMemberFunction = true;
 		Sig.bRequiresContext = false;
 		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point Number In
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		    // Time in
-		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Alpha")));		// Float Out
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));		// Point ID In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		// Time in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetBoolDef(), TEXT("DoHoudiniToUnrealConversion")));		// DoHoudiniToUnrealConversion in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));	// Cursor In
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetQuatDef(), TEXT("Value")));		// Quat Out
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));	// Cursor Out
 
-		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointAlphaAtTime",
-			"Helper function returning the linearly interpolated alpha for a given point at a given time.") );
+		Sig.FunctionSpecifiers.Add(FName("Attribute"));
+
+		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointQuatValueAtTimeWithCursorByString",
+			"Same as GetPointQuatValueAtTimeByString, resuming the search from a sample cursor.\nStore the returned cursor in a particle attribute initialized to -1 and pass it back on the next call for the same point.") );
 
 		OutFunctions.Add(Sig);
 	}
 
 	{
-		// GetPointVelocityAtTime
+		// GetPointVector4ValueAtTime
 		FNiagaraFunctionSignature Sig;
-		Sig.Name = GetPointVelocityAtTimeName;
+		Sig.Name = GetPointVector4ValueAtTimeName;
 		Sig.bMemberFunction = true;
 		Sig.bRequiresContext = false;
 		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point Number In
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		    // Time in
-		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("Velocity")));	    // Vector3 Out
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point ID In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("AttributeIndex")));	// AttributeIndex In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		    // Time in		
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec4Def(), TEXT("Value")));			// Vector4 Out
 
-		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointVelocityAtTime",
-			"Helper function returning the linearly interpolated velocity for a given point at a given time.\nThe returned vector is converted from Houdini's coordinate system to Unreal's.") );
+		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointVector4ValueAtTime",
+			"Helper function returning the linearly interpolated Vector4 value in the specified Attribute Index for a given point at a given time.\nThe returned Vector is converted from Houdini's coordinate system to Unreal's." ) );
 
 		OutFunctions.Add(Sig);
 	}
 
 	{
-		// GetPointImpulseAtTime
+		// GetPointVectorValueAtTimeByString
 		FNiagaraFunctionSignature Sig;
-		Sig.Name = GetPointImpulseAtTimeName;
+		Sig.Name = GetPointVector4ValueAtTimeByStringName;
 		Sig.bMemberFunction = true;
 		Sig.bRequiresContext = false;
 		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point Number In
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		    // Time in
-		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Impulse")));		// Impulse
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point ID In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		    // Time in		
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec4Def(), TEXT("Value")));			// Vector4 Out
 
-		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointImpulseAtTime",
-			"Helper function returning the linearly interpolated impulse for a given point at a given time.") );
+		Sig.FunctionSpecifiers.Add(FName("Attribute"));
+
+		Sig.SetDescription(LOCTEXT("DataInterfaceHoudini_GetPointVector4ValueAtTimeByString",
+			"Helper function returning the linearly interpolated Vector4 value in the specified attribute (by name) for a given point at a given time.\nThe returned Vector is converted from Houdini's coordinate system to Unreal's."));
 
 		OutFunctions.Add(Sig);
 	}
 
 	{
-		// GetPointTypeAtTime
+		// GetPointVectorValueAtTimeEx
 		FNiagaraFunctionSignature Sig;
-		Sig.Name = GetPointTypeAtTimeName;
+		Sig.Name = GetPointVectorValueAtTimeExName;
 		Sig.bMemberFunction = true;
 		Sig.bRequiresContext = false;
 		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
-		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point Number In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point ID In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("AttributeIndex")));	 // AttributeIndex In
 		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		    // Time in
-		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("Type")));		    // Type
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetBoolDef(), TEXT("DoSwap")));			// DoSwap in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetBoolDef(), TEXT("DoScale")));		// DoScale in
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("Value")));			// Vector3 Out
 
-		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointTypeAtTime",
-			"Helper function returning the integer type for a given point at a given time.") );
+		Sig.SetDescription(LOCTEXT("DataInterfaceHoudini_GetPointVectorValueAtTime",
+			"Helper function returning the linearly interpolated Vector value in the specified attribute index for a given point at a given time.\nThe DoSwap parameter indicates if the vector should be converted from Houdini*s coordinate system to Unreal's.\nThe DoScale parameter decides if the Vector value should be converted from meters (Houdini) to centimeters (Unreal)." ) );
 
 		OutFunctions.Add(Sig);
 	}
 
-}
-
-DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetFloatValue);
-DEFINE_NDI_DIRECT_FUNC_BINDER_WITH_PAYLOAD(UNiagaraDataInterfaceHoudini, GetFloatValueByString);
-DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetVectorValue);
-DEFINE_NDI_DIRECT_FUNC_BINDER_WITH_PAYLOAD(UNiagaraDataInterfaceHoudini, GetVectorValueByString);
-DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetVectorValueEx);
-DEFINE_NDI_DIRECT_FUNC_BINDER_WITH_PAYLOAD(UNiagaraDataInterfaceHoudini, GetVectorValueExByString);
-DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetVector4Value);
-DEFINE_NDI_DIRECT_FUNC_BINDER_WITH_PAYLOAD(UNiagaraDataInterfaceHoudini, GetVector4ValueByString);
-DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetQuatValue);
-DEFINE_NDI_DIRECT_FUNC_BINDER_WITH_PAYLOAD(UNiagaraDataInterfaceHoudini, GetQuatValueByString);
-DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPosition);
-DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetNormal);
-DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetTime);
-DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetColor);
-DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetVelocity);
-DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetImpulse);
-DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPositionAndTime);
-DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetLastSampleIndexAtTime);
-DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointIDsToSpawnAtTime);
-DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetSampleIndexesForPointAtTime);
-DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointPositionAtTime);
-DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointValueAtTime);
-DEFINE_NDI_DIRECT_FUNC_BINDER_WITH_PAYLOAD(UNiagaraDataInterfaceHoudini, GetPointValueAtTimeByString);
-DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVectorValueAtTime);
-DEFINE_NDI_DIRECT_FUNC_BINDER_WITH_PAYLOAD(UNiagaraDataInterfaceHoudini, GetPointVectorValueAtTimeByString);
-DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVectorValueAtTimeEx);
-DEFINE_NDI_DIRECT_FUNC_BINDER_WITH_PAYLOAD(UNiagaraDataInterfaceHoudini, GetPointVectorValueAtTimeExByString);
-DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVector4ValueAtTime);
-DEFINE_NDI_DIRECT_FUNC_BINDER_WITH_PAYLOAD(UNiagaraDataInterfaceHoudini, GetPointVector4ValueAtTimeByString);
-DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointQuatValueAtTime);
-DEFINE_NDI_DIRECT_FUNC_BINDER_WITH_PAYLOAD(UNiagaraDataInterfaceHoudini, GetPointQuatValueAtTimeByString);
-DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointLife);
-DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointLifeAtTime);
-DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointType);
-
-DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointNormalAtTime);
-DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointColorAtTime);
-DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointAlphaAtTime);
-DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVelocityAtTime);
-DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointImpulseAtTime);
-DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointTypeAtTime);
+	{
+		// GetPointVectorValueAtTimeExByString
+		FNiagaraFunctionSignature Sig;
+		Sig.Name = GetPointVectorValueAtTimeExByStringName;
+		Sig.bMemberFunction = true;
+		Sig.bRequiresContext = false;
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point ID In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		    // Time in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetBoolDef(), TEXT("DoSwap")));			// DoSwap in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetBoolDef(), TEXT("DoScale")));		// DoScale in
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("Value")));			// Vector3 Out
 
-void UNiagaraDataInterfaceHoudini::GetVMExternalFunction(const FVMExternalFunctionBindingInfo& BindingInfo, void* InstanceData, FVMExternalFunction &OutFunc)
-{
-	static const FName NAME_Attribute("Attribute");
+		Sig.FunctionSpecifiers.Add(FName("Attribute"));
 
-	const FVMFunctionSpecifier* AttributeSpecifier = BindingInfo.FindSpecifier(NAME_Attribute);
-	bool bAttributeSpecifierRequiredButNotFound = false;
+		Sig.SetDescription(LOCTEXT("DataInterfaceHoudini_GetPointVectorValueAtTimeByString",
+			"Helper function returning the linearly interpolated Vector value in the specified attribute (by name) for a given point at a given time.\nThe DoSwap parameter indicates if the vector should be converted from Houdini*s coordinate system to Unreal's.\nThe DoScale parameter decides if the Vector value should be converted from meters (Houdini) to centimeters (Unreal)."));
 
-	if (BindingInfo.Name == GetFloatValueName && BindingInfo.GetNumInputs() == 2 && BindingInfo.GetNumOutputs() == 1)
-    {
-		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetFloatValue)::Bind(this, OutFunc);
-    }
-    else if (BindingInfo.Name == GetFloatValueByStringName && BindingInfo.GetNumInputs() == 1 && BindingInfo.GetNumOutputs() == 1)
-    {
-		if (AttributeSpecifier)
-		{
-			NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetFloatValueByString)::Bind(this, OutFunc, AttributeSpecifier->Value.ToString());
-		}
-		else
-		{
-			bAttributeSpecifierRequiredButNotFound = true;
-		}
-    }
-    else if (BindingInfo.Name == GetVectorValueName && BindingInfo.GetNumInputs() == 2 && BindingInfo.GetNumOutputs() == 3)
-    {
-		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetVectorValue)::Bind(this, OutFunc);
-    }
-	else if (BindingInfo.Name == GetVectorValueByStringName && BindingInfo.GetNumInputs() == 1 && BindingInfo.GetNumOutputs() == 3)
-	{
-		if (AttributeSpecifier)
-		{
-			NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetVectorValueByString)::Bind(this, OutFunc, AttributeSpecifier->Value.ToString());
-		}
-		else
-		{
-			bAttributeSpecifierRequiredButNotFound = true;
-		}
-	}
-	else if (BindingInfo.Name == GetVectorValueExName && BindingInfo.GetNumInputs() == 4 && BindingInfo.GetNumOutputs() == 3)
-	{
-		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetVectorValueEx)::Bind(this, OutFunc);
+		OutFunctions.Add(Sig);
 	}
-	else if (BindingInfo.Name == GetVectorValueExByStringName && BindingInfo.GetNumInputs() == 3 && BindingInfo.GetNumOutputs() == 3)
+
 	{
-		if (AttributeSpecifier)
-		{
-			NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetVectorValueExByString)::Bind(this, OutFunc, AttributeSpecifier->Value.ToString());
-		}
-		else
-		{
-			bAttributeSpecifierRequiredButNotFound = true;
-		}
+		// GetPointQuatValueAtTime
+		FNiagaraFunctionSignature Sig;
+		Sig.Name = GetPointQuatValueAtTimeName;
+		Sig.bMemberFunction = true;
+		Sig.bRequiresContext = false;
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point ID In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("AttributeIndex")));	 // AttributeIndex In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		    // Time in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetBoolDef(), TEXT("DoHoudiniToUnrealConversion")));		// DoHoudiniToUnrealConversion in
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetQuatDef(), TEXT("Value")));			// Quat Out
+
+		Sig.SetDescription(LOCTEXT("DataInterfaceHoudini_GetPointQuatValueAtTime",
+			"Helper function returning the linearly interpolated Quat value in the specified attribute index for a given point at a given time.\nThe DoHoudiniToUnrealConversion parameter indicates if the vector4 should be converted from Houdini*s coordinate system to Unreal's.\n" ) );
+
+		OutFunctions.Add(Sig);
 	}
-    else if (BindingInfo.Name == GetVector4ValueName && BindingInfo.GetNumInputs() == 2 && BindingInfo.GetNumOutputs() == 4)
-    {
-		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetVector4Value)::Bind(this, OutFunc);
-    }
-	else if (BindingInfo.Name == GetVector4ValueByStringName && BindingInfo.GetNumInputs() == 1 && BindingInfo.GetNumOutputs() == 4)
+
 	{
-		if (AttributeSpecifier)
-		{
-			NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetVector4ValueByString)::Bind(this, OutFunc, AttributeSpecifier->Value.ToString());
-		}
-		else
-		{
-			bAttributeSpecifierRequiredButNotFound = true;
-		}
+		// GetPointQuatValueAtTimeByString
+		FNiagaraFunctionSignature Sig;
+		Sig.Name = GetPointQuatValueAtTimeByStringName;
+		Sig.bMemberFunction = true;
+		Sig.bRequiresContext = false;
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point ID In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		    // Time in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetBoolDef(), TEXT("DoHoudiniToUnrealConversion")));		// DoHoudiniToUnrealConversion in
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetQuatDef(), TEXT("Value")));			// Quat Out
+
+		Sig.FunctionSpecifiers.Add(FName("Attribute"));
+
+		Sig.SetDescription(LOCTEXT("DataInterfaceHoudini_GetPointQuatValueAtTimeByString",
+			"Helper function returning the linearly interpolated Quat value in the specified attribute (by name) for a given point at a given time.\nThe DoHoudiniToUnrealConversion parameter indicates if the vector should be converted from Houdini*s coordinate system to Unreal's.\n"));
+
+		OutFunctions.Add(Sig);
 	}
-	else if (BindingInfo.Name == GetQuatValueName && BindingInfo.GetNumInputs() == 3 && BindingInfo.GetNumOutputs() == 4)
+
 	{
-		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetQuatValue)::Bind(this, OutFunc);
+		// GetPointLife
+		FNiagaraFunctionSignature Sig;
+		Sig.Name = GetPointLifeName;
+		Sig.bMemberFunction = true;
+		Sig.bRequiresContext = false;
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point Number In		
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Life")));			// Float Out
+
+		Sig.SetDescription(LOCTEXT("DataInterfaceHoudini_GetPointLife",
+			"Helper function returning the life value for a given point when spawned.\nThe life value is either calculated from the alive attribute or is the life attribute at spawn time."));
+
+		OutFunctions.Add(Sig);
 	}
-	else if (BindingInfo.Name == GetQuatValueByStringName && BindingInfo.GetNumInputs() == 2 && BindingInfo.GetNumOutputs() == 4)
+
 	{
-		if (AttributeSpecifier)
-		{
-			NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetQuatValueByString)::Bind(this, OutFunc, AttributeSpecifier->Value.ToString());
-		}
-		else
-		{
-			bAttributeSpecifierRequiredButNotFound = true;
-		}
+		// GetPointLifeAtTime
+		FNiagaraFunctionSignature Sig;
+		Sig.Name = GetPointLifeAtTimeName;
+		Sig.bMemberFunction = true;
+		Sig.bRequiresContext = false;
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point Number In		
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		    // Time in		
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Life")));			// Float Out
+
+		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointLifeAtTime",
+			"Helper function returning the remaining life for a given point in the point cache at a given time." ) );
+
+		OutFunctions.Add(Sig);
 	}
-	else if (BindingInfo.Name == GetPositionName && BindingInfo.GetNumInputs() == 1 && BindingInfo.GetNumOutputs() == 3)
-    {
-		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPosition)::Bind(this, OutFunc);
-    }
-    else if (BindingInfo.Name == GetNormalName && BindingInfo.GetNumInputs() == 1 && BindingInfo.GetNumOutputs() == 3)
-    {
-		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetNormal)::Bind(this, OutFunc);
-    }
-    else if (BindingInfo.Name == GetTimeName && BindingInfo.GetNumInputs() == 1 && BindingInfo.GetNumOutputs() == 1)
-    {
-		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetTime)::Bind(this, OutFunc);
-    }
-	else if (BindingInfo.Name == GetVelocityName && BindingInfo.GetNumInputs() == 1 && BindingInfo.GetNumOutputs() == 3)
+
 	{
-		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetVelocity)::Bind(this, OutFunc);
+		// GetPointType
+		FNiagaraFunctionSignature Sig;
+		Sig.Name = GetPointTypeName;
+		Sig.bMemberFunction = true;
+		Sig.bRequiresContext = false;
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point Number In		
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("Type")));			// Int Out
+
+		Sig.SetDescription(LOCTEXT("DataInterfaceHoudini_GetPointType",
+			"Helper function returning the type value for a given point when spawned.\n"));
+
+		OutFunctions.Add(Sig);
 	}
-	else if (BindingInfo.Name == GetColorName && BindingInfo.GetNumInputs() == 1 && BindingInfo.GetNumOutputs() == 4)
+
 	{
-		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetColor)::Bind(this, OutFunc);
+		// GetPointNormalAtTime
+		FNiagaraFunctionSignature Sig;
+		Sig.Name = GetPointNormalAtTimeName;
+		Sig.bMemberFunction = true;
+		Sig.bRequiresContext = false;
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point Number In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		    // Time in
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("Normal")));		// Vector3 Out
+
+		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointNormalAtTime",
+			"Helper function returning the linearly interpolated normal for a given point at a given time.\nThe returned vector is converted from Houdini's coordinate system to Unreal's.") );
+
+		OutFunctions.Add(Sig);
 	}
-	else if (BindingInfo.Name == GetImpulseName && BindingInfo.GetNumInputs() == 1 && BindingInfo.GetNumOutputs() == 1)
+
 	{
-		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetImpulse)::Bind(this, OutFunc);
-	}
-	else if (BindingInfo.Name == GetPositionAndTimeName && BindingInfo.GetNumInputs() == 1 && BindingInfo.GetNumOutputs() == 4)
-    {
-		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPositionAndTime)::Bind(this, OutFunc);
-    }
-    else if ( BindingInfo.Name == GetNumberOfPointsName && BindingInfo.GetNumInputs() == 0 && BindingInfo.GetNumOutputs() == 1 )
-    {
-		OutFunc = FVMExternalFunction::CreateUObject(this, &UNiagaraDataInterfaceHoudini::GetNumberOfPoints);
-    }
-	else if (BindingInfo.Name == GetNumberOfSamplesName && BindingInfo.GetNumInputs() == 0 && BindingInfo.GetNumOutputs() == 1)
+		// GetPointColorAtTime
+		FNiagaraFunctionSignature Sig;
+		Sig.Name = GetPointColorAtTimeName;
+		Sig.bMemberFunction = true;
+		Sig.bRequiresContext = false;
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point Number In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		    // Time in
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("Color")));		    // Vector3 Out
+
+		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointColorAtTime",
+			"Helper function returning the linearly interpolated color for a given point at a given time.") );
+
+		OutFunctions.Add(Sig);
+	}
+
 	{
-		OutFunc = FVMExternalFunction::CreateUObject(this, &UNiagaraDataInterfaceHoudini::GetNumberOfSamples);
+		// GetPointAlphaAtTime
+		FNiagaraFunctionSignature Sig;
+		Sig.Name = GetPointAlphaAtTimeName;
+		Sig.bMemberFunction = true;
+		Sig.bRequiresContext = false;
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point Number In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		    // Time in
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Alpha")));		// Float Out
+
+		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointAlphaAtTime",
+			"Helper function returning the linearly interpolated alpha for a given point at a given time.") );
+
+		OutFunctions.Add(Sig);
 	}
-	else if (BindingInfo.Name == GetNumberOfAttributesName && BindingInfo.GetNumInputs() == 0 && BindingInfo.GetNumOutputs() == 1)
+
 	{
-		OutFunc = FVMExternalFunction::CreateUObject(this, &UNiagaraDataInterfaceHoudini::GetNumberOfAttributes);
+		// GetPointVelocityAtTime
+		FNiagaraFunctionSignature Sig;
+		Sig.Name = GetPointVelocityAtTimeName;
+		Sig.bMemberFunction = true;
+		Sig.bRequiresContext = false;
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point Number In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		    // Time in
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("Velocity")));	    // Vector3 Out
+
+		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointVelocityAtTime",
+			"Helper function returning the linearly interpolated velocity for a given point at a given time.\nThe returned vector is converted from Houdini's coordinate system to Unreal's.") );
+
+		OutFunctions.Add(Sig);
 	}
-    else if (BindingInfo.Name == GetLastSampleIndexAtTimeName && BindingInfo.GetNumInputs() == 1 && BindingInfo.GetNumOutputs() == 1)
-    {
-		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetLastSampleIndexAtTime)::Bind(this, OutFunc);
-    }
-    else if (BindingInfo.Name == GetPointIDsToSpawnAtTimeName && BindingInfo.GetNumInputs() == 5 && BindingInfo.GetNumOutputs() == 6)
-    {
-		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointIDsToSpawnAtTime)::Bind(this, OutFunc);
-    }
-	else if (BindingInfo.Name == GetSampleIndexesForPointAtTimeName && BindingInfo.GetNumInputs() == 2 && BindingInfo.GetNumOutputs() == 3)
+
 	{
-		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetSampleIndexesForPointAtTime)::Bind(this, OutFunc);
+		// GetPointNormalAtTimeWithCursor
+		FNiagaraFunctionSignature Sig;
+		Sig.Name = GetPointNormalAtTimeWithCursorName;
+		Sig.bMemberFunction = true;
+		Sig.bRequiresContext = false;
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));		// Point ID In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		// Time in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));	// Cursor In
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("Normal")));		// Vector3 Out
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));	// Cursor Out
+
+		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointNormalAtTimeWithCursor",
+			"Same as GetPointNormalAtTime, resuming the search from a sample cursor.\nStore the returned cursor in a particle attribute initialized to -1 and pass it back on the next call for the same point.") );
+
+		OutFunctions.Add(Sig);
 	}
-	else if (BindingInfo.Name == GetPointPositionAtTimeName && BindingInfo.GetNumInputs() == 2 && BindingInfo.GetNumOutputs() == 3)
+
 	{
-		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointPositionAtTime)::Bind(this, OutFunc);
+		// GetPointColorAtTimeWithCursor
+		FNiagaraFunctionSignature Sig;
+		Sig.Name = GetPointColorAtTimeWithCursorName;
+		Sig.bMemberFunction = true;
+		Sig.bRequiresContext = false;
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));		// Point ID In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		// Time in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));	// Cursor In
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("Color")));		// Vector3 Out
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));	// Cursor Out
+
+		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointColorAtTimeWithCursor",
+			"Same as GetPointColorAtTime, resuming the search from a sample cursor.\nStore the returned cursor in a particle attribute initialized to -1 and pass it back on the next call for the same point.") );
+
+		OutFunctions.Add(Sig);
 	}
-	else if (BindingInfo.Name == GetPointValueAtTimeName && BindingInfo.GetNumInputs() == 3 && BindingInfo.GetNumOutputs() == 1)
+
 	{
-		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointValueAtTime)::Bind(this, OutFunc);
+		// GetPointAlphaAtTimeWithCursor
+		FNiagaraFunctionSignature Sig;
+		Sig.Name = GetPointAlphaAtTimeWithCursorName;
+		Sig.bMemberFunction = true;
+		Sig.bRequiresContext = false;
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));		// Point ID In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		// Time in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));	// Cursor In
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Alpha")));		// Float Out
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));	// Cursor Out
+
+		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointAlphaAtTimeWithCursor",
+			"Same as GetPointAlphaAtTime, resuming the search from a sample cursor.\nStore the returned cursor in a particle attribute initialized to -1 and pass it back on the next call for the same point.") );
+
+		OutFunctions.Add(Sig);
+	}
+
+	{
+		// GetPointVelocityAtTimeWithCursor
+		FNiagaraFunctionSignature Sig;
+		Sig.Name = GetPointVelocityAtTimeWithCursorName;
+		Sig.bMemberFunction = true;
+		Sig.bRequiresContext = false;
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));		// Point ID In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		// Time in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));	// Cursor In
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("Velocity")));		// Vector3 Out
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SampleCursor")));	// Cursor Out
+
+		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointVelocityAtTimeWithCursor",
+			"Same as GetPointVelocityAtTime, resuming the search from a sample cursor.\nStore the returned cursor in a particle attribute initialized to -1 and pass it back on the next call for the same point.") );
+
+		OutFunctions.Add(Sig);
+	}
+
+	{
+		// GetPointAttributesAtTime
+		FNiagaraFunctionSignature Sig;
+		Sig.Name = GetPointAttributesAtTimeName;
+		Sig.bMemberFunction = true;
+		Sig.bRequiresContext = false;
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point Number In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		    // Time in
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("Position")));		// Vector3 Out
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("Velocity")));	    // Vector3 Out
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("Normal")));		// Vector3 Out
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("Color")));		    // Vector3 Out
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Alpha")));		// Float Out
+
+		Sig.FunctionSpecifiers.Add(FName("Attributes"));
+
+		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointAttributesAtTime",
+			"Helper function returning the linearly interpolated position, velocity, normal, color and alpha for a given point at a given time, searching the point's samples only once.\nThe Attributes specifier selects the attributes to read (ie \"Position, Velocity, Color\"), all of them are read if it is left empty. Attributes that are not read are returned as zero.\nThe returned position, velocity and normal are converted from Houdini's coordinate system to Unreal's.") );
+
+		OutFunctions.Add(Sig);
+	}
+
+	{
+		// GetPointImpulseAtTime
+		FNiagaraFunctionSignature Sig;
+		Sig.Name = GetPointImpulseAtTimeName;
+		Sig.bMemberFunction = true;
+		Sig.bRequiresContext = false;
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point Number In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		    // Time in
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Impulse")));		// Impulse
+
+		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointImpulseAtTime",
+			"Helper function returning the linearly interpolated impulse for a given point at a given time.") );
+
+		OutFunctions.Add(Sig);
+	}
+
+	{
+		// GetPointTypeAtTime
+		FNiagaraFunctionSignature Sig;
+		Sig.Name = GetPointTypeAtTimeName;
+		Sig.bMemberFunction = true;
+		Sig.bRequiresContext = false;
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("PointCache")));		// PointCache in
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PointID")));			// Point Number In
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("Time")));		    // Time in
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("Type")));		    // Type
+
+		Sig.SetDescription( LOCTEXT( "DataInterfaceHoudini_GetPointTypeAtTime",
+			"Helper function returning the integer type for a given point at a given time.") );
+
+		OutFunctions.Add(Sig);
 	}
-	else if (BindingInfo.Name == GetPointValueAtTimeByStringName && BindingInfo.GetNumInputs() == 2 && BindingInfo.GetNumOutputs() == 1)
+
+}
+
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetFloatValue);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetIntValue);
+DEFINE_NDI_DIRECT_FUNC_BINDER_WITH_PAYLOAD(UNiagaraDataInterfaceHoudini, GetFloatValueByString);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetVectorValue);
+DEFINE_NDI_DIRECT_FUNC_BINDER_WITH_PAYLOAD(UNiagaraDataInterfaceHoudini, GetVectorValueByString);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetVectorValueEx);
+DEFINE_NDI_DIRECT_FUNC_BINDER_WITH_PAYLOAD(UNiagaraDataInterfaceHoudini, GetVectorValueExByString);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetVector4Value);
+DEFINE_NDI_DIRECT_FUNC_BINDER_WITH_PAYLOAD(UNiagaraDataInterfaceHoudini, GetVector4ValueByString);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetQuatValue);
+DEFINE_NDI_DIRECT_FUNC_BINDER_WITH_PAYLOAD(UNiagaraDataInterfaceHoudini, GetQuatValueByString);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPosition);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetNormal);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetTime);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetColor);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetVelocity);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetImpulse);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPositionAndTime);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetLastSampleIndexAtTime);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointIDsToSpawnAtTime);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetAlivePointsAtTime);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointIDsToSpawn);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetSampleIndexesForPointAtTime);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetSampleIndexesForPointAtTimeWithCursor);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointPositionAtTimeWithCursor);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointValueAtTimeWithCursor);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVectorValueAtTimeWithCursor);
+DEFINE_NDI_DIRECT_FUNC_BINDER_WITH_PAYLOAD(UNiagaraDataInterfaceHoudini, GetPointValueAtTimeWithCursorByString);
+DEFINE_NDI_DIRECT_FUNC_BINDER_WITH_PAYLOAD(UNiagaraDataInterfaceHoudini, GetPointVectorValueAtTimeWithCursorByString);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVectorValueAtTimeExWithCursor);
+DEFINE_NDI_DIRECT_FUNC_BINDER_WITH_PAYLOAD(UNiagaraDataInterfaceHoudini, GetPointVectorValueAtTimeExWithCursorByString);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVector4ValueAtTimeWithCursor);
+DEFINE_NDI_DIRECT_FUNC_BINDER_WITH_PAYLOAD(UNiagaraDataInterfaceHoudini, GetPointVector4ValueAtTimeWithCursorByString);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointQuatValueAtTimeWithCursor);
+DEFINE_NDI_DIRECT_FUNC_BINDER_WITH_PAYLOAD(UNiagaraDataInterfaceHoudini, GetPointQuatValueAtTimeWithCursorByString);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointPositionAtTime);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointValueAtTime);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointIntValueAtTime);
+DEFINE_NDI_DIRECT_FUNC_BINDER_WITH_PAYLOAD(UNiagaraDataInterfaceHoudini, GetPointValueAtTimeByString);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVectorValueAtTime);
+DEFINE_NDI_DIRECT_FUNC_BINDER_WITH_PAYLOAD(UNiagaraDataInterfaceHoudini, GetPointVectorValueAtTimeByString);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVectorValueAtTimeEx);
+DEFINE_NDI_DIRECT_FUNC_BINDER_WITH_PAYLOAD(UNiagaraDataInterfaceHoudini, GetPointVectorValueAtTimeExByString);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVector4ValueAtTime);
+DEFINE_NDI_DIRECT_FUNC_BINDER_WITH_PAYLOAD(UNiagaraDataInterfaceHoudini, GetPointVector4ValueAtTimeByString);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointQuatValueAtTime);
+DEFINE_NDI_DIRECT_FUNC_BINDER_WITH_PAYLOAD(UNiagaraDataInterfaceHoudini, GetPointQuatValueAtTimeByString);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointLife);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointLifeAtTime);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointType);
+
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointNormalAtTime);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointColorAtTime);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointAlphaAtTime);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVelocityAtTime);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointNormalAtTimeWithCursor);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointColorAtTimeWithCursor);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointAlphaAtTimeWithCursor);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVelocityAtTimeWithCursor);
+DEFINE_NDI_DIRECT_FUNC_BINDER_WITH_PAYLOAD(UNiagaraDataInterfaceHoudini, GetPointAttributesAtTime);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointImpulseAtTime);
+DEFINE_NDI_DIRECT_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointTypeAtTime);
+
+void UNiagaraDataInterfaceHoudini::GetVMExternalFunction(const FVMExternalFunctionBindingInfo& BindingInfo, void* InstanceData, FVMExternalFunction &OutFunc)
+{
+	static const FName NAME_Attribute("Attribute");
+
+	const FVMFunctionSpecifier* AttributeSpecifier = BindingInfo.FindSpecifier(NAME_Attribute);
+	bool bAttributeSpecifierRequiredButNotFound = false;
+
+	if (BindingInfo.Name == GetFloatValueName && BindingInfo.GetNumInputs() == 3 && BindingInfo.GetNumOutputs() == 1)
+    {
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetFloatValue)::Bind(this, OutFunc);
+    }
+	else if (BindingInfo.Name == GetIntValueName && BindingInfo.GetNumInputs() == 3 && BindingInfo.GetNumOutputs() == 1)
 	{
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetIntValue)::Bind(this, OutFunc);
+	}
+    else if (BindingInfo.Name == GetFloatValueByStringName && BindingInfo.GetNumInputs() == 2 && BindingInfo.GetNumOutputs() == 1)
+    {
 		if (AttributeSpecifier)
 		{
-			NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointValueAtTimeByString)::Bind(this, OutFunc, AttributeSpecifier->Value.ToString());
+			NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetFloatValueByString)::Bind(this, OutFunc, ResolveAttributeIndex(AttributeSpecifier->Value.ToString()));
 		}
 		else
 		{
 			bAttributeSpecifierRequiredButNotFound = true;
 		}
-	}
-	else if (BindingInfo.Name == GetPointVectorValueAtTimeName && BindingInfo.GetNumInputs() == 3 && BindingInfo.GetNumOutputs() == 3)
-	{
-		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVectorValueAtTime)::Bind(this, OutFunc);
-	}
-	else if (BindingInfo.Name == GetPointVectorValueAtTimeByStringName && BindingInfo.GetNumInputs() == 2 && BindingInfo.GetNumOutputs() == 3)
+    }
+    else if (BindingInfo.Name == GetVectorValueName && BindingInfo.GetNumInputs() == 3 && BindingInfo.GetNumOutputs() == 3)
+    {
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetVectorValue)::Bind(this, OutFunc);
+    }
+	else if (BindingInfo.Name == GetVectorValueByStringName && BindingInfo.GetNumInputs() == 2 && BindingInfo.GetNumOutputs() == 3)
 	{
 		if (AttributeSpecifier)
 		{
-			NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVectorValueAtTimeByString)::Bind(this, OutFunc, AttributeSpecifier->Value.ToString());
+			NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetVectorValueByString)::Bind(this, OutFunc, ResolveAttributeIndex(AttributeSpecifier->Value.ToString()));
 		}
 		else
 		{
 			bAttributeSpecifierRequiredButNotFound = true;
 		}
 	}
-	else if (BindingInfo.Name == GetPointVector4ValueAtTimeName && BindingInfo.GetNumInputs() == 3 && BindingInfo.GetNumOutputs() == 4)
+	else if (BindingInfo.Name == GetVectorValueExName && BindingInfo.GetNumInputs() == 5 && BindingInfo.GetNumOutputs() == 3)
 	{
-		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVector4ValueAtTime)::Bind(this, OutFunc);
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetVectorValueEx)::Bind(this, OutFunc);
 	}
-	else if (BindingInfo.Name == GetPointVector4ValueAtTimeByStringName && BindingInfo.GetNumInputs() == 2 && BindingInfo.GetNumOutputs() == 4)
+	else if (BindingInfo.Name == GetVectorValueExByStringName && BindingInfo.GetNumInputs() == 4 && BindingInfo.GetNumOutputs() == 3)
 	{
 		if (AttributeSpecifier)
 		{
-			NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVector4ValueAtTimeByString)::Bind(this, OutFunc, AttributeSpecifier->Value.ToString());
+			NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetVectorValueExByString)::Bind(this, OutFunc, ResolveAttributeIndex(AttributeSpecifier->Value.ToString()));
 		}
 		else
 		{
 			bAttributeSpecifierRequiredButNotFound = true;
 		}
 	}
-	else if (BindingInfo.Name == GetPointVectorValueAtTimeExName && BindingInfo.GetNumInputs() == 5 && BindingInfo.GetNumOutputs() == 3)
-	{
-		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVectorValueAtTimeEx)::Bind(this, OutFunc);
-	}
-	else if (BindingInfo.Name == GetPointVectorValueAtTimeExByStringName && BindingInfo.GetNumInputs() == 4 && BindingInfo.GetNumOutputs() == 3)
+    else if (BindingInfo.Name == GetVector4ValueName && BindingInfo.GetNumInputs() == 3 && BindingInfo.GetNumOutputs() == 4)
+    {
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetVector4Value)::Bind(this, OutFunc);
+    }
+	else if (BindingInfo.Name == GetVector4ValueByStringName && BindingInfo.GetNumInputs() == 2 && BindingInfo.GetNumOutputs() == 4)
 	{
 		if (AttributeSpecifier)
 		{
-			NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVectorValueAtTimeExByString)::Bind(this, OutFunc, AttributeSpecifier->Value.ToString());
+			NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetVector4ValueByString)::Bind(this, OutFunc, ResolveAttributeIndex(AttributeSpecifier->Value.ToString()));
 		}
 		else
 		{
 			bAttributeSpecifierRequiredButNotFound = true;
 		}
 	}
-	else if (BindingInfo.Name == GetPointQuatValueAtTimeName && BindingInfo.GetNumInputs() == 4 && BindingInfo.GetNumOutputs() == 4)
+	else if (BindingInfo.Name == GetQuatValueName && BindingInfo.GetNumInputs() == 4 && BindingInfo.GetNumOutputs() == 4)
 	{
-		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointQuatValueAtTime)::Bind(this, OutFunc);
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetQuatValue)::Bind(this, OutFunc);
 	}
-	else if (BindingInfo.Name == GetPointQuatValueAtTimeByStringName && BindingInfo.GetNumInputs() == 3 && BindingInfo.GetNumOutputs() == 4)
+	else if (BindingInfo.Name == GetQuatValueByStringName && BindingInfo.GetNumInputs() == 3 && BindingInfo.GetNumOutputs() == 4)
 	{
 		if (AttributeSpecifier)
 		{
-			NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointQuatValueAtTimeByString)::Bind(this, OutFunc, AttributeSpecifier->Value.ToString());
+			NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetQuatValueByString)::Bind(this, OutFunc, ResolveAttributeIndex(AttributeSpecifier->Value.ToString()));
 		}
 		else
 		{
 			bAttributeSpecifierRequiredButNotFound = true;
 		}
 	}
-	else if (BindingInfo.Name == GetPointLifeName && BindingInfo.GetNumInputs() == 1 && BindingInfo.GetNumOutputs() == 1)
+	else if (BindingInfo.Name == GetPositionName && BindingInfo.GetNumInputs() == 2 && BindingInfo.GetNumOutputs() == 3)
+    {
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPosition)::Bind(this, OutFunc);
+    }
+    else if (BindingInfo.Name == GetNormalName && BindingInfo.GetNumInputs() == 2 && BindingInfo.GetNumOutputs() == 3)
+    {
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetNormal)::Bind(this, OutFunc);
+    }
+    else if (BindingInfo.Name == GetTimeName && BindingInfo.GetNumInputs() == 2 && BindingInfo.GetNumOutputs() == 1)
+    {
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetTime)::Bind(this, OutFunc);
+    }
+	else if (BindingInfo.Name == GetVelocityName && BindingInfo.GetNumInputs() == 2 && BindingInfo.GetNumOutputs() == 3)
 	{
-		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointLife)::Bind(this, OutFunc);
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetVelocity)::Bind(this, OutFunc);
 	}
-	else if (BindingInfo.Name == GetPointLifeAtTimeName && BindingInfo.GetNumInputs() == 2 && BindingInfo.GetNumOutputs() == 1)
+	else if (BindingInfo.Name == GetColorName && BindingInfo.GetNumInputs() == 2 && BindingInfo.GetNumOutputs() == 4)
 	{
-		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointLifeAtTime)::Bind(this, OutFunc);
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetColor)::Bind(this, OutFunc);
 	}
-	else if (BindingInfo.Name == GetPointTypeName && BindingInfo.GetNumInputs() == 1 && BindingInfo.GetNumOutputs() == 1)
+	else if (BindingInfo.Name == GetImpulseName && BindingInfo.GetNumInputs() == 2 && BindingInfo.GetNumOutputs() == 1)
 	{
-		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointType)::Bind(this, OutFunc);
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetImpulse)::Bind(this, OutFunc);
 	}
-	else if (BindingInfo.Name == GetPointNormalAtTimeName && BindingInfo.GetNumInputs() == 2 && BindingInfo.GetNumOutputs() == 3)
+	else if (BindingInfo.Name == GetPositionAndTimeName && BindingInfo.GetNumInputs() == 2 && BindingInfo.GetNumOutputs() == 4)
+    {
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPositionAndTime)::Bind(this, OutFunc);
+    }
+    else if ( BindingInfo.Name == GetNumberOfPointsName && BindingInfo.GetNumInputs() == 1 && BindingInfo.GetNumOutputs() == 1 )
+    {
+		OutFunc = FVMExternalFunction::CreateUObject(this, &UNiagaraDataInterfaceHoudini::GetNumberOfPoints);
+    }
+	else if (BindingInfo.Name == GetNumberOfSamplesName && BindingInfo.GetNumInputs() == 1 && BindingInfo.GetNumOutputs() == 1)
 	{
-		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointNormalAtTime)::Bind(this, OutFunc);
+		OutFunc = FVMExternalFunction::CreateUObject(this, &UNiagaraDataInterfaceHoudini::GetNumberOfSamples);
 	}
-	else if (BindingInfo.Name == GetPointColorAtTimeName && BindingInfo.GetNumInputs() == 2 && BindingInfo.GetNumOutputs() == 3)
+	else if (BindingInfo.Name == GetNumberOfAttributesName && BindingInfo.GetNumInputs() == 1 && BindingInfo.GetNumOutputs() == 1)
 	{
-		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointColorAtTime)::Bind(this, OutFunc);
+		OutFunc = FVMExternalFunction::CreateUObject(this, &UNiagaraDataInterfaceHoudini::GetNumberOfAttributes);
 	}
-	else if (BindingInfo.Name == GetPointAlphaAtTimeName && BindingInfo.GetNumInputs() == 2 && BindingInfo.GetNumOutputs() == 1)
+    else if (BindingInfo.Name == GetLastSampleIndexAtTimeName && BindingInfo.GetNumInputs() == 2 && BindingInfo.GetNumOutputs() == 1)
+    {
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetLastSampleIndexAtTime)::Bind(this, OutFunc);
+    }
+    else if (BindingInfo.Name == GetPointIDsToSpawnAtTimeName && BindingInfo.GetNumInputs() == 6 && BindingInfo.GetNumOutputs() == 6)
+    {
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointIDsToSpawnAtTime)::Bind(this, OutFunc);
+    }
+	else if (BindingInfo.Name == GetAlivePointsAtTimeName && BindingInfo.GetNumInputs() == 2 && BindingInfo.GetNumOutputs() == 3)
 	{
-		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointAlphaAtTime)::Bind(this, OutFunc);
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetAlivePointsAtTime)::Bind(this, OutFunc);
 	}
-	else if (BindingInfo.Name == GetPointVelocityAtTimeName && BindingInfo.GetNumInputs() == 2 && BindingInfo.GetNumOutputs() == 3)
+	else if (BindingInfo.Name == GetPointIDsToSpawnName && BindingInfo.GetNumInputs() == 1 && BindingInfo.GetNumOutputs() == 3)
 	{
-		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVelocityAtTime)::Bind(this, OutFunc);
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointIDsToSpawn)::Bind(this, OutFunc);
 	}
-	else if (BindingInfo.Name == GetPointImpulseAtTimeName && BindingInfo.GetNumInputs() == 2 && BindingInfo.GetNumOutputs() == 1)
+	else if (BindingInfo.Name == GetSampleIndexesForPointAtTimeName && BindingInfo.GetNumInputs() == 3 && BindingInfo.GetNumOutputs() == 3)
 	{
-		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointImpulseAtTime)::Bind(this, OutFunc);
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetSampleIndexesForPointAtTime)::Bind(this, OutFunc);
+	}
+	else if (BindingInfo.Name == GetPointPositionAtTimeName && BindingInfo.GetNumInputs() == 3 && BindingInfo.GetNumOutputs() == 3)
+	{
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointPositionAtTime)::Bind(this, OutFunc);
+	}
+	else if (BindingInfo.Name == GetSampleIndexesForPointAtTimeWithCursorName && BindingInfo.GetNumInputs() == 4 && BindingInfo.GetNumOutputs() == 4)
+	{
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetSampleIndexesForPointAtTimeWithCursor)::Bind(this, OutFunc);
+	}
+	else if (BindingInfo.Name == GetPointPositionAtTimeWithCursorName && BindingInfo.GetNumInputs() == 4 && BindingInfo.GetNumOutputs() == 4)
+	{
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointPositionAtTimeWithCursor)::Bind(this, OutFunc);
+	}
+	else if (BindingInfo.Name == GetPointValueAtTimeWithCursorName && BindingInfo.GetNumInputs() == 5 && BindingInfo.GetNumOutputs() == 2)
+	{
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointValueAtTimeWithCursor)::Bind(this, OutFunc);
+	}
+	else if (BindingInfo.Name == GetPointVectorValueAtTimeWithCursorName && BindingInfo.GetNumInputs() == 5 && BindingInfo.GetNumOutputs() == 4)
+	{
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVectorValueAtTimeWithCursor)::Bind(this, OutFunc);
+	}
+	else if (BindingInfo.Name == GetPointValueAtTimeWithCursorByStringName && BindingInfo.GetNumInputs() == 4 && BindingInfo.GetNumOutputs() == 2)
+	{
+		if (AttributeSpecifier)
+		{
+			NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointValueAtTimeWithCursorByString)::Bind(this, OutFunc, ResolveAttributeIndex(AttributeSpecifier->Value.ToString()));
+		}
+		else
+		{
+			bAttributeSpecifierRequiredButNotFound = true;
+		}
+	}
+	else if (BindingInfo.Name == GetPointVectorValueAtTimeWithCursorByStringName && BindingInfo.GetNumInputs() == 4 && BindingInfo.GetNumOutputs() == 4)
+	{
+		if (AttributeSpecifier)
+		{
+			NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVectorValueAtTimeWithCursorByString)::Bind(this, OutFunc, ResolveAttributeIndex(AttributeSpecifier->Value.ToString()));
+		}
+		else
+		{
+			bAttributeSpecifierRequiredButNotFound = true;
+		}
+	}
+	else if (BindingInfo.Name == GetPointVectorValueAtTimeExWithCursorName && BindingInfo.GetNumInputs() == 7 && BindingInfo.GetNumOutputs() == 4)
+	{
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVectorValueAtTimeExWithCursor)::Bind(this, OutFunc);
+	}
+	else if (BindingInfo.Name == GetPointVectorValueAtTimeExWithCursorByStringName && BindingInfo.GetNumInputs() == 6 && BindingInfo.GetNumOutputs() == 4)
+	{
+		if (AttributeSpecifier)
+		{
+			NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVectorValueAtTimeExWithCursorByString)::Bind(this, OutFunc, ResolveAttributeIndex(AttributeSpecifier->Value.ToString()));
+		}
+		else
+		{
+			bAttributeSpecifierRequiredButNotFound = true;
+		}
+	}
+	else if (BindingInfo.Name == GetPointVector4ValueAtTimeWithCursorName && BindingInfo.GetNumInputs() == 5 && BindingInfo.GetNumOutputs() == 5)
+	{
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVector4ValueAtTimeWithCursor)::Bind(this, OutFunc);
+	}
+	else if (BindingInfo.Name == GetPointVector4ValueAtTimeWithCursorByStringName && BindingInfo.GetNumInputs() == 4 && BindingInfo.GetNumOutputs() == 5)
+	{
+		if (AttributeSpecifier)
+		{
+			NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVector4ValueAtTimeWithCursorByString)::Bind(this, OutFunc, ResolveAttributeIndex(AttributeSpecifier->Value.ToString()));
+		}
+		else
+		{
+			bAttributeSpecifierRequiredButNotFound = true;
+		}
+	}
+	else if (BindingInfo.Name == GetPointQuatValueAtTimeWithCursorName && BindingInfo.GetNumInputs() == 6 && BindingInfo.GetNumOutputs() == 5)
+	{
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointQuatValueAtTimeWithCursor)::Bind(this, OutFunc);
+	}
+	else if (BindingInfo.Name == GetPointQuatValueAtTimeWithCursorByStringName && BindingInfo.GetNumInputs() == 5 && BindingInfo.GetNumOutputs() == 5)
+	{
+		if (AttributeSpecifier)
+		{
+			NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointQuatValueAtTimeWithCursorByString)::Bind(this, OutFunc, ResolveAttributeIndex(AttributeSpecifier->Value.ToString()));
+		}
+		else
+		{
+			bAttributeSpecifierRequiredButNotFound = true;
+		}
+	}
+	else if (BindingInfo.Name == GetPointValueAtTimeName && BindingInfo.GetNumInputs() == 4 && BindingInfo.GetNumOutputs() == 1)
+	{
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointValueAtTime)::Bind(this, OutFunc);
+	}
+	else if (BindingInfo.Name == GetPointIntValueAtTimeName && BindingInfo.GetNumInputs() == 4 && BindingInfo.GetNumOutputs() == 1)
+	{
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointIntValueAtTime)::Bind(this, OutFunc);
+	}
+	else if (BindingInfo.Name == GetPointValueAtTimeByStringName && BindingInfo.GetNumInputs() == 3 && BindingInfo.GetNumOutputs() == 1)
+	{
+		if (AttributeSpecifier)
+		{
+			NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointValueAtTimeByString)::Bind(this, OutFunc, ResolveAttributeIndex(AttributeSpecifier->Value.ToString()));
+		}
+		else
+		{
+			bAttributeSpecifierRequiredButNotFound = true;
+		}
+	}
+	else if (BindingInfo.Name == GetPointVectorValueAtTimeName && BindingInfo.GetNumInputs() == 4 && BindingInfo.GetNumOutputs() == 3)
+	{
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVectorValueAtTime)::Bind(this, OutFunc);
+	}
+	else if (BindingInfo.Name == GetPointVectorValueAtTimeByStringName && BindingInfo.GetNumInputs() == 3 && BindingInfo.GetNumOutputs() == 3)
+	{
+		if (AttributeSpecifier)
+		{
+			NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVectorValueAtTimeByString)::Bind(this, OutFunc, ResolveAttributeIndex(AttributeSpecifier->Value.ToString()));
+		}
+		else
+		{
+			bAttributeSpecifierRequiredButNotFound = true;
+		}
+	}
+	else if (BindingInfo.Name == GetPointVector4ValueAtTimeName && BindingInfo.GetNumInputs() == 4 && BindingInfo.GetNumOutputs() == 4)
+	{
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVector4ValueAtTime)::Bind(this, OutFunc);
+	}
+	else if (BindingInfo.Name == GetPointVector4ValueAtTimeByStringName && BindingInfo.GetNumInputs() == 3 && BindingInfo.GetNumOutputs() == 4)
+	{
+		if (AttributeSpecifier)
+		{
+			NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVector4ValueAtTimeByString)::Bind(this, OutFunc, ResolveAttributeIndex(AttributeSpecifier->Value.ToString()));
+		}
+		else
+		{
+			bAttributeSpecifierRequiredButNotFound = true;
+		}
+	}
+	else if (BindingInfo.Name == GetPointVectorValueAtTimeExName && BindingInfo.GetNumInputs() == 6 && BindingInfo.GetNumOutputs() == 3)
+	{
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVectorValueAtTimeEx)::Bind(this, OutFunc);
+	}
+	else if (BindingInfo.Name == GetPointVectorValueAtTimeExByStringName && BindingInfo.GetNumInputs() == 5 && BindingInfo.GetNumOutputs() == 3)
+	{
+		if (AttributeSpecifier)
+		{
+			NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVectorValueAtTimeExByString)::Bind(this, OutFunc, ResolveAttributeIndex(AttributeSpecifier->Value.ToString()));
+		}
+		else
+		{
+			bAttributeSpecifierRequiredButNotFound = true;
+		}
+	}
+	else if (BindingInfo.Name == GetPointQuatValueAtTimeName && BindingInfo.GetNumInputs() == 5 && BindingInfo.GetNumOutputs() == 4)
+	{
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointQuatValueAtTime)::Bind(this, OutFunc);
+	}
+	else if (BindingInfo.Name == GetPointQuatValueAtTimeByStringName && BindingInfo.GetNumInputs() == 4 && BindingInfo.GetNumOutputs() == 4)
+	{
+		if (AttributeSpecifier)
+		{
+			NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointQuatValueAtTimeByString)::Bind(this, OutFunc, ResolveAttributeIndex(AttributeSpecifier->Value.ToString()));
+		}
+		else
+		{
+			bAttributeSpecifierRequiredButNotFound = true;
+		}
+	}
+	else if (BindingInfo.Name == GetPointLifeName && BindingInfo.GetNumInputs() == 2 && BindingInfo.GetNumOutputs() == 1)
+	{
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointLife)::Bind(this, OutFunc);
 	}
-	else if (BindingInfo.Name == GetPointTypeAtTimeName && BindingInfo.GetNumInputs() == 2 && BindingInfo.GetNumOutputs() == 1)
+	else if (BindingInfo.Name == GetPointLifeAtTimeName && BindingInfo.GetNumInputs() == 3 && BindingInfo.GetNumOutputs() == 1)
+	{
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointLifeAtTime)::Bind(this, OutFunc);
+	}
+	else if (BindingInfo.Name == GetPointTypeName && BindingInfo.GetNumInputs() == 2 && BindingInfo.GetNumOutputs() == 1)
+	{
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointType)::Bind(this, OutFunc);
+	}
+	else if (BindingInfo.Name == GetPointNormalAtTimeName && BindingInfo.GetNumInputs() == 3 && BindingInfo.GetNumOutputs() == 3)
+	{
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointNormalAtTime)::Bind(this, OutFunc);
+	}
+	else if (BindingInfo.Name == GetPointColorAtTimeName && BindingInfo.GetNumInputs() == 3 && BindingInfo.GetNumOutputs() == 3)
+	{
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointColorAtTime)::Bind(this, OutFunc);
+	}
+	else if (BindingInfo.Name == GetPointAlphaAtTimeName && BindingInfo.GetNumInputs() == 3 && BindingInfo.GetNumOutputs() == 1)
+	{
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointAlphaAtTime)::Bind(this, OutFunc);
+	}
+	else if (BindingInfo.Name == GetPointVelocityAtTimeName && BindingInfo.GetNumInputs() == 3 && BindingInfo.GetNumOutputs() == 3)
+	{
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVelocityAtTime)::Bind(this, OutFunc);
+	}
+	else if (BindingInfo.Name == GetPointNormalAtTimeWithCursorName && BindingInfo.GetNumInputs() == 4 && BindingInfo.GetNumOutputs() == 4)
+	{
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointNormalAtTimeWithCursor)::Bind(this, OutFunc);
+	}
+	else if (BindingInfo.Name == GetPointColorAtTimeWithCursorName && BindingInfo.GetNumInputs() == 4 && BindingInfo.GetNumOutputs() == 4)
+	{
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointColorAtTimeWithCursor)::Bind(this, OutFunc);
+	}
+	else if (BindingInfo.Name == GetPointAlphaAtTimeWithCursorName && BindingInfo.GetNumInputs() == 4 && BindingInfo.GetNumOutputs() == 2)
+	{
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointAlphaAtTimeWithCursor)::Bind(this, OutFunc);
+	}
+	else if (BindingInfo.Name == GetPointVelocityAtTimeWithCursorName && BindingInfo.GetNumInputs() == 4 && BindingInfo.GetNumOutputs() == 4)
+	{
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointVelocityAtTimeWithCursor)::Bind(this, OutFunc);
+	}
+	else if (BindingInfo.Name == GetPointAttributesAtTimeName && BindingInfo.GetNumInputs() == 3 && BindingInfo.GetNumOutputs() == 13)
+	{
+		const FVMFunctionSpecifier* AttributesSpecifier = BindingInfo.FindSpecifier(FName("Attributes"));
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointAttributesAtTime)::Bind(this, OutFunc, GetPointAttributesMaskFromSpecifier(AttributesSpecifier ? &AttributesSpecifier->Value : nullptr));
+	}
+	else if (BindingInfo.Name == GetPointImpulseAtTimeName && BindingInfo.GetNumInputs() == 3 && BindingInfo.GetNumOutputs() == 1)
+	{
+		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointImpulseAtTime)::Bind(this, OutFunc);
+	}
+	else if (BindingInfo.Name == GetPointTypeAtTimeName && BindingInfo.GetNumInputs() == 3 && BindingInfo.GetNumOutputs() == 1)
 	{
 		NDI_FUNC_BINDER(UNiagaraDataInterfaceHoudini, GetPointTypeAtTime)::Bind(this, OutFunc);
 	}
@@ -1299,609 +2188,1436 @@ void UNiagaraDataInterfaceHoudini::GetVMExternalFunction(const FVMExternalFuncti
 	}
 }
 
-void UNiagaraDataInterfaceHoudini::GetFloatValue(FVectorVMExternalFunctionContext& Context)
+// Returns the sample indexes of the points of a VM batch at a given time.
+// When the time input is constant over the batch and the point cache has a fixed topology, the frame bracket only depends
+// on the time: it is computed once, and each point's sample indexes are then read directly from the dense frame block.
+// If the time is the one the system instance's data was precomputed for, the instance's frame bracket is reused.
+// When the point cache shares its evaluations, values at a constant time are read from the point cache's shared evaluations instead.
+struct FHoudiniPointSampleIndexesAtTime
+{
+	FHoudiniPointSampleIndexesAtTime(const UHoudiniPointCache* InAsset, const VectorVM::FExternalFuncInputHandler<float>& TimeParam, const FHoudiniNiagaraInstanceData* InstData = nullptr)
+		: Asset(InAsset)
+	{
+		if ( Asset && TimeParam.IsConstant() && Asset->bShareEvaluations )
+		{
+			bUseSharedEvaluation = true;
+			SharedEvaluationTime = TimeParam.Get();
+		}
+
+		if ( Asset && TimeParam.IsConstant() && Asset->HasFixedTopology() )
+		{
+			NumberOfPoints = Asset->NumberOfPoints;
+			if ( InstData && InstData->bHasFrameIndexes && InstData->Time == TimeParam.Get() )
+			{
+				bHasFrameIndexes = true;
+				PrevFrameIndex = InstData->PrevFrameIndex;
+				NextFrameIndex = InstData->NextFrameIndex;
+				FramePrevWeight = InstData->FramePrevWeight;
+			}
+			else
+			{
+				bHasFrameIndexes = Asset->GetFrameIndexesAtTime( TimeParam.Get(), PrevFrameIndex, NextFrameIndex, FramePrevWeight );
+			}
+		}
+	}
+
+	bool Get( const int32& PointID, const float& Time, int32& PrevSampleIndex, int32& NextSampleIndex, float& PrevWeight, int32* SampleCursor = nullptr ) const
+	{
+		if ( !Asset )
+			return false;
+
+		if ( SampleCursor )
+			return Asset->GetSampleIndexesForPointAtTimeWithCursor( PointID, Time, *SampleCursor, PrevSampleIndex, NextSampleIndex, PrevWeight );
+
+		if ( !bHasFrameIndexes )
+			return Asset->GetSampleIndexesForPointAtTime( PointID, Time, PrevSampleIndex, NextSampleIndex, PrevWeight );
+
+		if ( PointID < 0 || PointID >= NumberOfPoints )
+			return false;
+
+		PrevSampleIndex = PrevFrameIndex * NumberOfPoints + PointID;
+		NextSampleIndex = NextFrameIndex * NumberOfPoints + PointID;
+		PrevWeight = FramePrevWeight;
+		return true;
+	}
+
+	// Returns the shared evaluation of NumAttributes consecutive attributes, the last one requested is kept for the following calls
+	const FHoudiniPointCacheSharedEvaluation* GetSharedEvaluation( const int32& AttributeIndex, const int32& NumAttributes ) const
+	{
+		if ( !bUseSharedEvaluation || AttributeIndex < 0 || AttributeIndex + NumAttributes > Asset->GetNumberOfAttributes() )
+			return nullptr;
+
+		if ( AttributeIndex != SharedEvaluationAttributeIndex || NumAttributes != SharedEvaluationNumAttributes )
+		{
+			SharedEvaluationAttributeIndex = AttributeIndex;
+			SharedEvaluationNumAttributes = NumAttributes;
+
+			TArray<int32> AttributeIndexes;
+			for ( int32 n = 0; n < NumAttributes; n++ )
+				AttributeIndexes.Add( AttributeIndex + n );
+
+			SharedEvaluation = Asset->GetSharedEvaluationAtTime( SharedEvaluationTime, AttributeIndexes );
+		}
+
+		return SharedEvaluation.Get();
+	}
+
+	bool GetFloatValue( const int32& PointID, const int32& AttributeIndex, const float& Time, float& Value, int32* SampleCursor = nullptr ) const
+	{
+		const FHoudiniPointCacheSharedEvaluation* Evaluation = SampleCursor ? nullptr : GetSharedEvaluation( AttributeIndex, 1 );
+		if ( Evaluation )
+		{
+			if ( PointID < 0 || PointID >= Asset->NumberOfPoints )
+				return false;
+
+			Value = Evaluation->Values[ PointID ];
+			return true;
+		}
+
+		int32 PrevSampleIndex = -1;
+		int32 NextSampleIndex = -1;
+		float PrevWeight = 1.0f;
+		if ( !Get( PointID, Time, PrevSampleIndex, NextSampleIndex, PrevWeight, SampleCursor ) )
+			return false;
+
+		float PrevValue, NextValue;
+		if ( !Asset->GetFloatValue( PrevSampleIndex, AttributeIndex, PrevValue ) )
+			return false;
+		if ( !Asset->GetFloatValue( NextSampleIndex, AttributeIndex, NextValue ) )
+			return false;
+
+		Value = FMath::Lerp( PrevValue, NextValue, PrevWeight );
+		return true;
+	}
+
+	bool GetVectorValue( const int32& PointID, const int32& AttributeIndex, const float& Time, FVector& Vector, const bool& DoSwap, const bool& DoScale, int32* SampleCursor = nullptr ) const
+	{
+		const FHoudiniPointCacheSharedEvaluation* Evaluation = SampleCursor || Asset->UsesHermiteInterpolation( AttributeIndex ) ? nullptr : GetSharedEvaluation( AttributeIndex, 3 );
+		if ( Evaluation )
+		{
+			const int32& NumPoints = Asset->NumberOfPoints;
+			if ( PointID < 0 || PointID >= NumPoints )
+				return false;
+
+			// Same conversions as UHoudiniPointCache::GetVectorValue
+			FVector3f V( Evaluation->Values[ PointID ], Evaluation->Values[ NumPoints + PointID ], Evaluation->Values[ 2 * NumPoints + PointID ] );
+			if ( DoScale )
+				V *= 100.0f;
+
+			Vector = DoSwap ? FVector( V.X, V.Z, V.Y ) : FVector( V.X, V.Y, V.Z );
+			return true;
+		}
+
+		int32 PrevSampleIndex = -1;
+		int32 NextSampleIndex = -1;
+		float PrevWeight = 1.0f;
+		if ( !Get( PointID, Time, PrevSampleIndex, NextSampleIndex, PrevWeight, SampleCursor ) )
+			return false;
+
+		return Asset->InterpolateVectorValue( PrevSampleIndex, NextSampleIndex, PrevWeight, AttributeIndex, Vector, DoSwap, DoScale );
+	}
+
+	bool GetVector4Value( const int32& PointID, const int32& AttributeIndex, const float& Time, FVector4& Vector, int32* SampleCursor = nullptr ) const
+	{
+		int32 PrevSampleIndex = -1;
+		int32 NextSampleIndex = -1;
+		float PrevWeight = 1.0f;
+		if ( !Get( PointID, Time, PrevSampleIndex, NextSampleIndex, PrevWeight, SampleCursor ) )
+			return false;
+
+		FVector4 PrevVector, NextVector;
+		if ( !Asset->GetVector4Value( PrevSampleIndex, AttributeIndex, PrevVector ) )
+			return false;
+		if ( !Asset->GetVector4Value( NextSampleIndex, AttributeIndex, NextVector ) )
+			return false;
+
+		Vector = FMath::Lerp( PrevVector, NextVector, PrevWeight );
+		return true;
+	}
+
+	bool GetQuatValue( const int32& PointID, const int32& AttributeIndex, const float& Time, FQuat& Quat, const bool& DoHoudiniToUnrealConversion, int32* SampleCursor = nullptr ) const
+	{
+		int32 PrevSampleIndex = -1;
+		int32 NextSampleIndex = -1;
+		float PrevWeight = 1.0f;
+		if ( !Get( PointID, Time, PrevSampleIndex, NextSampleIndex, PrevWeight, SampleCursor ) )
+			return false;
+
+		FQuat PrevQuat, NextQuat;
+		if ( !Asset->GetQuatValue( PrevSampleIndex, AttributeIndex, PrevQuat, DoHoudiniToUnrealConversion ) )
+			return false;
+		if ( !Asset->GetQuatValue( NextSampleIndex, AttributeIndex, NextQuat, DoHoudiniToUnrealConversion ) )
+			return false;
+
+		Quat = FQuat::Slerp( PrevQuat, NextQuat, PrevWeight );
+		return true;
+	}
+
+	const UHoudiniPointCache* Asset = nullptr;
+	int32 NumberOfPoints = 0;
+	bool bHasFrameIndexes = false;
+	int32 PrevFrameIndex = 0;
+	int32 NextFrameIndex = 0;
+	float FramePrevWeight = 1.0f;
+
+	bool bUseSharedEvaluation = false;
+	float SharedEvaluationTime = 0.0f;
+	mutable int32 SharedEvaluationAttributeIndex = INDEX_NONE;
+	mutable int32 SharedEvaluationNumAttributes = 0;
+	mutable TSharedPtr<const FHoudiniPointCacheSharedEvaluation, ESPMode::ThreadSafe> SharedEvaluation;
+};
+
+int32 UNiagaraDataInterfaceHoudini::ResolveAttributeIndex(const FString& Attribute) const
+{
+	if (!HoudiniPointCacheAsset)
+		return INDEX_NONE;
+
+	int32 AttributeIndex = INDEX_NONE;
+	if (!HoudiniPointCacheAsset->GetAttributeIndexFromString(Attribute, AttributeIndex))
+	{
+		UE_LOG(LogHoudiniNiagara, Warning, TEXT("Could not find attribute '%s' in point cache %s."), *Attribute, *HoudiniPointCacheAsset->GetName());
+		return INDEX_NONE;
+	}
+
+	return AttributeIndex;
+}
+
+void UNiagaraDataInterfaceHoudini::GetFloatValue(FVectorVMExternalFunctionContext& Context)
+{
+    VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+    VectorVM::FExternalFuncInputHandler<int32> SampleIndexParam(Context);
+    VectorVM::FExternalFuncInputHandler<int32> AttributeIndexParam(Context);
+
+    VectorVM::FExternalFuncRegisterHandler<float> OutValue(Context);
+
+    for ( int32 i = 0; i < Context.GetNumInstances(); ++i )
+    {
+		int32 SampleIndex = SampleIndexParam.Get();
+		int32 AttributeIndex = AttributeIndexParam.Get();
+	
+		float value = 0.0f;
+		if ( HoudiniPointCacheAsset )
+			HoudiniPointCacheAsset->GetFloatValue( SampleIndex, AttributeIndex, value );
+
+		*OutValue.GetDest() = value;
+		SampleIndexParam.Advance();
+		AttributeIndexParam.Advance();
+		OutValue.Advance();
+    }
+}
+
+void UNiagaraDataInterfaceHoudini::GetIntValue(FVectorVMExternalFunctionContext& Context)
+{
+    VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+    VectorVM::FExternalFuncInputHandler<int32> SampleIndexParam(Context);
+    VectorVM::FExternalFuncInputHandler<int32> AttributeIndexParam(Context);
+
+    VectorVM::FExternalFuncRegisterHandler<int32> OutValue(Context);
+
+    for ( int32 i = 0; i < Context.GetNumInstances(); ++i )
+    {
+		int32 SampleIndex = SampleIndexParam.Get();
+		int32 AttributeIndex = AttributeIndexParam.Get();
+
+		int32 value = 0;
+		if ( HoudiniPointCacheAsset )
+			HoudiniPointCacheAsset->GetIntValue( SampleIndex, AttributeIndex, value );
+
+		*OutValue.GetDest() = value;
+		SampleIndexParam.Advance();
+		AttributeIndexParam.Advance();
+		OutValue.Advance();
+    }
+}
+
+void UNiagaraDataInterfaceHoudini::GetVectorValue(FVectorVMExternalFunctionContext& Context)
+{
+    VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+    VectorVM::FExternalFuncInputHandler<int32> SampleIndexParam(Context);
+    VectorVM::FExternalFuncInputHandler<int32> AttributeIndexParam(Context);
+
+	VectorVM::FExternalFuncRegisterHandler<float> OutVectorX(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutVectorY(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutVectorZ(Context);
+
+    for (int32 i = 0; i < Context.GetNumInstances(); ++i)
+    {
+		int32 SampleIndex = SampleIndexParam.Get();
+		int32 AttributeIndex = AttributeIndexParam.Get();
+
+		FVector V = FVector::ZeroVector;
+		if ( HoudiniPointCacheAsset )
+			HoudiniPointCacheAsset->GetVectorValue(SampleIndex, AttributeIndex, V);
+
+		*OutVectorX.GetDest() = V.X;
+		*OutVectorY.GetDest() = V.Y;
+		*OutVectorZ.GetDest() = V.Z;
+
+		SampleIndexParam.Advance();
+		AttributeIndexParam.Advance();
+		OutVectorX.Advance();
+		OutVectorY.Advance();
+		OutVectorZ.Advance();
+    }
+}
+
+void UNiagaraDataInterfaceHoudini::GetVectorValueByString(FVectorVMExternalFunctionContext& Context, int32 AttributeIndex)
+{
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+	VectorVM::FExternalFuncInputHandler<int32> SampleIndexParam(Context);
+
+	VectorVM::FExternalFuncRegisterHandler<float> OutVectorX(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutVectorY(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutVectorZ(Context);
+
+	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
+	{
+		int32 SampleIndex = SampleIndexParam.Get();
+
+		FVector V = FVector::ZeroVector;
+		if (HoudiniPointCacheAsset)
+			HoudiniPointCacheAsset->GetVectorValue(SampleIndex, AttributeIndex, V);
+
+		*OutVectorX.GetDest() = V.X;
+		*OutVectorY.GetDest() = V.Y;
+		*OutVectorZ.GetDest() = V.Z;
+
+		SampleIndexParam.Advance();
+		OutVectorX.Advance();
+		OutVectorY.Advance();
+		OutVectorZ.Advance();
+	}
+}
+
+void UNiagaraDataInterfaceHoudini::GetVectorValueEx(FVectorVMExternalFunctionContext& Context)
+{
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+	VectorVM::FExternalFuncInputHandler<int32> SampleIndexParam(Context);
+	VectorVM::FExternalFuncInputHandler<int32> AttributeIndexParam(Context);
+	VectorVM::FExternalFuncInputHandler<FNiagaraBool> DoSwapParam(Context);
+	VectorVM::FExternalFuncInputHandler<FNiagaraBool> DoScaleParam(Context);
+
+	VectorVM::FExternalFuncRegisterHandler<float> OutVectorX(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutVectorY(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutVectorZ(Context);
+
+	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
+	{
+		int32 SampleIndex = SampleIndexParam.Get();
+		int32 AttributeIndex = AttributeIndexParam.Get();
+
+		bool DoSwap = DoSwapParam.Get().GetValue();
+		bool DoScale = DoScaleParam.Get().GetValue();
+
+		FVector V = FVector::ZeroVector;
+		if (HoudiniPointCacheAsset)
+			HoudiniPointCacheAsset->GetVectorValue(SampleIndex, AttributeIndex, V, DoSwap, DoScale);
+
+		*OutVectorX.GetDest() = V.X;
+		*OutVectorY.GetDest() = V.Y;
+		*OutVectorZ.GetDest() = V.Z;
+
+		SampleIndexParam.Advance();
+		AttributeIndexParam.Advance();
+		DoSwapParam.Advance();
+		DoScaleParam.Advance();
+		OutVectorX.Advance();
+		OutVectorY.Advance();
+		OutVectorZ.Advance();
+	}
+}
+
+void UNiagaraDataInterfaceHoudini::GetVectorValueExByString(FVectorVMExternalFunctionContext& Context, int32 AttributeIndex)
+{
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+	VectorVM::FExternalFuncInputHandler<int32> SampleIndexParam(Context);
+	VectorVM::FExternalFuncInputHandler<FNiagaraBool> DoSwapParam(Context);
+	VectorVM::FExternalFuncInputHandler<FNiagaraBool> DoScaleParam(Context);
+
+	VectorVM::FExternalFuncRegisterHandler<float> OutVectorX(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutVectorY(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutVectorZ(Context);
+
+	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
+	{
+		int32 SampleIndex = SampleIndexParam.Get();
+
+		bool DoSwap = DoSwapParam.Get().GetValue();
+		bool DoScale = DoScaleParam.Get().GetValue();
+
+		FVector V = FVector::ZeroVector;
+		if (HoudiniPointCacheAsset)
+			HoudiniPointCacheAsset->GetVectorValue(SampleIndex, AttributeIndex, V, DoSwap, DoScale);
+
+		*OutVectorX.GetDest() = V.X;
+		*OutVectorY.GetDest() = V.Y;
+		*OutVectorZ.GetDest() = V.Z;
+
+		SampleIndexParam.Advance();
+		DoSwapParam.Advance();
+		DoScaleParam.Advance();
+		OutVectorX.Advance();
+		OutVectorY.Advance();
+		OutVectorZ.Advance();
+	}
+}
+
+void UNiagaraDataInterfaceHoudini::GetVector4Value(FVectorVMExternalFunctionContext& Context)
+{
+    VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+    VectorVM::FExternalFuncInputHandler<int32> SampleIndexParam(Context);
+    VectorVM::FExternalFuncInputHandler<int32> AttributeIndexParam(Context);
+
+	VectorVM::FExternalFuncRegisterHandler<float> OutVectorX(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutVectorY(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutVectorZ(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutVectorW(Context);
+
+    for (int32 i = 0; i < Context.GetNumInstances(); ++i)
+    {
+		int32 SampleIndex = SampleIndexParam.Get();
+		int32 AttributeIndex = AttributeIndexParam.Get();
+
+		FVector4 V(FVector::ZeroVector, 0);
+		if ( HoudiniPointCacheAsset )
+			HoudiniPointCacheAsset->GetVector4Value(SampleIndex, AttributeIndex, V);
+
+		*OutVectorX.GetDest() = V.X;
+		*OutVectorY.GetDest() = V.Y;
+		*OutVectorZ.GetDest() = V.Z;
+		*OutVectorW.GetDest() = V.W;
+
+		SampleIndexParam.Advance();
+		AttributeIndexParam.Advance();
+		OutVectorX.Advance();
+		OutVectorY.Advance();
+		OutVectorZ.Advance();
+		OutVectorW.Advance();
+    }
+}
+
+void UNiagaraDataInterfaceHoudini::GetVector4ValueByString(FVectorVMExternalFunctionContext& Context, int32 AttributeIndex)
+{
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+	VectorVM::FExternalFuncInputHandler<int32> SampleIndexParam(Context);
+
+	VectorVM::FExternalFuncRegisterHandler<float> OutVectorX(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutVectorY(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutVectorZ(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutVectorW(Context);
+
+	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
+	{
+		int32 SampleIndex = SampleIndexParam.Get();
+
+		FVector4 V(FVector::ZeroVector, 0);
+		if (HoudiniPointCacheAsset)
+			HoudiniPointCacheAsset->GetVector4Value(SampleIndex, AttributeIndex, V);
+
+		*OutVectorX.GetDest() = V.X;
+		*OutVectorY.GetDest() = V.Y;
+		*OutVectorZ.GetDest() = V.Z;
+		*OutVectorW.GetDest() = V.W;
+
+		SampleIndexParam.Advance();
+		OutVectorX.Advance();
+		OutVectorY.Advance();
+		OutVectorZ.Advance();
+		OutVectorW.Advance();
+	}
+}
+
+void UNiagaraDataInterfaceHoudini::GetQuatValue(FVectorVMExternalFunctionContext& Context)
+{
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+	VectorVM::FExternalFuncInputHandler<int32> SampleIndexParam(Context);
+	VectorVM::FExternalFuncInputHandler<int32> AttributeIndexParam(Context);
+	VectorVM::FExternalFuncInputHandler<FNiagaraBool> DoHoudiniToUnrealConversionParam(Context);
+
+	VectorVM::FExternalFuncRegisterHandler<float> OutVectorX(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutVectorY(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutVectorZ(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutVectorW(Context);
+
+	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
+	{
+		int32 SampleIndex = SampleIndexParam.Get();
+		int32 AttributeIndex = AttributeIndexParam.Get();
+
+		bool DoHoudiniToUnrealConversion = DoHoudiniToUnrealConversionParam.Get().GetValue();
+
+		FQuat Q(0, 0, 0, 0);
+		if (HoudiniPointCacheAsset)
+			HoudiniPointCacheAsset->GetQuatValue(SampleIndex, AttributeIndex, Q, DoHoudiniToUnrealConversion);
+
+		*OutVectorX.GetDest() = Q.X;
+		*OutVectorY.GetDest() = Q.Y;
+		*OutVectorZ.GetDest() = Q.Z;
+		*OutVectorW.GetDest() = Q.W;
+
+		SampleIndexParam.Advance();
+		AttributeIndexParam.Advance();
+		DoHoudiniToUnrealConversionParam.Advance();
+		OutVectorX.Advance();
+		OutVectorY.Advance();
+		OutVectorZ.Advance();
+		OutVectorW.Advance();
+	}
+}
+
+void UNiagaraDataInterfaceHoudini::GetQuatValueByString(FVectorVMExternalFunctionContext& Context, int32 AttributeIndex)
+{
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+	VectorVM::FExternalFuncInputHandler<int32> SampleIndexParam(Context);
+	VectorVM::FExternalFuncInputHandler<FNiagaraBool> DoHoudiniToUnrealConversionParam(Context);
+
+	VectorVM::FExternalFuncRegisterHandler<float> OutVectorX(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutVectorY(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutVectorZ(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutVectorW(Context);
+
+	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
+	{
+		int32 SampleIndex = SampleIndexParam.Get();
+
+		bool DoHoudiniToUnrealConversion = DoHoudiniToUnrealConversionParam.Get().GetValue();
+
+		FQuat Q(0, 0, 0, 0);
+		if (HoudiniPointCacheAsset)
+			HoudiniPointCacheAsset->GetQuatValue(SampleIndex, AttributeIndex, Q, DoHoudiniToUnrealConversion);
+
+		*OutVectorX.GetDest() = Q.X;
+		*OutVectorY.GetDest() = Q.Y;
+		*OutVectorZ.GetDest() = Q.Z;
+		*OutVectorW.GetDest() = Q.W;
+
+		SampleIndexParam.Advance();
+		DoHoudiniToUnrealConversionParam.Advance();
+		OutVectorX.Advance();
+		OutVectorY.Advance();
+		OutVectorZ.Advance();
+		OutVectorW.Advance();
+	}
+}
+
+void UNiagaraDataInterfaceHoudini::GetFloatValueByString(FVectorVMExternalFunctionContext& Context, int32 AttributeIndex)
 {
+    VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
     VectorVM::FExternalFuncInputHandler<int32> SampleIndexParam(Context);
-    VectorVM::FExternalFuncInputHandler<int32> AttributeIndexParam(Context);
 
     VectorVM::FExternalFuncRegisterHandler<float> OutValue(Context);
 
     for ( int32 i = 0; i < Context.GetNumInstances(); ++i )
     {
 		int32 SampleIndex = SampleIndexParam.Get();
-		int32 AttributeIndex = AttributeIndexParam.Get();
 	
 		float value = 0.0f;
-		if ( HoudiniPointCacheAsset )
-			HoudiniPointCacheAsset->GetFloatValue( SampleIndex, AttributeIndex, value );
+		if (HoudiniPointCacheAsset)
+			HoudiniPointCacheAsset->GetFloatValue(SampleIndex, AttributeIndex, value);
 
 		*OutValue.GetDest() = value;
 		SampleIndexParam.Advance();
-		AttributeIndexParam.Advance();
 		OutValue.Advance();
     }
 }
 
-void UNiagaraDataInterfaceHoudini::GetVectorValue(FVectorVMExternalFunctionContext& Context)
+void UNiagaraDataInterfaceHoudini::GetPosition(FVectorVMExternalFunctionContext& Context)
 {
-    VectorVM::FExternalFuncInputHandler<int32> SampleIndexParam(Context);
-    VectorVM::FExternalFuncInputHandler<int32> AttributeIndexParam(Context);
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+	VectorVM::FExternalFuncInputHandler<int32> SampleIndexParam(Context);
 
-	VectorVM::FExternalFuncRegisterHandler<float> OutVectorX(Context);
-	VectorVM::FExternalFuncRegisterHandler<float> OutVectorY(Context);
-	VectorVM::FExternalFuncRegisterHandler<float> OutVectorZ(Context);
+    VectorVM::FExternalFuncRegisterHandler<float> OutSampleX(Context);
+    VectorVM::FExternalFuncRegisterHandler<float> OutSampleY(Context);
+    VectorVM::FExternalFuncRegisterHandler<float> OutSampleZ(Context);
+
+	// The whole batch reads the same sample, only read it once
+	const bool bIsConstant = SampleIndexParam.IsConstant();
+	FVector ConstantV = FVector::ZeroVector;
+	if ( bIsConstant && HoudiniPointCacheAsset )
+		HoudiniPointCacheAsset->GetPositionValue( SampleIndexParam.Get(), ConstantV );
+
+    for (int32 i = 0; i < Context.GetNumInstances(); ++i)
+    {
+		int32 SampleIndex = SampleIndexParam.Get();
+
+		FVector V = ConstantV;
+		if ( !bIsConstant && HoudiniPointCacheAsset )
+			HoudiniPointCacheAsset->GetPositionValue( SampleIndex, V );
+
+		*OutSampleX.GetDest() = V.X;
+		*OutSampleY.GetDest() = V.Y;
+		*OutSampleZ.GetDest() = V.Z;
+		SampleIndexParam.Advance();
+		OutSampleX.Advance();
+		OutSampleY.Advance();
+		OutSampleZ.Advance();
+    }
+}
+
+void UNiagaraDataInterfaceHoudini::GetNormal(FVectorVMExternalFunctionContext& Context)
+{
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+	VectorVM::FExternalFuncInputHandler<int32> SampleIndexParam(Context);
+
+    VectorVM::FExternalFuncRegisterHandler<float> OutSampleX(Context);
+    VectorVM::FExternalFuncRegisterHandler<float> OutSampleY(Context);
+    VectorVM::FExternalFuncRegisterHandler<float> OutSampleZ(Context);
 
     for (int32 i = 0; i < Context.GetNumInstances(); ++i)
     {
 		int32 SampleIndex = SampleIndexParam.Get();
-		int32 AttributeIndex = AttributeIndexParam.Get();
 
 		FVector V = FVector::ZeroVector;
 		if ( HoudiniPointCacheAsset )
-			HoudiniPointCacheAsset->GetVectorValue(SampleIndex, AttributeIndex, V);
+			HoudiniPointCacheAsset->GetNormalValue( SampleIndex, V );
 
-		*OutVectorX.GetDest() = V.X;
-		*OutVectorY.GetDest() = V.Y;
-		*OutVectorZ.GetDest() = V.Z;
+		*OutSampleX.GetDest() = V.X;
+		*OutSampleY.GetDest() = V.Y;
+		*OutSampleZ.GetDest() = V.Z;
+		SampleIndexParam.Advance();
+		OutSampleX.Advance();
+		OutSampleY.Advance();
+		OutSampleZ.Advance();
+    }
+}
+
+void UNiagaraDataInterfaceHoudini::GetTime(FVectorVMExternalFunctionContext& Context)
+{
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+	VectorVM::FExternalFuncInputHandler<int32> SampleIndexParam(Context);
+
+    VectorVM::FExternalFuncRegisterHandler<float> OutValue(Context);
+
+    for (int32 i = 0; i < Context.GetNumInstances(); ++i)
+    {
+		int32 SampleIndex = SampleIndexParam.Get();
+
+		float value = 0.0f;
+		if ( HoudiniPointCacheAsset )
+			HoudiniPointCacheAsset->GetTimeValue( SampleIndex, value );
 
+		*OutValue.GetDest() = value;
 		SampleIndexParam.Advance();
-		AttributeIndexParam.Advance();
-		OutVectorX.Advance();
-		OutVectorY.Advance();
-		OutVectorZ.Advance();
+		OutValue.Advance();
     }
 }
 
-void UNiagaraDataInterfaceHoudini::GetVectorValueByString(FVectorVMExternalFunctionContext& Context, const FString& Attribute)
+void UNiagaraDataInterfaceHoudini::GetVelocity(FVectorVMExternalFunctionContext& Context)
 {
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
 	VectorVM::FExternalFuncInputHandler<int32> SampleIndexParam(Context);
 
-	VectorVM::FExternalFuncRegisterHandler<float> OutVectorX(Context);
-	VectorVM::FExternalFuncRegisterHandler<float> OutVectorY(Context);
-	VectorVM::FExternalFuncRegisterHandler<float> OutVectorZ(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutSampleX(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutSampleY(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutSampleZ(Context);
 
 	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
 	{
 		int32 SampleIndex = SampleIndexParam.Get();
 
 		FVector V = FVector::ZeroVector;
-		if (HoudiniPointCacheAsset)
-			HoudiniPointCacheAsset->GetVectorValueForString(SampleIndex, Attribute, V);
-
-		*OutVectorX.GetDest() = V.X;
-		*OutVectorY.GetDest() = V.Y;
-		*OutVectorZ.GetDest() = V.Z;
+		if ( HoudiniPointCacheAsset )
+			HoudiniPointCacheAsset->GetVelocityValue( SampleIndex, V );
 
+		*OutSampleX.GetDest() = V.X;
+		*OutSampleY.GetDest() = V.Y;
+		*OutSampleZ.GetDest() = V.Z;
 		SampleIndexParam.Advance();
-		OutVectorX.Advance();
-		OutVectorY.Advance();
-		OutVectorZ.Advance();
+		OutSampleX.Advance();
+		OutSampleY.Advance();
+		OutSampleZ.Advance();
 	}
 }
 
-void UNiagaraDataInterfaceHoudini::GetVectorValueEx(FVectorVMExternalFunctionContext& Context)
+void UNiagaraDataInterfaceHoudini::GetColor(FVectorVMExternalFunctionContext& Context)
 {
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
 	VectorVM::FExternalFuncInputHandler<int32> SampleIndexParam(Context);
-	VectorVM::FExternalFuncInputHandler<int32> AttributeIndexParam(Context);
-	VectorVM::FExternalFuncInputHandler<FNiagaraBool> DoSwapParam(Context);
-	VectorVM::FExternalFuncInputHandler<FNiagaraBool> DoScaleParam(Context);
 
-	VectorVM::FExternalFuncRegisterHandler<float> OutVectorX(Context);
-	VectorVM::FExternalFuncRegisterHandler<float> OutVectorY(Context);
-	VectorVM::FExternalFuncRegisterHandler<float> OutVectorZ(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutSampleR(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutSampleG(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutSampleB(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutSampleA(Context);
 
 	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
 	{
 		int32 SampleIndex = SampleIndexParam.Get();
-		int32 AttributeIndex = AttributeIndexParam.Get();
-
-		bool DoSwap = DoSwapParam.Get().GetValue();
-		bool DoScale = DoScaleParam.Get().GetValue();
-
-		FVector V = FVector::ZeroVector;
-		if (HoudiniPointCacheAsset)
-			HoudiniPointCacheAsset->GetVectorValue(SampleIndex, AttributeIndex, V, DoSwap, DoScale);
 
-		*OutVectorX.GetDest() = V.X;
-		*OutVectorY.GetDest() = V.Y;
-		*OutVectorZ.GetDest() = V.Z;
+		FLinearColor C = FLinearColor::White;
+		if ( HoudiniPointCacheAsset )
+			HoudiniPointCacheAsset->GetColorValue( SampleIndex, C );
 
+		*OutSampleR.GetDest() = C.R;
+		*OutSampleG.GetDest() = C.G;
+		*OutSampleB.GetDest() = C.B;
+		*OutSampleA.GetDest() = C.A;
 		SampleIndexParam.Advance();
-		AttributeIndexParam.Advance();
-		DoSwapParam.Advance();
-		DoScaleParam.Advance();
-		OutVectorX.Advance();
-		OutVectorY.Advance();
-		OutVectorZ.Advance();
+		OutSampleR.Advance();
+		OutSampleG.Advance();
+		OutSampleB.Advance();
+		OutSampleA.Advance();
 	}
 }
 
-void UNiagaraDataInterfaceHoudini::GetVectorValueExByString(FVectorVMExternalFunctionContext& Context, const FString& Attribute)
+void UNiagaraDataInterfaceHoudini::GetImpulse(FVectorVMExternalFunctionContext& Context)
 {
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
 	VectorVM::FExternalFuncInputHandler<int32> SampleIndexParam(Context);
-	VectorVM::FExternalFuncInputHandler<FNiagaraBool> DoSwapParam(Context);
-	VectorVM::FExternalFuncInputHandler<FNiagaraBool> DoScaleParam(Context);
 
-	VectorVM::FExternalFuncRegisterHandler<float> OutVectorX(Context);
-	VectorVM::FExternalFuncRegisterHandler<float> OutVectorY(Context);
-	VectorVM::FExternalFuncRegisterHandler<float> OutVectorZ(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutValue(Context);
 
 	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
 	{
 		int32 SampleIndex = SampleIndexParam.Get();
 
-		bool DoSwap = DoSwapParam.Get().GetValue();
-		bool DoScale = DoScaleParam.Get().GetValue();
-
-		FVector V = FVector::ZeroVector;
+		float value = 0.0f;
 		if (HoudiniPointCacheAsset)
-			HoudiniPointCacheAsset->GetVectorValueForString(SampleIndex, Attribute, V, DoSwap, DoScale);
+			HoudiniPointCacheAsset->GetImpulseValue(SampleIndex, value);
 
-		*OutVectorX.GetDest() = V.X;
-		*OutVectorY.GetDest() = V.Y;
-		*OutVectorZ.GetDest() = V.Z;
+		*OutValue.GetDest() = value;
+		SampleIndexParam.Advance();
+		OutValue.Advance();
+	}
+}
+
+// Returns the last index of the points that should be spawned at time t
+void UNiagaraDataInterfaceHoudini::GetLastSampleIndexAtTime(FVectorVMExternalFunctionContext& Context)
+{
+    VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+    VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
+
+    VectorVM::FExternalFuncRegisterHandler<int32> OutValue(Context);
+
+	// The time is usually an emitter or system parameter, search the frame table only once for the whole batch
+	const bool bIsConstant = TimeParam.IsConstant();
+	int32 ConstantValue = 0;
+	if ( bIsConstant && HoudiniPointCacheAsset )
+		HoudiniPointCacheAsset->GetLastSampleIndexAtTime( TimeParam.Get(), ConstantValue );
+
+    for (int32 i = 0; i < Context.GetNumInstances(); ++i)
+    {
+		float t = TimeParam.Get();
+
+		int32 value = ConstantValue;
+		if ( !bIsConstant && HoudiniPointCacheAsset )
+			HoudiniPointCacheAsset->GetLastSampleIndexAtTime( t, value );
+
+		*OutValue.GetDest() = value;
+		TimeParam.Advance();
+		OutValue.Advance();
+    }
+}
+
+// Returns the last index of the points that should be spawned at time t
+void UNiagaraDataInterfaceHoudini::GetPointIDsToSpawnAtTime(FVectorVMExternalFunctionContext& Context)
+{
+    VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+    VectorVM::FExternalFuncInputHandler<float> TimeParam( Context );
+	VectorVM::FExternalFuncInputHandler<float> LastSpawnTimeParam( Context );
+	VectorVM::FExternalFuncInputHandler<float> LastSpawnTimeRequestParam( Context );
+	VectorVM::FExternalFuncInputHandler<int32> LastSpawnedPointIDParam( Context );
+	VectorVM::FExternalFuncInputHandler<bool>  ResetSpawnStateParam( Context );
+
+    VectorVM::FExternalFuncRegisterHandler<int32> OutMinValue( Context );
+    VectorVM::FExternalFuncRegisterHandler<int32> OutMaxValue( Context );
+    VectorVM::FExternalFuncRegisterHandler<int32> OutCountValue( Context );
+	VectorVM::FExternalFuncRegisterHandler<float> OutLastSpawnTimeValue( Context );
+	VectorVM::FExternalFuncRegisterHandler<float> OutLastSpawnTimeRequestValue( Context );
+	VectorVM::FExternalFuncRegisterHandler<int32> OutLastSpawnedPointIDValue( Context );
+
+	// When all the inputs are constant, every instance gets the same spawn range: only compute it once
+	const bool bIsConstant = TimeParam.IsConstant() && LastSpawnTimeParam.IsConstant() && LastSpawnTimeRequestParam.IsConstant()
+		&& LastSpawnedPointIDParam.IsConstant() && ResetSpawnStateParam.IsConstant();
+
+	float LastSpawnTime = 0.0f;
+	float LastSpawnTimeRequest = 0.0f;
+	int32 LastSpawnedPointID = -1;
+	int32 min = 0, max = 0, count = 0;
+
+    for (int32 i = 0; i < Context.GetNumInstances(); ++i)
+    {
+		if ( !bIsConstant || i == 0 )
+		{
+			float t = TimeParam.Get();
+			LastSpawnTime = LastSpawnTimeParam.Get();
+			LastSpawnTimeRequest = LastSpawnTimeRequestParam.Get();
+			LastSpawnedPointID = LastSpawnedPointIDParam.Get();
+			bool  ResetSpawnState = ResetSpawnStateParam.Get();
+
+			if (ResetSpawnState)
+			{
+				LastSpawnTime = -FLT_MAX;
+				LastSpawnTimeRequest = -FLT_MAX;
+				LastSpawnedPointID = -1;
+			}
+
+			min = 0;
+			max = 0;
+			count = 0;
+
+			if ( HoudiniPointCacheAsset )
+			{
+				HoudiniPointCacheAsset->GetPointIDsToSpawnAtTime(t, min, max, count, LastSpawnedPointID, LastSpawnTime, LastSpawnTimeRequest);
+			}
+		}
+
+		*OutMinValue.GetDest() = min;
+		*OutMaxValue.GetDest() = max;
+		*OutCountValue.GetDest() = count;
+
+		*OutLastSpawnTimeValue.GetDest() = LastSpawnTime;
+		*OutLastSpawnTimeRequestValue.GetDest() = LastSpawnTimeRequest;
+		*OutLastSpawnedPointIDValue.GetDest() = LastSpawnedPointID;
+
+		TimeParam.Advance();
+		LastSpawnTimeParam.Advance();
+		LastSpawnTimeRequestParam.Advance();
+		LastSpawnedPointIDParam.Advance();
+		ResetSpawnStateParam.Advance();
+		OutMinValue.Advance();
+		OutMaxValue.Advance();
+		OutCountValue.Advance();
+		OutLastSpawnTimeValue.Advance();
+		OutLastSpawnTimeRequestValue.Advance();
+		OutLastSpawnedPointIDValue.Advance();
+    }
+}
+
+// Returns the points to spawn during this tick, precomputed for the system instance in PerInstanceTick()
+void UNiagaraDataInterfaceHoudini::GetPointIDsToSpawn(FVectorVMExternalFunctionContext& Context)
+{
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+
+	VectorVM::FExternalFuncRegisterHandler<int32> OutMinValue( Context );
+	VectorVM::FExternalFuncRegisterHandler<int32> OutMaxValue( Context );
+	VectorVM::FExternalFuncRegisterHandler<int32> OutCountValue( Context );
+
+	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
+	{
+		*OutMinValue.GetDest() = InstData->SpawnMinID;
+		*OutMaxValue.GetDest() = InstData->SpawnMaxID;
+		*OutCountValue.GetDest() = InstData->SpawnCount;
+
+		OutMinValue.Advance();
+		OutMaxValue.Advance();
+		OutCountValue.Advance();
+	}
+}
+
+// Returns the number of points alive at time t, and the range of point IDs containing them
+void UNiagaraDataInterfaceHoudini::GetAlivePointsAtTime(FVectorVMExternalFunctionContext& Context)
+{
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
+
+	VectorVM::FExternalFuncRegisterHandler<int32> OutMinValue( Context );
+	VectorVM::FExternalFuncRegisterHandler<int32> OutMaxValue( Context );
+	VectorVM::FExternalFuncRegisterHandler<int32> OutCountValue( Context );
+
+	// The time is usually an emitter or system parameter, search the alive interval index only once for the whole batch
+	const bool bIsConstant = TimeParam.IsConstant();
+	int32 ConstantCount = 0, ConstantMin = 0, ConstantMax = -1;
+	if ( bIsConstant && HoudiniPointCacheAsset )
+		HoudiniPointCacheAsset->GetAlivePointsAtTime( TimeParam.Get(), ConstantCount, ConstantMin, ConstantMax );
+
+	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
+	{
+		float t = TimeParam.Get();
 
-		SampleIndexParam.Advance();
-		DoSwapParam.Advance();
-		DoScaleParam.Advance();
-		OutVectorX.Advance();
-		OutVectorY.Advance();
-		OutVectorZ.Advance();
+		int32 count = ConstantCount, min = ConstantMin, max = ConstantMax;
+		if ( !bIsConstant && HoudiniPointCacheAsset )
+			HoudiniPointCacheAsset->GetAlivePointsAtTime( t, count, min, max );
+
+		*OutMinValue.GetDest() = min;
+		*OutMaxValue.GetDest() = max;
+		*OutCountValue.GetDest() = count;
+
+		TimeParam.Advance();
+		OutMinValue.Advance();
+		OutMaxValue.Advance();
+		OutCountValue.Advance();
 	}
 }
 
-void UNiagaraDataInterfaceHoudini::GetVector4Value(FVectorVMExternalFunctionContext& Context)
+void UNiagaraDataInterfaceHoudini::GetPositionAndTime(FVectorVMExternalFunctionContext& Context)
 {
+    VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
     VectorVM::FExternalFuncInputHandler<int32> SampleIndexParam(Context);
-    VectorVM::FExternalFuncInputHandler<int32> AttributeIndexParam(Context);
 
-	VectorVM::FExternalFuncRegisterHandler<float> OutVectorX(Context);
-	VectorVM::FExternalFuncRegisterHandler<float> OutVectorY(Context);
-	VectorVM::FExternalFuncRegisterHandler<float> OutVectorZ(Context);
-	VectorVM::FExternalFuncRegisterHandler<float> OutVectorW(Context);
+    VectorVM::FExternalFuncRegisterHandler<float> OutPosX(Context);
+    VectorVM::FExternalFuncRegisterHandler<float> OutPosY(Context);
+    VectorVM::FExternalFuncRegisterHandler<float> OutPosZ(Context);
+    VectorVM::FExternalFuncRegisterHandler<float> OutTime(Context);
+
+	// The whole batch reads the same sample, only read it once
+	const bool bIsConstant = SampleIndexParam.IsConstant();
+	float ConstantTimeValue = 0.0f;
+	FVector ConstantPosVector = FVector::ZeroVector;
+	if ( bIsConstant && HoudiniPointCacheAsset )
+	{
+		HoudiniPointCacheAsset->GetTimeValue( SampleIndexParam.Get(), ConstantTimeValue );
+		HoudiniPointCacheAsset->GetPositionValue( SampleIndexParam.Get(), ConstantPosVector );
+	}
 
     for (int32 i = 0; i < Context.GetNumInstances(); ++i)
     {
 		int32 SampleIndex = SampleIndexParam.Get();
-		int32 AttributeIndex = AttributeIndexParam.Get();
 
-		FVector4 V(FVector::ZeroVector, 0);
-		if ( HoudiniPointCacheAsset )
-			HoudiniPointCacheAsset->GetVector4Value(SampleIndex, AttributeIndex, V);
+		float timeValue = ConstantTimeValue;
+		FVector posVector = ConstantPosVector;
+		if ( !bIsConstant && HoudiniPointCacheAsset )
+		{
+			HoudiniPointCacheAsset->GetTimeValue( SampleIndex, timeValue);
+			HoudiniPointCacheAsset->GetPositionValue( SampleIndex, posVector);
+		}
 
-		*OutVectorX.GetDest() = V.X;
-		*OutVectorY.GetDest() = V.Y;
-		*OutVectorZ.GetDest() = V.Z;
-		*OutVectorW.GetDest() = V.W;
+		*OutPosX.GetDest() = posVector.X;
+		*OutPosY.GetDest() = posVector.Y;
+		*OutPosZ.GetDest() = posVector.Z;
+
+		*OutTime.GetDest() = timeValue;
 
 		SampleIndexParam.Advance();
-		AttributeIndexParam.Advance();
-		OutVectorX.Advance();
-		OutVectorY.Advance();
-		OutVectorZ.Advance();
-		OutVectorW.Advance();
+		OutPosX.Advance();
+		OutPosY.Advance();
+		OutPosZ.Advance();
+		OutTime.Advance();
     }
 }
 
-void UNiagaraDataInterfaceHoudini::GetVector4ValueByString(FVectorVMExternalFunctionContext& Context, const FString& Attribute)
+void UNiagaraDataInterfaceHoudini::GetSampleIndexesForPointAtTime(FVectorVMExternalFunctionContext& Context)
 {
-	VectorVM::FExternalFuncInputHandler<int32> SampleIndexParam(Context);
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
+	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
 
-	VectorVM::FExternalFuncRegisterHandler<float> OutVectorX(Context);
-	VectorVM::FExternalFuncRegisterHandler<float> OutVectorY(Context);
-	VectorVM::FExternalFuncRegisterHandler<float> OutVectorZ(Context);
-	VectorVM::FExternalFuncRegisterHandler<float> OutVectorW(Context);
+	VectorVM::FExternalFuncRegisterHandler<int32> OutPrevIndex(Context);
+	VectorVM::FExternalFuncRegisterHandler<int32> OutNextIndex(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutWeightValue(Context);
+
+	const FHoudiniPointSampleIndexesAtTime SampleIndexesAtTime( HoudiniPointCacheAsset, TimeParam, InstData.Get() );
 
 	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
-	{
-		int32 SampleIndex = SampleIndexParam.Get();
+    {
+		int32 PointID = PointIDParam.Get();
+		float time = TimeParam.Get();
 
-		FVector4 V(FVector::ZeroVector, 0);
-		if (HoudiniPointCacheAsset)
-			HoudiniPointCacheAsset->GetVector4ValueForString(SampleIndex, Attribute, V);
+		float weight = 0.0f;
+		int32 prevIdx = 0;
+		int32 nextIdx = 0;
+		SampleIndexesAtTime.Get( PointID, time, prevIdx, nextIdx, weight );
 
-		*OutVectorX.GetDest() = V.X;
-		*OutVectorY.GetDest() = V.Y;
-		*OutVectorZ.GetDest() = V.Z;
-		*OutVectorW.GetDest() = V.W;
+		*OutPrevIndex.GetDest() = prevIdx;
+		*OutNextIndex.GetDest() = nextIdx;
+		*OutWeightValue.GetDest() = weight;
 
-		SampleIndexParam.Advance();
-		OutVectorX.Advance();
-		OutVectorY.Advance();
-		OutVectorZ.Advance();
-		OutVectorW.Advance();
-	}
+		PointIDParam.Advance();
+		TimeParam.Advance();
+		OutPrevIndex.Advance();
+		OutNextIndex.Advance();
+		OutWeightValue.Advance();
+    }
 }
 
-void UNiagaraDataInterfaceHoudini::GetQuatValue(FVectorVMExternalFunctionContext& Context)
+void UNiagaraDataInterfaceHoudini::GetSampleIndexesForPointAtTimeWithCursor(FVectorVMExternalFunctionContext& Context)
 {
-	VectorVM::FExternalFuncInputHandler<int32> SampleIndexParam(Context);
-	VectorVM::FExternalFuncInputHandler<int32> AttributeIndexParam(Context);
-	VectorVM::FExternalFuncInputHandler<FNiagaraBool> DoHoudiniToUnrealConversionParam(Context);
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
+	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
+	VectorVM::FExternalFuncInputHandler<int32> SampleCursorParam(Context);
 
-	VectorVM::FExternalFuncRegisterHandler<float> OutVectorX(Context);
-	VectorVM::FExternalFuncRegisterHandler<float> OutVectorY(Context);
-	VectorVM::FExternalFuncRegisterHandler<float> OutVectorZ(Context);
-	VectorVM::FExternalFuncRegisterHandler<float> OutVectorW(Context);
+	VectorVM::FExternalFuncRegisterHandler<int32> OutPrevIndex(Context);
+	VectorVM::FExternalFuncRegisterHandler<int32> OutNextIndex(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutWeightValue(Context);
+	VectorVM::FExternalFuncRegisterHandler<int32> OutSampleCursor(Context);
+
+	const FHoudiniPointSampleIndexesAtTime SampleIndexesAtTime( HoudiniPointCacheAsset, TimeParam, InstData.Get() );
 
 	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
 	{
-		int32 SampleIndex = SampleIndexParam.Get();
-		int32 AttributeIndex = AttributeIndexParam.Get();
-
-		bool DoHoudiniToUnrealConversion = DoHoudiniToUnrealConversionParam.Get().GetValue();
+		int32 PointID = PointIDParam.Get();
+		float time = TimeParam.Get();
+		int32 SampleCursor = SampleCursorParam.Get();
 
-		FQuat Q(0, 0, 0, 0);
-		if (HoudiniPointCacheAsset)
-			HoudiniPointCacheAsset->GetQuatValue(SampleIndex, AttributeIndex, Q, DoHoudiniToUnrealConversion);
+		float weight = 0.0f;
+		int32 prevIdx = 0;
+		int32 nextIdx = 0;
+		SampleIndexesAtTime.Get( PointID, time, prevIdx, nextIdx, weight, &SampleCursor );
 
-		*OutVectorX.GetDest() = Q.X;
-		*OutVectorY.GetDest() = Q.Y;
-		*OutVectorZ.GetDest() = Q.Z;
-		*OutVectorW.GetDest() = Q.W;
+		*OutPrevIndex.GetDest() = prevIdx;
+		*OutNextIndex.GetDest() = nextIdx;
+		*OutWeightValue.GetDest() = weight;
+		*OutSampleCursor.GetDest() = SampleCursor;
 
-		SampleIndexParam.Advance();
-		AttributeIndexParam.Advance();
-		DoHoudiniToUnrealConversionParam.Advance();
-		OutVectorX.Advance();
-		OutVectorY.Advance();
-		OutVectorZ.Advance();
-		OutVectorW.Advance();
+		PointIDParam.Advance();
+		TimeParam.Advance();
+		SampleCursorParam.Advance();
+		OutPrevIndex.Advance();
+		OutNextIndex.Advance();
+		OutWeightValue.Advance();
+		OutSampleCursor.Advance();
 	}
 }
 
-void UNiagaraDataInterfaceHoudini::GetQuatValueByString(FVectorVMExternalFunctionContext& Context, const FString& Attribute)
+void UNiagaraDataInterfaceHoudini::GetPointPositionAtTimeWithCursor(FVectorVMExternalFunctionContext& Context)
 {
-	VectorVM::FExternalFuncInputHandler<int32> SampleIndexParam(Context);
-	VectorVM::FExternalFuncInputHandler<FNiagaraBool> DoHoudiniToUnrealConversionParam(Context);
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
+	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
+	VectorVM::FExternalFuncInputHandler<int32> SampleCursorParam(Context);
 
-	VectorVM::FExternalFuncRegisterHandler<float> OutVectorX(Context);
-	VectorVM::FExternalFuncRegisterHandler<float> OutVectorY(Context);
-	VectorVM::FExternalFuncRegisterHandler<float> OutVectorZ(Context);
-	VectorVM::FExternalFuncRegisterHandler<float> OutVectorW(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosX(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosY(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosZ(Context);
+	VectorVM::FExternalFuncRegisterHandler<int32> OutSampleCursor(Context);
+
+	const FHoudiniPointSampleIndexesAtTime SampleIndexesAtTime( HoudiniPointCacheAsset, TimeParam, InstData.Get() );
+	const int32 PositionAttrIndex = HoudiniPointCacheAsset ? HoudiniPointCacheAsset->GetAttributeAttributeIndex( EHoudiniAttributes::POSITION ) : INDEX_NONE;
 
 	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
 	{
-		int32 SampleIndex = SampleIndexParam.Get();
-
-		bool DoHoudiniToUnrealConversion = DoHoudiniToUnrealConversionParam.Get().GetValue();
+		int32 PointID = PointIDParam.Get();
+		float time = TimeParam.Get();
+		int32 SampleCursor = SampleCursorParam.Get();
 
-		FQuat Q(0, 0, 0, 0);
-		if (HoudiniPointCacheAsset)
-			HoudiniPointCacheAsset->GetQuatValueForString(SampleIndex, Attribute, Q, DoHoudiniToUnrealConversion);
+		FVector posVector = FVector::ZeroVector;
+		SampleIndexesAtTime.GetVectorValue( PointID, PositionAttrIndex, time, posVector, true, true, &SampleCursor );
 
-		*OutVectorX.GetDest() = Q.X;
-		*OutVectorY.GetDest() = Q.Y;
-		*OutVectorZ.GetDest() = Q.Z;
-		*OutVectorW.GetDest() = Q.W;
+		*OutPosX.GetDest() = posVector.X;
+		*OutPosY.GetDest() = posVector.Y;
+		*OutPosZ.GetDest() = posVector.Z;
+		*OutSampleCursor.GetDest() = SampleCursor;
 
-		SampleIndexParam.Advance();
-		DoHoudiniToUnrealConversionParam.Advance();
-		OutVectorX.Advance();
-		OutVectorY.Advance();
-		OutVectorZ.Advance();
-		OutVectorW.Advance();
+		PointIDParam.Advance();
+		TimeParam.Advance();
+		SampleCursorParam.Advance();
+		OutPosX.Advance();
+		OutPosY.Advance();
+		OutPosZ.Advance();
+		OutSampleCursor.Advance();
 	}
 }
 
-void UNiagaraDataInterfaceHoudini::GetFloatValueByString(FVectorVMExternalFunctionContext& Context, const FString& Attribute)
+void UNiagaraDataInterfaceHoudini::GetPointValueAtTimeWithCursor(FVectorVMExternalFunctionContext& Context)
 {
-    VectorVM::FExternalFuncInputHandler<int32> SampleIndexParam(Context);
-
-    VectorVM::FExternalFuncRegisterHandler<float> OutValue(Context);
-
-    for ( int32 i = 0; i < Context.GetNumInstances(); ++i )
-    {
-		int32 SampleIndex = SampleIndexParam.Get();
-	
-		float value = 0.0f;
-		if (HoudiniPointCacheAsset)
-			HoudiniPointCacheAsset->GetFloatValueForString(SampleIndex, Attribute, value);
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
+	VectorVM::FExternalFuncInputHandler<int32> AttributeIndexParam(Context);
+	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
+	VectorVM::FExternalFuncInputHandler<int32> SampleCursorParam(Context);
 
-		*OutValue.GetDest() = value;
-		SampleIndexParam.Advance();
-		OutValue.Advance();
-    }
-}
+	VectorVM::FExternalFuncRegisterHandler<float> OutValue(Context);
+	VectorVM::FExternalFuncRegisterHandler<int32> OutSampleCursor(Context);
 
-void UNiagaraDataInterfaceHoudini::GetPosition(FVectorVMExternalFunctionContext& Context)
-{
-	VectorVM::FExternalFuncInputHandler<int32> SampleIndexParam(Context);
+	const FHoudiniPointSampleIndexesAtTime SampleIndexesAtTime( HoudiniPointCacheAsset, TimeParam, InstData.Get() );
 
-    VectorVM::FExternalFuncRegisterHandler<float> OutSampleX(Context);
-    VectorVM::FExternalFuncRegisterHandler<float> OutSampleY(Context);
-    VectorVM::FExternalFuncRegisterHandler<float> OutSampleZ(Context);
+	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
+	{
+		int32 PointID = PointIDParam.Get();
+		int32 AttrIndex = AttributeIndexParam.Get();
+		float time = TimeParam.Get();
+		int32 SampleCursor = SampleCursorParam.Get();
 
-    for (int32 i = 0; i < Context.GetNumInstances(); ++i)
-    {
-		int32 SampleIndex = SampleIndexParam.Get();
+		float Value = 0.0f;
+		SampleIndexesAtTime.GetFloatValue( PointID, AttrIndex, time, Value, &SampleCursor );
 
-		FVector V = FVector::ZeroVector;
-		if ( HoudiniPointCacheAsset )
-			HoudiniPointCacheAsset->GetPositionValue( SampleIndex, V );
+		*OutValue.GetDest() = Value;
+		*OutSampleCursor.GetDest() = SampleCursor;
 
-		*OutSampleX.GetDest() = V.X;
-		*OutSampleY.GetDest() = V.Y;
-		*OutSampleZ.GetDest() = V.Z;
-		SampleIndexParam.Advance();
-		OutSampleX.Advance();
-		OutSampleY.Advance();
-		OutSampleZ.Advance();
-    }
+		PointIDParam.Advance();
+		AttributeIndexParam.Advance();
+		TimeParam.Advance();
+		SampleCursorParam.Advance();
+		OutValue.Advance();
+		OutSampleCursor.Advance();
+	}
 }
 
-void UNiagaraDataInterfaceHoudini::GetNormal(FVectorVMExternalFunctionContext& Context)
+void UNiagaraDataInterfaceHoudini::GetPointVectorValueAtTimeWithCursor(FVectorVMExternalFunctionContext& Context)
 {
-	VectorVM::FExternalFuncInputHandler<int32> SampleIndexParam(Context);
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
+	VectorVM::FExternalFuncInputHandler<int32> AttributeIndexParam(Context);
+	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
+	VectorVM::FExternalFuncInputHandler<int32> SampleCursorParam(Context);
 
-    VectorVM::FExternalFuncRegisterHandler<float> OutSampleX(Context);
-    VectorVM::FExternalFuncRegisterHandler<float> OutSampleY(Context);
-    VectorVM::FExternalFuncRegisterHandler<float> OutSampleZ(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosX(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosY(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosZ(Context);
+	VectorVM::FExternalFuncRegisterHandler<int32> OutSampleCursor(Context);
 
-    for (int32 i = 0; i < Context.GetNumInstances(); ++i)
-    {
-		int32 SampleIndex = SampleIndexParam.Get();
+	const FHoudiniPointSampleIndexesAtTime SampleIndexesAtTime( HoudiniPointCacheAsset, TimeParam, InstData.Get() );
 
-		FVector V = FVector::ZeroVector;
-		if ( HoudiniPointCacheAsset )
-			HoudiniPointCacheAsset->GetNormalValue( SampleIndex, V );
+	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
+	{
+		int32 PointID = PointIDParam.Get();
+		int32 AttrIndex = AttributeIndexParam.Get();
+		float time = TimeParam.Get();
+		int32 SampleCursor = SampleCursorParam.Get();
+
+		FVector posVector = FVector::ZeroVector;
+		SampleIndexesAtTime.GetVectorValue( PointID, AttrIndex, time, posVector, true, true, &SampleCursor );
+
+		*OutPosX.GetDest() = posVector.X;
+		*OutPosY.GetDest() = posVector.Y;
+		*OutPosZ.GetDest() = posVector.Z;
+		*OutSampleCursor.GetDest() = SampleCursor;
 
-		*OutSampleX.GetDest() = V.X;
-		*OutSampleY.GetDest() = V.Y;
-		*OutSampleZ.GetDest() = V.Z;
-		SampleIndexParam.Advance();
-		OutSampleX.Advance();
-		OutSampleY.Advance();
-		OutSampleZ.Advance();
-    }
+		PointIDParam.Advance();
+		AttributeIndexParam.Advance();
+		TimeParam.Advance();
+		SampleCursorParam.Advance();
+		OutPosX.Advance();
+		OutPosY.Advance();
+		OutPosZ.Advance();
+		OutSampleCursor.Advance();
+	}
 }
 
-void UNiagaraDataInterfaceHoudini::GetTime(FVectorVMExternalFunctionContext& Context)
+void UNiagaraDataInterfaceHoudini::GetPointValueAtTimeWithCursorByString(FVectorVMExternalFunctionContext& Context, int32 AttributeIndex)
 {
-	VectorVM::FExternalFuncInputHandler<int32> SampleIndexParam(Context);
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
+	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
+	VectorVM::FExternalFuncInputHandler<int32> SampleCursorParam(Context);
 
-    VectorVM::FExternalFuncRegisterHandler<float> OutValue(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutValue(Context);
+	VectorVM::FExternalFuncRegisterHandler<int32> OutSampleCursor(Context);
 
-    for (int32 i = 0; i < Context.GetNumInstances(); ++i)
-    {
-		int32 SampleIndex = SampleIndexParam.Get();
+	const FHoudiniPointSampleIndexesAtTime SampleIndexesAtTime( HoudiniPointCacheAsset, TimeParam, InstData.Get() );
 
-		float value = 0.0f;
-		if ( HoudiniPointCacheAsset )
-			HoudiniPointCacheAsset->GetTimeValue( SampleIndex, value );
+	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
+	{
+		int32 PointID = PointIDParam.Get();
+		float time = TimeParam.Get();
+		int32 SampleCursor = SampleCursorParam.Get();
 
-		*OutValue.GetDest() = value;
-		SampleIndexParam.Advance();
+		float Value = 0.0f;
+		SampleIndexesAtTime.GetFloatValue( PointID, AttributeIndex, time, Value, &SampleCursor );
+
+		*OutValue.GetDest() = Value;
+		*OutSampleCursor.GetDest() = SampleCursor;
+
+		PointIDParam.Advance();
+		TimeParam.Advance();
+		SampleCursorParam.Advance();
 		OutValue.Advance();
-    }
+		OutSampleCursor.Advance();
+	}
 }
 
-void UNiagaraDataInterfaceHoudini::GetVelocity(FVectorVMExternalFunctionContext& Context)
+void UNiagaraDataInterfaceHoudini::GetPointVectorValueAtTimeWithCursorByString(FVectorVMExternalFunctionContext& Context, int32 AttributeIndex)
 {
-	VectorVM::FExternalFuncInputHandler<int32> SampleIndexParam(Context);
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
+	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
+	VectorVM::FExternalFuncInputHandler<int32> SampleCursorParam(Context);
 
-	VectorVM::FExternalFuncRegisterHandler<float> OutSampleX(Context);
-	VectorVM::FExternalFuncRegisterHandler<float> OutSampleY(Context);
-	VectorVM::FExternalFuncRegisterHandler<float> OutSampleZ(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosX(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosY(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosZ(Context);
+	VectorVM::FExternalFuncRegisterHandler<int32> OutSampleCursor(Context);
+
+	const FHoudiniPointSampleIndexesAtTime SampleIndexesAtTime( HoudiniPointCacheAsset, TimeParam, InstData.Get() );
 
 	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
 	{
-		int32 SampleIndex = SampleIndexParam.Get();
+		int32 PointID = PointIDParam.Get();
+		float time = TimeParam.Get();
+		int32 SampleCursor = SampleCursorParam.Get();
 
-		FVector V = FVector::ZeroVector;
-		if ( HoudiniPointCacheAsset )
-			HoudiniPointCacheAsset->GetVelocityValue( SampleIndex, V );
+		FVector posVector = FVector::ZeroVector;
+		SampleIndexesAtTime.GetVectorValue( PointID, AttributeIndex, time, posVector, true, true, &SampleCursor );
 
-		*OutSampleX.GetDest() = V.X;
-		*OutSampleY.GetDest() = V.Y;
-		*OutSampleZ.GetDest() = V.Z;
-		SampleIndexParam.Advance();
-		OutSampleX.Advance();
-		OutSampleY.Advance();
-		OutSampleZ.Advance();
+		*OutPosX.GetDest() = posVector.X;
+		*OutPosY.GetDest() = posVector.Y;
+		*OutPosZ.GetDest() = posVector.Z;
+		*OutSampleCursor.GetDest() = SampleCursor;
+
+		PointIDParam.Advance();
+		TimeParam.Advance();
+		SampleCursorParam.Advance();
+		OutPosX.Advance();
+		OutPosY.Advance();
+		OutPosZ.Advance();
+		OutSampleCursor.Advance();
 	}
 }
 
-void UNiagaraDataInterfaceHoudini::GetColor(FVectorVMExternalFunctionContext& Context)
+void UNiagaraDataInterfaceHoudini::GetPointVectorValueAtTimeExWithCursor(FVectorVMExternalFunctionContext& Context)
 {
-	VectorVM::FExternalFuncInputHandler<int32> SampleIndexParam(Context);
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
+	VectorVM::FExternalFuncInputHandler<int32> AttributeIndexParam(Context);
+	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
+	VectorVM::FExternalFuncInputHandler<FNiagaraBool> DoSwapParam(Context);
+	VectorVM::FExternalFuncInputHandler<FNiagaraBool> DoScaleParam(Context);
+	VectorVM::FExternalFuncInputHandler<int32> SampleCursorParam(Context);
 
-	VectorVM::FExternalFuncRegisterHandler<float> OutSampleR(Context);
-	VectorVM::FExternalFuncRegisterHandler<float> OutSampleG(Context);
-	VectorVM::FExternalFuncRegisterHandler<float> OutSampleB(Context);
-	VectorVM::FExternalFuncRegisterHandler<float> OutSampleA(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosX(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosY(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosZ(Context);
+	VectorVM::FExternalFuncRegisterHandler<int32> OutSampleCursor(Context);
+
+	const FHoudiniPointSampleIndexesAtTime SampleIndexesAtTime( HoudiniPointCacheAsset, TimeParam, InstData.Get() );
 
 	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
 	{
-		int32 SampleIndex = SampleIndexParam.Get();
+		int32 PointID = PointIDParam.Get();
+		int32 AttrIndex = AttributeIndexParam.Get();
+		float time = TimeParam.Get();
+		int32 SampleCursor = SampleCursorParam.Get();
 
-		FLinearColor C = FLinearColor::White;
-		if ( HoudiniPointCacheAsset )
-			HoudiniPointCacheAsset->GetColorValue( SampleIndex, C );
+		bool DoSwap = DoSwapParam.Get().GetValue();
+		bool DoScale = DoScaleParam.Get().GetValue();
 
-		*OutSampleR.GetDest() = C.R;
-		*OutSampleG.GetDest() = C.G;
-		*OutSampleB.GetDest() = C.B;
-		*OutSampleA.GetDest() = C.A;
-		SampleIndexParam.Advance();
-		OutSampleR.Advance();
-		OutSampleG.Advance();
-		OutSampleB.Advance();
-		OutSampleA.Advance();
+		FVector posVector = FVector::ZeroVector;
+		SampleIndexesAtTime.GetVectorValue( PointID, AttrIndex, time, posVector, DoSwap, DoScale, &SampleCursor );
+
+		*OutPosX.GetDest() = posVector.X;
+		*OutPosY.GetDest() = posVector.Y;
+		*OutPosZ.GetDest() = posVector.Z;
+		*OutSampleCursor.GetDest() = SampleCursor;
+
+		PointIDParam.Advance();
+		AttributeIndexParam.Advance();
+		TimeParam.Advance();
+		DoSwapParam.Advance();
+		DoScaleParam.Advance();
+		SampleCursorParam.Advance();
+		OutPosX.Advance();
+		OutPosY.Advance();
+		OutPosZ.Advance();
+		OutSampleCursor.Advance();
 	}
 }
 
-void UNiagaraDataInterfaceHoudini::GetImpulse(FVectorVMExternalFunctionContext& Context)
+void UNiagaraDataInterfaceHoudini::GetPointVectorValueAtTimeExWithCursorByString(FVectorVMExternalFunctionContext& Context, int32 AttributeIndex)
 {
-	VectorVM::FExternalFuncInputHandler<int32> SampleIndexParam(Context);
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
+	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
+	VectorVM::FExternalFuncInputHandler<FNiagaraBool> DoSwapParam(Context);
+	VectorVM::FExternalFuncInputHandler<FNiagaraBool> DoScaleParam(Context);
+	VectorVM::FExternalFuncInputHandler<int32> SampleCursorParam(Context);
 
-	VectorVM::FExternalFuncRegisterHandler<float> OutValue(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosX(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosY(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosZ(Context);
+	VectorVM::FExternalFuncRegisterHandler<int32> OutSampleCursor(Context);
+
+	const FHoudiniPointSampleIndexesAtTime SampleIndexesAtTime( HoudiniPointCacheAsset, TimeParam, InstData.Get() );
 
 	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
 	{
-		int32 SampleIndex = SampleIndexParam.Get();
+		int32 PointID = PointIDParam.Get();
+		float time = TimeParam.Get();
+		int32 SampleCursor = SampleCursorParam.Get();
 
-		float value = 0.0f;
-		if (HoudiniPointCacheAsset)
-			HoudiniPointCacheAsset->GetImpulseValue(SampleIndex, value);
+		bool DoSwap = DoSwapParam.Get().GetValue();
+		bool DoScale = DoScaleParam.Get().GetValue();
 
-		*OutValue.GetDest() = value;
-		SampleIndexParam.Advance();
-		OutValue.Advance();
+		FVector posVector = FVector::ZeroVector;
+		SampleIndexesAtTime.GetVectorValue( PointID, AttributeIndex, time, posVector, DoSwap, DoScale, &SampleCursor );
+
+		*OutPosX.GetDest() = posVector.X;
+		*OutPosY.GetDest() = posVector.Y;
+		*OutPosZ.GetDest() = posVector.Z;
+		*OutSampleCursor.GetDest() = SampleCursor;
+
+		PointIDParam.Advance();
+		TimeParam.Advance();
+		DoSwapParam.Advance();
+		DoScaleParam.Advance();
+		SampleCursorParam.Advance();
+		OutPosX.Advance();
+		OutPosY.Advance();
+		OutPosZ.Advance();
+		OutSampleCursor.Advance();
 	}
 }
 
-// Returns the last index of the points that should be spawned at time t
-void UNiagaraDataInterfaceHoudini::GetLastSampleIndexAtTime(FVectorVMExternalFunctionContext& Context)
+void UNiagaraDataInterfaceHoudini::GetPointVector4ValueAtTimeWithCursor(FVectorVMExternalFunctionContext& Context)
 {
-    VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
+	VectorVM::FExternalFuncInputHandler<int32> AttributeIndexParam(Context);
+	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
+	VectorVM::FExternalFuncInputHandler<int32> SampleCursorParam(Context);
 
-    VectorVM::FExternalFuncRegisterHandler<int32> OutValue(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosX(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosY(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosZ(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosW(Context);
+	VectorVM::FExternalFuncRegisterHandler<int32> OutSampleCursor(Context);
 
-    for (int32 i = 0; i < Context.GetNumInstances(); ++i)
-    {
-		float t = TimeParam.Get();
+	const FHoudiniPointSampleIndexesAtTime SampleIndexesAtTime( HoudiniPointCacheAsset, TimeParam, InstData.Get() );
 
-		int32 value = 0;
-		if ( HoudiniPointCacheAsset )
-			HoudiniPointCacheAsset->GetLastSampleIndexAtTime( t, value );
+	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
+	{
+		int32 PointID = PointIDParam.Get();
+		int32 AttrIndex = AttributeIndexParam.Get();
+		float time = TimeParam.Get();
+		int32 SampleCursor = SampleCursorParam.Get();
 
-		*OutValue.GetDest() = value;
+		FVector4 posVector(FVector::ZeroVector, 0);
+		SampleIndexesAtTime.GetVector4Value( PointID, AttrIndex, time, posVector, &SampleCursor );
+
+		*OutPosX.GetDest() = posVector.X;
+		*OutPosY.GetDest() = posVector.Y;
+		*OutPosZ.GetDest() = posVector.Z;
+		*OutPosW.GetDest() = posVector.W;
+		*OutSampleCursor.GetDest() = SampleCursor;
+
+		PointIDParam.Advance();
+		AttributeIndexParam.Advance();
 		TimeParam.Advance();
-		OutValue.Advance();
-    }
+		SampleCursorParam.Advance();
+		OutPosX.Advance();
+		OutPosY.Advance();
+		OutPosZ.Advance();
+		OutPosW.Advance();
+		OutSampleCursor.Advance();
+	}
 }
 
-// Returns the last index of the points that should be spawned at time t
-void UNiagaraDataInterfaceHoudini::GetPointIDsToSpawnAtTime(FVectorVMExternalFunctionContext& Context)
+void UNiagaraDataInterfaceHoudini::GetPointVector4ValueAtTimeWithCursorByString(FVectorVMExternalFunctionContext& Context, int32 AttributeIndex)
 {
-    VectorVM::FExternalFuncInputHandler<float> TimeParam( Context );
-	VectorVM::FExternalFuncInputHandler<float> LastSpawnTimeParam( Context );
-	VectorVM::FExternalFuncInputHandler<float> LastSpawnTimeRequestParam( Context );
-	VectorVM::FExternalFuncInputHandler<int32> LastSpawnedPointIDParam( Context );
-	VectorVM::FExternalFuncInputHandler<bool>  ResetSpawnStateParam( Context );
-
-    VectorVM::FExternalFuncRegisterHandler<int32> OutMinValue( Context );
-    VectorVM::FExternalFuncRegisterHandler<int32> OutMaxValue( Context );
-    VectorVM::FExternalFuncRegisterHandler<int32> OutCountValue( Context );
-	VectorVM::FExternalFuncRegisterHandler<float> OutLastSpawnTimeValue( Context );
-	VectorVM::FExternalFuncRegisterHandler<float> OutLastSpawnTimeRequestValue( Context );
-	VectorVM::FExternalFuncRegisterHandler<int32> OutLastSpawnedPointIDValue( Context );
-
-    for (int32 i = 0; i < Context.GetNumInstances(); ++i)
-    {
-		float t = TimeParam.Get();
-		float LastSpawnTime = LastSpawnTimeParam.Get();
-		float LastSpawnTimeRequest = LastSpawnTimeRequestParam.Get();
-		int32 LastSpawnedPointID = LastSpawnedPointIDParam.Get();
-		bool  ResetSpawnState = ResetSpawnStateParam.Get();
-
-		if (ResetSpawnState)
-		{
-			LastSpawnTime = -FLT_MAX;
-			LastSpawnTimeRequest = -FLT_MAX;
-			LastSpawnedPointID = -1;
-		}
-		
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
+	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
+	VectorVM::FExternalFuncInputHandler<int32> SampleCursorParam(Context);
 
-		int32 value = 0;
-		int32 min = 0, max = 0, count = 0;
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosX(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosY(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosZ(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosW(Context);
+	VectorVM::FExternalFuncRegisterHandler<int32> OutSampleCursor(Context);
 
-		if ( HoudiniPointCacheAsset )
-		{
-			HoudiniPointCacheAsset->GetPointIDsToSpawnAtTime(t, min, max, count, LastSpawnedPointID, LastSpawnTime, LastSpawnTimeRequest);
-		}
+	const FHoudiniPointSampleIndexesAtTime SampleIndexesAtTime( HoudiniPointCacheAsset, TimeParam, InstData.Get() );
 
-		*OutMinValue.GetDest() = min;
-		*OutMaxValue.GetDest() = max;
-		*OutCountValue.GetDest() = count;
+	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
+	{
+		int32 PointID = PointIDParam.Get();
+		float time = TimeParam.Get();
+		int32 SampleCursor = SampleCursorParam.Get();
 
-		*OutLastSpawnTimeValue.GetDest() = LastSpawnTime;
-		*OutLastSpawnTimeRequestValue.GetDest() = LastSpawnTimeRequest;
-		*OutLastSpawnedPointIDValue.GetDest() = LastSpawnedPointID;
+		FVector4 posVector(FVector::ZeroVector, 0);
+		SampleIndexesAtTime.GetVector4Value( PointID, AttributeIndex, time, posVector, &SampleCursor );
 
+		*OutPosX.GetDest() = posVector.X;
+		*OutPosY.GetDest() = posVector.Y;
+		*OutPosZ.GetDest() = posVector.Z;
+		*OutPosW.GetDest() = posVector.W;
+		*OutSampleCursor.GetDest() = SampleCursor;
 
+		PointIDParam.Advance();
 		TimeParam.Advance();
-		OutMinValue.Advance();
-		OutMaxValue.Advance();
-		OutCountValue.Advance();
-		OutLastSpawnTimeValue.Advance();
-		OutLastSpawnTimeRequestValue.Advance();
-		OutLastSpawnedPointIDValue.Advance();
-    }
+		SampleCursorParam.Advance();
+		OutPosX.Advance();
+		OutPosY.Advance();
+		OutPosZ.Advance();
+		OutPosW.Advance();
+		OutSampleCursor.Advance();
+	}
 }
 
-void UNiagaraDataInterfaceHoudini::GetPositionAndTime(FVectorVMExternalFunctionContext& Context)
+void UNiagaraDataInterfaceHoudini::GetPointQuatValueAtTimeWithCursor(FVectorVMExternalFunctionContext& Context)
 {
-    VectorVM::FExternalFuncInputHandler<int32> SampleIndexParam(Context);
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
+	VectorVM::FExternalFuncInputHandler<int32> AttributeIndexParam(Context);
+	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
+	VectorVM::FExternalFuncInputHandler<FNiagaraBool> DoHoudiniToUnrealConversionParam(Context);
+	VectorVM::FExternalFuncInputHandler<int32> SampleCursorParam(Context);
 
-    VectorVM::FExternalFuncRegisterHandler<float> OutPosX(Context);
-    VectorVM::FExternalFuncRegisterHandler<float> OutPosY(Context);
-    VectorVM::FExternalFuncRegisterHandler<float> OutPosZ(Context);
-    VectorVM::FExternalFuncRegisterHandler<float> OutTime(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosX(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosY(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosZ(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosW(Context);
+	VectorVM::FExternalFuncRegisterHandler<int32> OutSampleCursor(Context);
 
-    for (int32 i = 0; i < Context.GetNumInstances(); ++i)
-    {
-		int32 SampleIndex = SampleIndexParam.Get();
+	const FHoudiniPointSampleIndexesAtTime SampleIndexesAtTime( HoudiniPointCacheAsset, TimeParam, InstData.Get() );
 
-		float timeValue = 0.0f;
-		FVector posVector = FVector::ZeroVector;
-		if ( HoudiniPointCacheAsset )
-		{
-			HoudiniPointCacheAsset->GetTimeValue( SampleIndex, timeValue);
-			HoudiniPointCacheAsset->GetPositionValue( SampleIndex, posVector);
-		}
+	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
+	{
+		int32 PointID = PointIDParam.Get();
+		int32 AttrIndex = AttributeIndexParam.Get();
+		float time = TimeParam.Get();
+		int32 SampleCursor = SampleCursorParam.Get();
 
-		*OutPosX.GetDest() = posVector.X;
-		*OutPosY.GetDest() = posVector.Y;
-		*OutPosZ.GetDest() = posVector.Z;
+		bool DoHoudiniToUnrealConversion = DoHoudiniToUnrealConversionParam.Get().GetValue();
 
-		*OutTime.GetDest() = timeValue;
+		FQuat Q(0, 0, 0, 0);
+		SampleIndexesAtTime.GetQuatValue( PointID, AttrIndex, time, Q, DoHoudiniToUnrealConversion, &SampleCursor );
 
-		SampleIndexParam.Advance();
+		*OutPosX.GetDest() = Q.X;
+		*OutPosY.GetDest() = Q.Y;
+		*OutPosZ.GetDest() = Q.Z;
+		*OutPosW.GetDest() = Q.W;
+		*OutSampleCursor.GetDest() = SampleCursor;
+
+		PointIDParam.Advance();
+		AttributeIndexParam.Advance();
+		TimeParam.Advance();
+		DoHoudiniToUnrealConversionParam.Advance();
+		SampleCursorParam.Advance();
 		OutPosX.Advance();
 		OutPosY.Advance();
 		OutPosZ.Advance();
-		OutTime.Advance();
-    }
+		OutPosW.Advance();
+		OutSampleCursor.Advance();
+	}
 }
 
-void UNiagaraDataInterfaceHoudini::GetSampleIndexesForPointAtTime(FVectorVMExternalFunctionContext& Context)
+void UNiagaraDataInterfaceHoudini::GetPointQuatValueAtTimeWithCursorByString(FVectorVMExternalFunctionContext& Context, int32 AttributeIndex)
 {
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
 	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
 	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
+	VectorVM::FExternalFuncInputHandler<FNiagaraBool> DoHoudiniToUnrealConversionParam(Context);
+	VectorVM::FExternalFuncInputHandler<int32> SampleCursorParam(Context);
 
-	VectorVM::FExternalFuncRegisterHandler<int32> OutPrevIndex(Context);
-	VectorVM::FExternalFuncRegisterHandler<int32> OutNextIndex(Context);
-	VectorVM::FExternalFuncRegisterHandler<float> OutWeightValue(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosX(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosY(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosZ(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosW(Context);
+	VectorVM::FExternalFuncRegisterHandler<int32> OutSampleCursor(Context);
+
+	const FHoudiniPointSampleIndexesAtTime SampleIndexesAtTime( HoudiniPointCacheAsset, TimeParam, InstData.Get() );
 
 	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
-    {
+	{
 		int32 PointID = PointIDParam.Get();
 		float time = TimeParam.Get();
+		int32 SampleCursor = SampleCursorParam.Get();
 
-		float weight = 0.0f;
-		int32 prevIdx = 0;
-		int32 nextIdx = 0;
-		if ( HoudiniPointCacheAsset )
-		{
-			HoudiniPointCacheAsset->GetSampleIndexesForPointAtTime( PointID, time, prevIdx, nextIdx, weight );
-		}
+		bool DoHoudiniToUnrealConversion = DoHoudiniToUnrealConversionParam.Get().GetValue();
 
-		*OutPrevIndex.GetDest() = prevIdx;
-		*OutNextIndex.GetDest() = nextIdx;
-		*OutWeightValue.GetDest() = weight;
+		FQuat Q(0, 0, 0, 0);
+		SampleIndexesAtTime.GetQuatValue( PointID, AttributeIndex, time, Q, DoHoudiniToUnrealConversion, &SampleCursor );
+
+		*OutPosX.GetDest() = Q.X;
+		*OutPosY.GetDest() = Q.Y;
+		*OutPosZ.GetDest() = Q.Z;
+		*OutPosW.GetDest() = Q.W;
+		*OutSampleCursor.GetDest() = SampleCursor;
 
 		PointIDParam.Advance();
 		TimeParam.Advance();
-		OutPrevIndex.Advance();
-		OutNextIndex.Advance();
-		OutWeightValue.Advance();
-    }
+		DoHoudiniToUnrealConversionParam.Advance();
+		SampleCursorParam.Advance();
+		OutPosX.Advance();
+		OutPosY.Advance();
+		OutPosZ.Advance();
+		OutPosW.Advance();
+		OutSampleCursor.Advance();
+	}
 }
 
 void UNiagaraDataInterfaceHoudini::GetPointPositionAtTime(FVectorVMExternalFunctionContext& Context)
 {
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
 	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
 	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
 
@@ -1909,16 +3625,16 @@ void UNiagaraDataInterfaceHoudini::GetPointPositionAtTime(FVectorVMExternalFunct
 	VectorVM::FExternalFuncRegisterHandler<float> OutPosY(Context);
 	VectorVM::FExternalFuncRegisterHandler<float> OutPosZ(Context);
 
+	const FHoudiniPointSampleIndexesAtTime SampleIndexesAtTime( HoudiniPointCacheAsset, TimeParam, InstData.Get() );
+	const int32 PositionAttrIndex = HoudiniPointCacheAsset ? HoudiniPointCacheAsset->GetAttributeAttributeIndex( EHoudiniAttributes::POSITION ) : INDEX_NONE;
+
 	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
     {
 		int32 PointID = PointIDParam.Get();
 		float time = TimeParam.Get();
 
 		FVector posVector = FVector::ZeroVector;
-		if ( HoudiniPointCacheAsset )
-		{
-			HoudiniPointCacheAsset->GetPointPositionAtTime(PointID, time, posVector);
-		}		
+		SampleIndexesAtTime.GetVectorValue( PointID, PositionAttrIndex, time, posVector, true, true );
 
 		*OutPosX.GetDest() = posVector.X;
 		*OutPosY.GetDest() = posVector.Y;
@@ -1934,12 +3650,15 @@ void UNiagaraDataInterfaceHoudini::GetPointPositionAtTime(FVectorVMExternalFunct
 
 void UNiagaraDataInterfaceHoudini::GetPointValueAtTime(FVectorVMExternalFunctionContext& Context)
 {
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
 	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
 	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
 	VectorVM::FExternalFuncInputHandler<int32> AttributeIndexParam(Context);
 
 	VectorVM::FExternalFuncRegisterHandler<float> OutValue(Context);
 
+	const FHoudiniPointSampleIndexesAtTime SampleIndexesAtTime( HoudiniPointCacheAsset, TimeParam, InstData.Get() );
+
 	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
 	{
 		int32 PointID = PointIDParam.Get();
@@ -1947,9 +3666,37 @@ void UNiagaraDataInterfaceHoudini::GetPointValueAtTime(FVectorVMExternalFunction
 		float time = TimeParam.Get();		
 
 		float Value = 0.0f;
+		SampleIndexesAtTime.GetFloatValue( PointID, AttrIndex, time, Value );
+
+		*OutValue.GetDest() = Value;
+
+		PointIDParam.Advance();
+		AttributeIndexParam.Advance();
+		TimeParam.Advance();
+
+		OutValue.Advance();
+	}
+}
+
+void UNiagaraDataInterfaceHoudini::GetPointIntValueAtTime(FVectorVMExternalFunctionContext& Context)
+{
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
+	VectorVM::FExternalFuncInputHandler<int32> AttributeIndexParam(Context);
+	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
+
+	VectorVM::FExternalFuncRegisterHandler<int32> OutValue(Context);
+
+	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
+	{
+		int32 PointID = PointIDParam.Get();
+		int32 AttrIndex = AttributeIndexParam.Get();
+		float time = TimeParam.Get();
+
+		int32 Value = 0;
 		if ( HoudiniPointCacheAsset )
 		{
-			HoudiniPointCacheAsset->GetPointValueAtTime( PointID, AttrIndex, time, Value );
+			HoudiniPointCacheAsset->GetPointInt32ValueAtTime( PointID, AttrIndex, time, Value );
 		}
 
 		*OutValue.GetDest() = Value;
@@ -1962,8 +3709,9 @@ void UNiagaraDataInterfaceHoudini::GetPointValueAtTime(FVectorVMExternalFunction
 	}
 }
 
-void UNiagaraDataInterfaceHoudini::GetPointValueAtTimeByString(FVectorVMExternalFunctionContext& Context, const FString& Attribute)
+void UNiagaraDataInterfaceHoudini::GetPointValueAtTimeByString(FVectorVMExternalFunctionContext& Context, int32 AttributeIndex)
 {
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
 	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
 	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
 
@@ -1977,7 +3725,7 @@ void UNiagaraDataInterfaceHoudini::GetPointValueAtTimeByString(FVectorVMExternal
 		float Value = 0.0f;
 		if (HoudiniPointCacheAsset)
 		{
-			HoudiniPointCacheAsset->GetPointValueAtTimeForString(PointID, Attribute, time, Value);
+			HoudiniPointCacheAsset->GetPointValueAtTime(PointID, AttributeIndex, time, Value);
 		}
 
 		*OutValue.GetDest() = Value;
@@ -1991,6 +3739,7 @@ void UNiagaraDataInterfaceHoudini::GetPointValueAtTimeByString(FVectorVMExternal
 
 void UNiagaraDataInterfaceHoudini::GetPointVectorValueAtTime(FVectorVMExternalFunctionContext& Context)
 {
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
 	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
 	VectorVM::FExternalFuncInputHandler<int32> AttributeIndexParam(Context);
 	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);	
@@ -1999,6 +3748,8 @@ void UNiagaraDataInterfaceHoudini::GetPointVectorValueAtTime(FVectorVMExternalFu
 	VectorVM::FExternalFuncRegisterHandler<float> OutPosY(Context);
 	VectorVM::FExternalFuncRegisterHandler<float> OutPosZ(Context);
 
+	const FHoudiniPointSampleIndexesAtTime SampleIndexesAtTime( HoudiniPointCacheAsset, TimeParam, InstData.Get() );
+
 	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
 	{
 		int32 PointID = PointIDParam.Get();
@@ -2006,10 +3757,7 @@ void UNiagaraDataInterfaceHoudini::GetPointVectorValueAtTime(FVectorVMExternalFu
 		float time = TimeParam.Get();		
 
 		FVector posVector = FVector::ZeroVector;
-		if ( HoudiniPointCacheAsset )
-		{
-			HoudiniPointCacheAsset->GetPointVectorValueAtTime( PointID, AttrIndex, time, posVector, true, true);
-		}
+		SampleIndexesAtTime.GetVectorValue( PointID, AttrIndex, time, posVector, true, true );
 
 		*OutPosX.GetDest() = posVector.X;
 		*OutPosY.GetDest() = posVector.Y;
@@ -2025,8 +3773,9 @@ void UNiagaraDataInterfaceHoudini::GetPointVectorValueAtTime(FVectorVMExternalFu
 	}
 }
 
-void UNiagaraDataInterfaceHoudini::GetPointVectorValueAtTimeByString(FVectorVMExternalFunctionContext& Context, const FString& Attribute)
+void UNiagaraDataInterfaceHoudini::GetPointVectorValueAtTimeByString(FVectorVMExternalFunctionContext& Context, int32 AttributeIndex)
 {
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
 	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
 	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
 
@@ -2042,7 +3791,7 @@ void UNiagaraDataInterfaceHoudini::GetPointVectorValueAtTimeByString(FVectorVMEx
 		FVector posVector = FVector::ZeroVector;
 		if (HoudiniPointCacheAsset)
 		{
-			HoudiniPointCacheAsset->GetPointVectorValueAtTimeForString(PointID, Attribute, time, posVector, true, true);
+			HoudiniPointCacheAsset->GetPointVectorValueAtTime(PointID, AttributeIndex, time, posVector, true, true);
 		}
 
 		*OutPosX.GetDest() = posVector.X;
@@ -2060,6 +3809,7 @@ void UNiagaraDataInterfaceHoudini::GetPointVectorValueAtTimeByString(FVectorVMEx
 
 void UNiagaraDataInterfaceHoudini::GetPointVectorValueAtTimeEx(FVectorVMExternalFunctionContext& Context)
 {
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
 	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
 	VectorVM::FExternalFuncInputHandler<int32> AttributeIndexParam(Context);
 	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
@@ -2101,8 +3851,9 @@ void UNiagaraDataInterfaceHoudini::GetPointVectorValueAtTimeEx(FVectorVMExternal
 	}
 }
 
-void UNiagaraDataInterfaceHoudini::GetPointVectorValueAtTimeExByString(FVectorVMExternalFunctionContext& Context, const FString& Attribute)
+void UNiagaraDataInterfaceHoudini::GetPointVectorValueAtTimeExByString(FVectorVMExternalFunctionContext& Context, int32 AttributeIndex)
 {
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
 	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
 	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
 	VectorVM::FExternalFuncInputHandler<FNiagaraBool> DoSwapParam(Context);
@@ -2123,7 +3874,7 @@ void UNiagaraDataInterfaceHoudini::GetPointVectorValueAtTimeExByString(FVectorVM
 		FVector posVector = FVector::ZeroVector;
 		if (HoudiniPointCacheAsset)
 		{
-			HoudiniPointCacheAsset->GetPointVectorValueAtTimeForString(PointID, Attribute, time, posVector, DoSwap, DoScale);
+			HoudiniPointCacheAsset->GetPointVectorValueAtTime(PointID, AttributeIndex, time, posVector, DoSwap, DoScale);
 		}
 
 		*OutPosX.GetDest() = posVector.X;
@@ -2143,6 +3894,7 @@ void UNiagaraDataInterfaceHoudini::GetPointVectorValueAtTimeExByString(FVectorVM
 
 void UNiagaraDataInterfaceHoudini::GetPointVector4ValueAtTime(FVectorVMExternalFunctionContext& Context)
 {
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
 	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
 	VectorVM::FExternalFuncInputHandler<int32> AttributeIndexParam(Context);
 	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);	
@@ -2180,8 +3932,9 @@ void UNiagaraDataInterfaceHoudini::GetPointVector4ValueAtTime(FVectorVMExternalF
 	}
 }
 
-void UNiagaraDataInterfaceHoudini::GetPointVector4ValueAtTimeByString(FVectorVMExternalFunctionContext& Context, const FString& Attribute)
+void UNiagaraDataInterfaceHoudini::GetPointVector4ValueAtTimeByString(FVectorVMExternalFunctionContext& Context, int32 AttributeIndex)
 {
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
 	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
 	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
 
@@ -2198,7 +3951,7 @@ void UNiagaraDataInterfaceHoudini::GetPointVector4ValueAtTimeByString(FVectorVME
 		FVector4 posVector(FVector::ZeroVector, 0);
 		if (HoudiniPointCacheAsset)
 		{
-			HoudiniPointCacheAsset->GetPointVector4ValueAtTimeForString(PointID, Attribute, time, posVector);
+			HoudiniPointCacheAsset->GetPointVector4ValueAtTime(PointID, AttributeIndex, time, posVector);
 		}
 
 		*OutPosX.GetDest() = posVector.X;
@@ -2218,6 +3971,7 @@ void UNiagaraDataInterfaceHoudini::GetPointVector4ValueAtTimeByString(FVectorVME
 
 void UNiagaraDataInterfaceHoudini::GetPointQuatValueAtTime(FVectorVMExternalFunctionContext& Context)
 {
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
 	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
 	VectorVM::FExternalFuncInputHandler<int32> AttributeIndexParam(Context);
 	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
@@ -2259,8 +4013,9 @@ void UNiagaraDataInterfaceHoudini::GetPointQuatValueAtTime(FVectorVMExternalFunc
 	}
 }
 
-void UNiagaraDataInterfaceHoudini::GetPointQuatValueAtTimeByString(FVectorVMExternalFunctionContext& Context, const FString& Attribute)
+void UNiagaraDataInterfaceHoudini::GetPointQuatValueAtTimeByString(FVectorVMExternalFunctionContext& Context, int32 AttributeIndex)
 {
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
 	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
 	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
 	VectorVM::FExternalFuncInputHandler<FNiagaraBool> DoHoudiniToUnrealConversionParam(Context);
@@ -2280,7 +4035,7 @@ void UNiagaraDataInterfaceHoudini::GetPointQuatValueAtTimeByString(FVectorVMExte
 		FQuat Q(0, 0, 0, 0);
 		if (HoudiniPointCacheAsset)
 		{
-			HoudiniPointCacheAsset->GetPointQuatValueAtTimeForString(PointID, Attribute, time, Q, DoHoudiniToUnrealConversion);
+			HoudiniPointCacheAsset->GetPointQuatValueAtTime(PointID, AttributeIndex, time, Q, DoHoudiniToUnrealConversion);
 		}
 
 		*OutPosX.GetDest() = Q.X;
@@ -2301,6 +4056,7 @@ void UNiagaraDataInterfaceHoudini::GetPointQuatValueAtTimeByString(FVectorVMExte
 
 void UNiagaraDataInterfaceHoudini::GetPointLife(FVectorVMExternalFunctionContext& Context)
 {
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
 	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
 
 	VectorVM::FExternalFuncRegisterHandler<float> OutValue(Context);
@@ -2326,6 +4082,7 @@ void UNiagaraDataInterfaceHoudini::GetPointLife(FVectorVMExternalFunctionContext
 //template<typename VectorVM::FExternalFuncInputHandler<int32>, typename VectorVM::FExternalFuncInputHandler<float>>
 void UNiagaraDataInterfaceHoudini::GetPointLifeAtTime(FVectorVMExternalFunctionContext& Context)
 {
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
 	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
 	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
 
@@ -2353,6 +4110,7 @@ void UNiagaraDataInterfaceHoudini::GetPointLifeAtTime(FVectorVMExternalFunctionC
 
 void UNiagaraDataInterfaceHoudini::GetPointType(FVectorVMExternalFunctionContext& Context)
 {
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
 	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
 
 	VectorVM::FExternalFuncRegisterHandler<int32> OutValue(Context);
@@ -2377,6 +4135,7 @@ void UNiagaraDataInterfaceHoudini::GetPointType(FVectorVMExternalFunctionContext
 
 void UNiagaraDataInterfaceHoudini::GetPointGenericVectorAttributeAtTime(EHoudiniAttributes Attribute, FVectorVMExternalFunctionContext& Context, bool DoSwap, bool DoScale)
 {
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
 	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
 	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
 
@@ -2384,17 +4143,16 @@ void UNiagaraDataInterfaceHoudini::GetPointGenericVectorAttributeAtTime(EHoudini
 	VectorVM::FExternalFuncRegisterHandler<float> OutVecY(Context);
 	VectorVM::FExternalFuncRegisterHandler<float> OutVecZ(Context);
 
+	const FHoudiniPointSampleIndexesAtTime SampleIndexesAtTime( HoudiniPointCacheAsset, TimeParam, InstData.Get() );
+	const int32 AttrIndex = HoudiniPointCacheAsset ? HoudiniPointCacheAsset->GetAttributeAttributeIndex( Attribute ) : INDEX_NONE;
+
 	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
 	{
 		int32 PointID = PointIDParam.Get();
 		float Time = TimeParam.Get();
 
 		FVector VectorValue = FVector::ZeroVector;
-		if ( HoudiniPointCacheAsset )
-		{
-			int32 AttrIndex = HoudiniPointCacheAsset->GetAttributeAttributeIndex(Attribute);
-			HoudiniPointCacheAsset->GetPointVectorValueAtTime(PointID, AttrIndex, Time, VectorValue, DoSwap, DoScale);
-		}
+		SampleIndexesAtTime.GetVectorValue( PointID, AttrIndex, Time, VectorValue, DoSwap, DoScale );
 
 		*OutVecX.GetDest() = VectorValue.X;
 		*OutVecY.GetDest() = VectorValue.Y;
@@ -2410,33 +4168,106 @@ void UNiagaraDataInterfaceHoudini::GetPointGenericVectorAttributeAtTime(EHoudini
 
 void UNiagaraDataInterfaceHoudini::GetPointGenericFloatAttributeAtTime(EHoudiniAttributes Attribute, FVectorVMExternalFunctionContext& Context)
 {
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
 	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
 	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
 
 	VectorVM::FExternalFuncRegisterHandler<float> OutValue(Context);
 
+	const FHoudiniPointSampleIndexesAtTime SampleIndexesAtTime( HoudiniPointCacheAsset, TimeParam, InstData.Get() );
+	const int32 AttrIndex = HoudiniPointCacheAsset ? HoudiniPointCacheAsset->GetAttributeAttributeIndex( Attribute ) : INDEX_NONE;
+
 	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
 	{
 		int32 PointID = PointIDParam.Get();
 		float Time = TimeParam.Get();
 
 		float Value = 0.0f;
-		if ( HoudiniPointCacheAsset )
-		{
-			int32 AttrIndex = HoudiniPointCacheAsset->GetAttributeAttributeIndex(Attribute);
-			HoudiniPointCacheAsset->GetPointFloatValueAtTime(PointID, AttrIndex, Time, Value);
-		}
+		SampleIndexesAtTime.GetFloatValue( PointID, AttrIndex, Time, Value );
+
+		*OutValue.GetDest() = Value;
+
+		PointIDParam.Advance();
+		TimeParam.Advance();
+		OutValue.Advance();
+	}
+}
+
+void UNiagaraDataInterfaceHoudini::GetPointGenericVectorAttributeAtTimeWithCursor(EHoudiniAttributes Attribute, FVectorVMExternalFunctionContext& Context, bool DoSwap, bool DoScale)
+{
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
+	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
+	VectorVM::FExternalFuncInputHandler<int32> SampleCursorParam(Context);
+
+	VectorVM::FExternalFuncRegisterHandler<float> OutVecX(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutVecY(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutVecZ(Context);
+	VectorVM::FExternalFuncRegisterHandler<int32> OutSampleCursor(Context);
+
+	const FHoudiniPointSampleIndexesAtTime SampleIndexesAtTime( HoudiniPointCacheAsset, TimeParam, InstData.Get() );
+	const int32 AttrIndex = HoudiniPointCacheAsset ? HoudiniPointCacheAsset->GetAttributeAttributeIndex( Attribute ) : INDEX_NONE;
+
+	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
+	{
+		int32 PointID = PointIDParam.Get();
+		float Time = TimeParam.Get();
+		int32 SampleCursor = SampleCursorParam.Get();
+
+		FVector VectorValue = FVector::ZeroVector;
+		SampleIndexesAtTime.GetVectorValue( PointID, AttrIndex, Time, VectorValue, DoSwap, DoScale, &SampleCursor );
+
+		*OutVecX.GetDest() = VectorValue.X;
+		*OutVecY.GetDest() = VectorValue.Y;
+		*OutVecZ.GetDest() = VectorValue.Z;
+		*OutSampleCursor.GetDest() = SampleCursor;
+
+		PointIDParam.Advance();
+		TimeParam.Advance();
+		SampleCursorParam.Advance();
+		OutVecX.Advance();
+		OutVecY.Advance();
+		OutVecZ.Advance();
+		OutSampleCursor.Advance();
+	}
+}
+
+void UNiagaraDataInterfaceHoudini::GetPointGenericFloatAttributeAtTimeWithCursor(EHoudiniAttributes Attribute, FVectorVMExternalFunctionContext& Context)
+{
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
+	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
+	VectorVM::FExternalFuncInputHandler<int32> SampleCursorParam(Context);
+
+	VectorVM::FExternalFuncRegisterHandler<float> OutValue(Context);
+	VectorVM::FExternalFuncRegisterHandler<int32> OutSampleCursor(Context);
+
+	const FHoudiniPointSampleIndexesAtTime SampleIndexesAtTime( HoudiniPointCacheAsset, TimeParam, InstData.Get() );
+	const int32 AttrIndex = HoudiniPointCacheAsset ? HoudiniPointCacheAsset->GetAttributeAttributeIndex( Attribute ) : INDEX_NONE;
+
+	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
+	{
+		int32 PointID = PointIDParam.Get();
+		float Time = TimeParam.Get();
+		int32 SampleCursor = SampleCursorParam.Get();
+
+		float Value = 0.0f;
+		SampleIndexesAtTime.GetFloatValue( PointID, AttrIndex, Time, Value, &SampleCursor );
 
 		*OutValue.GetDest() = Value;
+		*OutSampleCursor.GetDest() = SampleCursor;
 
 		PointIDParam.Advance();
 		TimeParam.Advance();
+		SampleCursorParam.Advance();
 		OutValue.Advance();
+		OutSampleCursor.Advance();
 	}
 }
 
 void UNiagaraDataInterfaceHoudini::GetPointGenericInt32AttributeAtTime(EHoudiniAttributes Attribute, FVectorVMExternalFunctionContext& Context)
 {
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
 	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
 	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
 
@@ -2482,6 +4313,130 @@ void UNiagaraDataInterfaceHoudini::GetPointVelocityAtTime(FVectorVMExternalFunct
 	GetPointGenericVectorAttributeAtTime(EHoudiniAttributes::VELOCITY, Context, true, true);
 }
 
+void UNiagaraDataInterfaceHoudini::GetPointNormalAtTimeWithCursor(FVectorVMExternalFunctionContext& Context)
+{
+	GetPointGenericVectorAttributeAtTimeWithCursor(EHoudiniAttributes::NORMAL, Context, true, false);
+}
+
+void UNiagaraDataInterfaceHoudini::GetPointColorAtTimeWithCursor(FVectorVMExternalFunctionContext& Context)
+{
+	GetPointGenericVectorAttributeAtTimeWithCursor(EHoudiniAttributes::COLOR, Context, false, false);
+}
+
+void UNiagaraDataInterfaceHoudini::GetPointAlphaAtTimeWithCursor(FVectorVMExternalFunctionContext& Context)
+{
+	GetPointGenericFloatAttributeAtTimeWithCursor(EHoudiniAttributes::ALPHA, Context);
+}
+
+void UNiagaraDataInterfaceHoudini::GetPointVelocityAtTimeWithCursor(FVectorVMExternalFunctionContext& Context)
+{
+	GetPointGenericVectorAttributeAtTimeWithCursor(EHoudiniAttributes::VELOCITY, Context, true, true);
+}
+
+void UNiagaraDataInterfaceHoudini::GetPointAttributesAtTime(FVectorVMExternalFunctionContext& Context, int32 AttributeMask)
+{
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
+	VectorVM::FExternalFuncInputHandler<int32> PointIDParam(Context);
+	VectorVM::FExternalFuncInputHandler<float> TimeParam(Context);
+
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosX(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosY(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutPosZ(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutVelX(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutVelY(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutVelZ(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutNormalX(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutNormalY(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutNormalZ(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutColorR(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutColorG(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutColorB(Context);
+	VectorVM::FExternalFuncRegisterHandler<float> OutAlpha(Context);
+
+	const FHoudiniPointSampleIndexesAtTime SampleIndexesAtTime( HoudiniPointCacheAsset, TimeParam, InstData.Get() );
+
+	// Resolve the attribute indexes once for the whole batch, attributes that are not requested or missing are skipped
+	auto GetRequestedAttributeIndex = [&]( const int32& Flag, const EHoudiniAttributes& Attribute )
+	{
+		if ( !HoudiniPointCacheAsset || !( AttributeMask & Flag ) )
+			return (int32)INDEX_NONE;
+		return HoudiniPointCacheAsset->GetAttributeAttributeIndex( Attribute );
+	};
+	const int32 PositionAttrIndex = GetRequestedAttributeIndex( HOUDINI_POINT_ATTR_POSITION, EHoudiniAttributes::POSITION );
+	const int32 VelocityAttrIndex = GetRequestedAttributeIndex( HOUDINI_POINT_ATTR_VELOCITY, EHoudiniAttributes::VELOCITY );
+	const int32 NormalAttrIndex = GetRequestedAttributeIndex( HOUDINI_POINT_ATTR_NORMAL, EHoudiniAttributes::NORMAL );
+	const int32 ColorAttrIndex = GetRequestedAttributeIndex( HOUDINI_POINT_ATTR_COLOR, EHoudiniAttributes::COLOR );
+	const int32 AlphaAttrIndex = GetRequestedAttributeIndex( HOUDINI_POINT_ATTR_ALPHA, EHoudiniAttributes::ALPHA );
+
+	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
+	{
+		int32 PointID = PointIDParam.Get();
+		float Time = TimeParam.Get();
+
+		FVector Position = FVector::ZeroVector;
+		FVector Velocity = FVector::ZeroVector;
+		FVector Normal = FVector::ZeroVector;
+		FVector Color = FVector::ZeroVector;
+		float Alpha = 0.0f;
+
+		// Search the point's samples once, and interpolate every requested attribute with the same weight
+		int32 PrevSampleIndex = -1;
+		int32 NextSampleIndex = -1;
+		float PrevWeight = 1.0f;
+		if ( SampleIndexesAtTime.Get( PointID, Time, PrevSampleIndex, NextSampleIndex, PrevWeight ) )
+		{
+			auto LerpVector = [&]( const int32& AttrIndex, FVector& OutVector, const bool& DoSwap, const bool& DoScale )
+			{
+				if ( AttrIndex >= 0 )
+					HoudiniPointCacheAsset->InterpolateVectorValue( PrevSampleIndex, NextSampleIndex, PrevWeight, AttrIndex, OutVector, DoSwap, DoScale );
+			};
+
+			LerpVector( PositionAttrIndex, Position, true, true );
+			LerpVector( VelocityAttrIndex, Velocity, true, true );
+			LerpVector( NormalAttrIndex, Normal, true, false );
+			LerpVector( ColorAttrIndex, Color, false, false );
+
+			float PrevValue, NextValue;
+			if ( AlphaAttrIndex >= 0
+				&& HoudiniPointCacheAsset->GetFloatValue( PrevSampleIndex, AlphaAttrIndex, PrevValue )
+				&& HoudiniPointCacheAsset->GetFloatValue( NextSampleIndex, AlphaAttrIndex, NextValue ) )
+			{
+				Alpha = FMath::Lerp( PrevValue, NextValue, PrevWeight );
+			}
+		}
+
+		*OutPosX.GetDest() = Position.X;
+		*OutPosY.GetDest() = Position.Y;
+		*OutPosZ.GetDest() = Position.Z;
+		*OutVelX.GetDest() = Velocity.X;
+		*OutVelY.GetDest() = Velocity.Y;
+		*OutVelZ.GetDest() = Velocity.Z;
+		*OutNormalX.GetDest() = Normal.X;
+		*OutNormalY.GetDest() = Normal.Y;
+		*OutNormalZ.GetDest() = Normal.Z;
+		*OutColorR.GetDest() = Color.X;
+		*OutColorG.GetDest() = Color.Y;
+		*OutColorB.GetDest() = Color.Z;
+		*OutAlpha.GetDest() = Alpha;
+
+		PointIDParam.Advance();
+		TimeParam.Advance();
+		OutPosX.Advance();
+		OutPosY.Advance();
+		OutPosZ.Advance();
+		OutVelX.Advance();
+		OutVelY.Advance();
+		OutVelZ.Advance();
+		OutNormalX.Advance();
+		OutNormalY.Advance();
+		OutNormalZ.Advance();
+		OutColorR.Advance();
+		OutColorG.Advance();
+		OutColorB.Advance();
+		OutAlpha.Advance();
+	}
+}
+
 void UNiagaraDataInterfaceHoudini::GetPointImpulseAtTime(FVectorVMExternalFunctionContext& Context)
 {
 	GetPointGenericFloatAttributeAtTime(EHoudiniAttributes::IMPULSE, Context);
@@ -2495,6 +4450,7 @@ void UNiagaraDataInterfaceHoudini::GetPointTypeAtTime(FVectorVMExternalFunctionC
 
 void UNiagaraDataInterfaceHoudini::GetNumberOfSamples(FVectorVMExternalFunctionContext& Context)
 {
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
 	VectorVM::FExternalFuncRegisterHandler<int32> OutNumSamples(Context);
 	*OutNumSamples.GetDest() = HoudiniPointCacheAsset ? HoudiniPointCacheAsset->GetNumberOfSamples() : 0;
 	OutNumSamples.Advance();
@@ -2502,6 +4458,7 @@ void UNiagaraDataInterfaceHoudini::GetNumberOfSamples(FVectorVMExternalFunctionC
 
 void UNiagaraDataInterfaceHoudini::GetNumberOfAttributes(FVectorVMExternalFunctionContext& Context)
 {
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
 	VectorVM::FExternalFuncRegisterHandler<int32> OutNumAttributes(Context);
 	*OutNumAttributes.GetDest() = HoudiniPointCacheAsset ? HoudiniPointCacheAsset->GetNumberOfAttributes() : 0;
 	OutNumAttributes.Advance();
@@ -2509,6 +4466,7 @@ void UNiagaraDataInterfaceHoudini::GetNumberOfAttributes(FVectorVMExternalFuncti
 
 void UNiagaraDataInterfaceHoudini::GetNumberOfPoints(FVectorVMExternalFunctionContext& Context)
 {
+	VectorVM::FUserPtrHandler<FHoudiniNiagaraInstanceData> InstData(Context);
 	VectorVM::FExternalFuncRegisterHandler<int32> OutNumPoints(Context);
 	*OutNumPoints.GetDest() = HoudiniPointCacheAsset ? HoudiniPointCacheAsset->GetNumberOfPoints() : 0;
 	OutNumPoints.Advance();
@@ -2653,15 +4611,105 @@ void UNiagaraDataInterfaceHoudini::SetShaderParameters(const FNiagaraDataInterfa
 		ShaderParameters->NumberOfAttributes = Resource->NumAttributes;
 		ShaderParameters->NumberOfPoints = Resource->NumPoints;
 		ShaderParameters->MaxNumberOfIndexesPerPoint = Resource->MaxNumberOfIndexesPerPoint;
-		ShaderParameters->LastSpawnedPointId = -1;
-		ShaderParameters->LastSpawnTime = -FLT_MAX;
-		ShaderParameters->LastSpawnTimeRequest = -FLT_MAX;
 		ShaderParameters->FloatValuesBuffer = Resource->FloatValuesGPUBuffer.SRV;
 		ShaderParameters->SpecialAttributeIndexesBuffer = Resource->SpecialAttributeIndexesGPUBuffer.SRV;
 		ShaderParameters->SpawnTimesBuffer = Resource->SpawnTimesGPUBuffer.SRV;
-		ShaderParameters->LifeValuesBuffer = Resource->LifeValuesGPUBuffer.SRV;
-		ShaderParameters->PointTypesBuffer = Resource->PointTypesGPUBuffer.SRV;
-		ShaderParameters->PointValueIndexesBuffer = Resource->PointValueIndexesGPUBuffer.SRV;
+		ShaderParameters->PointRecordsBuffer = Resource->PointRecordsGPUBuffer.SRV;
+		ShaderParameters->NumberOfPointsPerFrame = Resource->NumPointsPerFrame;
+		ShaderParameters->SampleTimeStep = Resource->SampleTimeStep;
+		ShaderParameters->PositionInterpolation = Resource->PositionInterpolation;
+		ShaderParameters->SpawnTimesSorted = Resource->SpawnTimesSorted;
+
+		// Attributes that are constant for each point are stored in their own buffer
+		if (Resource->NumPointAttributes > 0)
+		{
+			ShaderParameters->NumberOfPointAttributes = Resource->NumPointAttributes;
+			ShaderParameters->PointAttributeValuesBuffer = Resource->PointAttributeValuesGPUBuffer.SRV;
+		}
+		else
+		{
+			ShaderParameters->NumberOfPointAttributes = 0;
+			ShaderParameters->PointAttributeValuesBuffer = FNiagaraRenderer::GetDummyFloatBuffer();
+		}
+
+		// Quantized attributes are stored in their own buffer
+		if (Resource->NumQuantizedColumns > 0)
+		{
+			ShaderParameters->NumberOfQuantizedColumns = Resource->NumQuantizedColumns;
+			ShaderParameters->QuantizedValuesBuffer = Resource->QuantizedValuesGPUBuffer.SRV;
+			ShaderParameters->QuantizationParamsBuffer = Resource->QuantizationParamsGPUBuffer.SRV;
+		}
+		else
+		{
+			ShaderParameters->NumberOfQuantizedColumns = 0;
+			ShaderParameters->QuantizedValuesBuffer = FNiagaraRenderer::GetDummyUIntBuffer();
+			ShaderParameters->QuantizationParamsBuffer = FNiagaraRenderer::GetDummyFloatBuffer();
+		}
+
+		// Integer attributes are stored in their own buffer
+		if (Resource->NumIntColumns > 0)
+		{
+			ShaderParameters->NumberOfIntColumns = Resource->NumIntColumns;
+			ShaderParameters->IntValuesBuffer = Resource->IntValuesGPUBuffer.SRV;
+			ShaderParameters->AttributeIntColumnIndexesBuffer = Resource->AttributeIntColumnIndexesGPUBuffer.SRV;
+		}
+		else
+		{
+			ShaderParameters->NumberOfIntColumns = 0;
+			ShaderParameters->IntValuesBuffer = FNiagaraRenderer::GetDummyIntBuffer();
+			ShaderParameters->AttributeIntColumnIndexesBuffer = FNiagaraRenderer::GetDummyIntBuffer();
+		}
+
+		// Vector attributes are only interleaved when the point cache enables it
+		if (Resource->NumVectorColumns > 0)
+		{
+			ShaderParameters->NumberOfVectorColumns = Resource->NumVectorColumns;
+			ShaderParameters->VectorColumnIndexesBuffer = Resource->VectorColumnIndexesGPUBuffer.SRV;
+			ShaderParameters->VectorValuesBuffer = Resource->VectorValuesGPUBuffer.SRV;
+		}
+		else
+		{
+			ShaderParameters->NumberOfVectorColumns = 0;
+			ShaderParameters->VectorColumnIndexesBuffer = FNiagaraRenderer::GetDummyIntBuffer();
+			ShaderParameters->VectorValuesBuffer = FNiagaraRenderer::GetDummyFloat4Buffer();
+		}
+
+		if (Resource->NumPointAttributes > 0 || Resource->NumQuantizedColumns > 0 || Resource->NumIntColumns > 0)
+			ShaderParameters->AttributeColumnIndexesBuffer = Resource->AttributeColumnIndexesGPUBuffer.SRV;
+		else
+			ShaderParameters->AttributeColumnIndexesBuffer = FNiagaraRenderer::GetDummyIntBuffer();
+
+		// Point caches with a fixed topology don't have a point sample index table
+		if (Resource->PointSampleIndexesGPUBuffer.NumBytes > 0)
+		{
+			ShaderParameters->PointSampleIndexOffsetsBuffer = Resource->PointSampleIndexOffsetsGPUBuffer.SRV;
+			ShaderParameters->PointSampleIndexesBuffer = Resource->PointSampleIndexesGPUBuffer.SRV;
+		}
+		else
+		{
+			ShaderParameters->PointSampleIndexOffsetsBuffer = FNiagaraRenderer::GetDummyIntBuffer();
+			ShaderParameters->PointSampleIndexesBuffer = FNiagaraRenderer::GetDummyIntBuffer();
+		}
+
+		// The frame table is optional, use dummy buffers when the point cache doesn't have one
+		if (Resource->NumFrames > 0)
+		{
+			ShaderParameters->NumberOfFrames = Resource->NumFrames;
+			ShaderParameters->FrameTimesBuffer = Resource->FrameTimesGPUBuffer.SRV;
+			ShaderParameters->FrameSampleIndexOffsetsBuffer = Resource->FrameSampleIndexOffsetsGPUBuffer.SRV;
+		}
+		else
+		{
+			ShaderParameters->NumberOfFrames = 0;
+			ShaderParameters->FrameTimesBuffer = FNiagaraRenderer::GetDummyFloatBuffer();
+			ShaderParameters->FrameSampleIndexOffsetsBuffer = FNiagaraRenderer::GetDummyIntBuffer();
+		}
+
+		// The alive interval index is only built for point caches with spawn times
+		if (Resource->AliveIntervalIndexGPUBuffer.NumBytes > 0)
+			ShaderParameters->AliveIntervalIndexBuffer = Resource->AliveIntervalIndexGPUBuffer.SRV;
+		else
+			ShaderParameters->AliveIntervalIndexBuffer = FNiagaraRenderer::GetDummyFloatBuffer();
 
 		// Build the the function index to attribute index lookup table if it has not yet been built for this DI proxy
 		const FNiagaraDataInterfaceParametersCS_Houdini& ShaderStorage = Context.GetShaderStorage<FNiagaraDataInterfaceParametersCS_Houdini>();
@@ -2681,17 +4729,62 @@ void UNiagaraDataInterfaceHoudini::SetShaderParameters(const FNiagaraDataInterfa
 		ShaderParameters->NumberOfAttributes = 0;
 		ShaderParameters->NumberOfPoints = 0;
 		ShaderParameters->MaxNumberOfIndexesPerPoint = 0;
-		ShaderParameters->LastSpawnedPointId = -1;
-		ShaderParameters->LastSpawnTime = -FLT_MAX;
-		ShaderParameters->LastSpawnTimeRequest = -FLT_MAX;
 		ShaderParameters->FloatValuesBuffer = FNiagaraRenderer::GetDummyFloatBuffer();
 		ShaderParameters->SpecialAttributeIndexesBuffer = FNiagaraRenderer::GetDummyIntBuffer();
 		ShaderParameters->SpawnTimesBuffer = FNiagaraRenderer::GetDummyFloatBuffer();
-		ShaderParameters->LifeValuesBuffer = FNiagaraRenderer::GetDummyFloatBuffer();
-		ShaderParameters->PointTypesBuffer = FNiagaraRenderer::GetDummyIntBuffer();
-		ShaderParameters->PointValueIndexesBuffer = FNiagaraRenderer::GetDummyIntBuffer();
+		ShaderParameters->PointRecordsBuffer = FNiagaraRenderer::GetDummyFloat4Buffer();
+		ShaderParameters->PointSampleIndexOffsetsBuffer = FNiagaraRenderer::GetDummyIntBuffer();
+		ShaderParameters->PointSampleIndexesBuffer = FNiagaraRenderer::GetDummyIntBuffer();
+		ShaderParameters->NumberOfFrames = 0;
+		ShaderParameters->NumberOfPointsPerFrame = 0;
+		ShaderParameters->SampleTimeStep = 0.0f;
+		ShaderParameters->PositionInterpolation = 0;
+		ShaderParameters->SpawnTimesSorted = 0;
+		ShaderParameters->NumberOfPointAttributes = 0;
+		ShaderParameters->PointAttributeValuesBuffer = FNiagaraRenderer::GetDummyFloatBuffer();
+		ShaderParameters->AttributeColumnIndexesBuffer = FNiagaraRenderer::GetDummyIntBuffer();
+		ShaderParameters->NumberOfQuantizedColumns = 0;
+		ShaderParameters->QuantizedValuesBuffer = FNiagaraRenderer::GetDummyUIntBuffer();
+		ShaderParameters->QuantizationParamsBuffer = FNiagaraRenderer::GetDummyFloatBuffer();
+		ShaderParameters->NumberOfIntColumns = 0;
+		ShaderParameters->IntValuesBuffer = FNiagaraRenderer::GetDummyIntBuffer();
+		ShaderParameters->AttributeIntColumnIndexesBuffer = FNiagaraRenderer::GetDummyIntBuffer();
+		ShaderParameters->AliveIntervalIndexBuffer = FNiagaraRenderer::GetDummyFloatBuffer();
+		ShaderParameters->NumberOfVectorColumns = 0;
+		ShaderParameters->VectorColumnIndexesBuffer = FNiagaraRenderer::GetDummyIntBuffer();
+		ShaderParameters->VectorValuesBuffer = FNiagaraRenderer::GetDummyFloat4Buffer();
+		ShaderParameters->FrameTimesBuffer = FNiagaraRenderer::GetDummyFloatBuffer();
+		ShaderParameters->FrameSampleIndexOffsetsBuffer = FNiagaraRenderer::GetDummyIntBuffer();
 		ShaderParameters->FunctionIndexToAttributeIndexBuffer = FNiagaraRenderer::GetDummyIntBuffer();
 	}
+
+	// Spawn state and values precomputed for the system instance during its tick
+	if (const FHoudiniNiagaraInstanceData* InstData = DIProxy.SystemInstancesToInstanceData.Find(Context.GetSystemInstanceID()))
+	{
+		ShaderParameters->LastSpawnedPointId = InstData->LastSpawnedPointID;
+		ShaderParameters->LastSpawnTime = InstData->LastSpawnTime;
+		ShaderParameters->LastSpawnTimeRequest = InstData->LastSpawnTimeRequest;
+		ShaderParameters->SpawnMinPointId = InstData->SpawnMinID;
+		ShaderParameters->SpawnMaxPointId = InstData->SpawnMaxID;
+		ShaderParameters->SpawnCount = InstData->SpawnCount;
+		ShaderParameters->InstanceTime = InstData->Time;
+		ShaderParameters->InstancePrevFrameIndex = InstData->bHasFrameIndexes ? InstData->PrevFrameIndex : -1;
+		ShaderParameters->InstanceNextFrameIndex = InstData->bHasFrameIndexes ? InstData->NextFrameIndex : -1;
+		ShaderParameters->InstanceFramePrevWeight = InstData->FramePrevWeight;
+	}
+	else
+	{
+		ShaderParameters->LastSpawnedPointId = -1;
+		ShaderParameters->LastSpawnTime = -FLT_MAX;
+		ShaderParameters->LastSpawnTimeRequest = -FLT_MAX;
+		ShaderParameters->SpawnMinPointId = -1;
+		ShaderParameters->SpawnMaxPointId = -1;
+		ShaderParameters->SpawnCount = 0;
+		ShaderParameters->InstanceTime = -FLT_MAX;
+		ShaderParameters->InstancePrevFrameIndex = -1;
+		ShaderParameters->InstanceNextFrameIndex = -1;
+		ShaderParameters->InstanceFramePrevWeight = 1.0f;
+	}
 }
 
 FNiagaraDataInterfaceParametersCS* UNiagaraDataInterfaceHoudini::CreateShaderStorage(const FNiagaraDataInterfaceGPUParamInfo& ParameterInfo, const FShaderParameterMap& ParameterMap) const
@@ -2724,8 +4817,126 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 
 #endif  //else ENGINE_MINOR_VERSION < 1
 
+#if !UE_BUILD_SHIPPING
+// The spawn range search emitted for GetPointIDsToSpawnAtTime in GetFunctionHLSL, compiled from the same source
+static void
+GetPointIDsToSpawnAtTimeGPU(
+	const float* spawn_times_buffer, int num_points, int spawn_times_sorted, bool has_time_attr,
+	float In_Time, float In_LastSpawnTime, float In_LastSpawnTimeRequest, int In_LastSpawnedPointID,
+	int& Out_MinID, int& Out_MaxID, int& Out_Count, float& Out_LastSpawnTime, float& Out_LastSpawnTimeRequest, int& Out_LastSpawnPointID)
+{
+	HOUDINI_SPAWN_RANGE_SOURCE( HOUDINI_SHARED_SOURCE_CODE )
+}
+
+// Simulates an emitter ticking over the spawn time range of a point cache, from before its first spawn time to past its last one, looping once.
+// Returns the number of ticks for which the CPU and GPU versions of GetPointIDsToSpawnAtTime return different spawn ranges.
+static int32
+CheckSpawnRangeParity(const UHoudiniPointCache* PointCache, const bool& bHasTimeAttribute, const int32& SpawnTimesSorted, const int32& NumTicks)
+{
+	const TArray<float>& Times = PointCache->GetSpawnTimes();
+	const int32 NumPoints = PointCache->NumberOfPoints;
+
+	float MinTime = 0.0f;
+	float MaxTime = 0.0f;
+	if ( Times.Num() > 0 )
+	{
+		MinTime = FMath::Min( Times );
+		MaxTime = FMath::Max( Times );
+	}
+	const float TimeStep = FMath::Max( ( MaxTime - MinTime ) / NumTicks, KINDA_SMALL_NUMBER );
+
+	float CPULastSpawnTime = -FLT_MAX, CPULastSpawnTimeRequest = -FLT_MAX;
+	float GPULastSpawnTime = -FLT_MAX, GPULastSpawnTimeRequest = -FLT_MAX;
+	int32 CPULastSpawnedPointID = -1, GPULastSpawnedPointID = -1;
+	int32 NumMismatches = 0;
+	for ( int32 n = 0; n < ( NumTicks + 3 ) * 2; n++ )
+	{
+		const float Time = MinTime + ( ( n % ( NumTicks + 3 ) ) - 1 ) * TimeStep;
+
+		int32 CPUMin = 0, CPUMax = 0, CPUCount = 0;
+		PointCache->GetPointIDsToSpawnAtTime( Time, CPUMin, CPUMax, CPUCount, CPULastSpawnedPointID, CPULastSpawnTime, CPULastSpawnTimeRequest );
+
+		int32 GPUMin = 0, GPUMax = 0, GPUCount = 0;
+		GetPointIDsToSpawnAtTimeGPU(
+			Times.GetData(), NumPoints, SpawnTimesSorted, bHasTimeAttribute,
+			Time, GPULastSpawnTime, GPULastSpawnTimeRequest, GPULastSpawnedPointID,
+			GPUMin, GPUMax, GPUCount, GPULastSpawnTime, GPULastSpawnTimeRequest, GPULastSpawnedPointID );
+
+		if ( CPUCount != GPUCount || ( CPUCount > 0 && ( CPUMin != GPUMin || CPUMax != GPUMax ) ) )
+		{
+			if ( NumMismatches++ == 0 )
+			{
+				UE_LOG( LogHoudiniNiagara, Warning, TEXT("%s: spawn ranges differ at time %f, CPU: [%d, %d] (%d), GPU: [%d, %d] (%d)"),
+					*PointCache->GetName(), Time, CPUMin, CPUMax, CPUCount, GPUMin, GPUMax, GPUCount );
+			}
+		}
+	}
+
+	return NumMismatches;
+}
+
+// Checks that the CPU and GPU versions of GetPointIDsToSpawnAtTime return the same spawn ranges,
+// on point caches with sorted and unsorted spawn times and on all the loaded point caches
+static FAutoConsoleCommand CCmdHoudiniNiagaraCheckSpawnRangeParity(
+	TEXT("HoudiniNiagara.CheckSpawnRangeParity"),
+	TEXT("Checks that the CPU and GPU versions of GetPointIDsToSpawnAtTime return the same spawn ranges on sorted and unsorted spawn times and on all loaded point caches.\n")
+	TEXT("Usage: HoudiniNiagara.CheckSpawnRangeParity [NumTicks]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 NumTicks = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 1000;
+
+		// Runs both branches of the GPU search when the spawn times are sorted, the linear one must return the same ranges
+		auto CheckPointCache = [NumTicks](const UHoudiniPointCache* PointCache, const bool& bHasTimeAttribute)
+		{
+			if ( bHasTimeAttribute && !PointCache->GetSpawnTimes().IsValidIndex( PointCache->NumberOfPoints - 1 ) )
+				return;
+
+			const bool bSorted = PointCache->AreSpawnTimesSorted();
+			int32 NumMismatches = CheckSpawnRangeParity( PointCache, bHasTimeAttribute, 0, NumTicks );
+			if ( bSorted )
+				NumMismatches += CheckSpawnRangeParity( PointCache, bHasTimeAttribute, 1, NumTicks );
+
+			UE_LOG(LogHoudiniNiagara, Display, TEXT("%s: %d points, sorted: %s, results %s (%d mismatches)"),
+				*PointCache->GetName(), PointCache->NumberOfPoints, bSorted ? TEXT("yes") : TEXT("no"),
+				NumMismatches == 0 ? TEXT("match") : TEXT("differ"), NumMismatches);
+		};
+
+		// Sorted spawn times with points sharing a spawn time, and unsorted spawn times
+		const TArray<TArray<float>> TestSpawnTimes = {
+			{ 0.0f, 0.0f, 0.25f, 0.5f, 0.5f, 0.5f, 1.0f, 1.5f, 2.0f, 2.0f },
+			{ 0.5f, 0.0f, 1.0f, 0.25f, 2.0f, 0.5f, 1.5f, 0.0f, 2.0f, 1.0f }
+		};
+		for ( const TArray<float>& SpawnTimes : TestSpawnTimes )
+		{
+			UHoudiniPointCache* TestPointCache = NewObject<UHoudiniPointCache>( GetTransientPackage(), NAME_None, RF_Transient );
+			TestPointCache->NumberOfPoints = SpawnTimes.Num();
+			TestPointCache->GetSpawnTimes() = SpawnTimes;
+			TestPointCache->UpdateSpawnTimesSorted();
+			CheckPointCache( TestPointCache, true );
+		}
+
+		for (TObjectIterator<UHoudiniPointCache> It; It; ++It)
+		{
+			const UHoudiniPointCache* PointCache = *It;
+			if ( PointCache->HasAnyFlags( RF_ClassDefaultObject | RF_Transient ) || PointCache->NumberOfPoints <= 0 )
+				continue;
+
+			CheckPointCache( PointCache, PointCache->GetAttributeAttributeIndex( EHoudiniAttributes::TIME ) >= 0 );
+		}
+	})
+);
+#endif
 
 #if WITH_EDITORONLY_DATA
+bool UNiagaraDataInterfaceHoudini::GetSpecializedShaderLayout(FHoudiniPointCacheShaderLayout& OutLayout) const
+{
+	if ( !bSpecializeShaders || !HoudiniPointCacheAsset )
+		return false;
+
+	HoudiniPointCacheAsset->GetShaderLayout( OutLayout );
+	return true;
+}
+
 	bool UNiagaraDataInterfaceHoudini::GetFunctionHLSL(const FNiagaraDataInterfaceGPUParamInfo & ParamInfo, const FNiagaraDataInterfaceGeneratedFunction & FunctionInfo, int FunctionInstanceIndex, FString & OutHLSL)
 	{
 #if ENGINE_MAJOR_VERSION==5 && ENGINE_MINOR_VERSION < 1
@@ -2736,11 +4947,38 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 		FString FloatBufferVar = FloatValuesBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
 		FString AttributeIndexesBuffer = SpecialAttributeIndexesBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
 		FString SpawnTimeBuffer = SpawnTimesBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
-		FString LifeValuesBuffer = LifeValuesBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
-		FString PointTypesBuffer = PointTypesBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString PointRecordsBuffer = PointRecordsBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
 		FString MaxNumberOfIndexesPerPointVar = MaxNumberOfIndexesPerPointBaseName + ParamInfo.DataInterfaceHLSLSymbol;
-		FString PointValueIndexesBuffer = PointValueIndexesBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString PointSampleIndexOffsetsBuffer = PointSampleIndexOffsetsBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString PointSampleIndexesBuffer = PointSampleIndexesBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString NumberOfFramesVar = NumberOfFramesBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString NumberOfPointsPerFrameVar = NumberOfPointsPerFrameBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString SampleTimeStepVar = SampleTimeStepBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString PositionInterpolationVar = PositionInterpolationBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString SpawnTimesSortedVar = SpawnTimesSortedBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString NumberOfPointAttributesVar = NumberOfPointAttributesBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString PointAttributeValuesBuffer = PointAttributeValuesBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString AttributeColumnIndexesBuffer = AttributeColumnIndexesBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString NumberOfQuantizedColumnsVar = NumberOfQuantizedColumnsBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString QuantizedValuesBuffer = QuantizedValuesBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString QuantizationParamsBuffer = QuantizationParamsBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString NumberOfIntColumnsVar = NumberOfIntColumnsBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString IntValuesBuffer = IntValuesBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString AttributeIntColumnIndexesBuffer = AttributeIntColumnIndexesBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString AliveIntervalIndexBuffer = AliveIntervalIndexBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString NumberOfVectorColumnsVar = NumberOfVectorColumnsBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString VectorColumnIndexesBuffer = VectorColumnIndexesBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString VectorValuesBuffer = VectorValuesBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString FrameTimesBuffer = FrameTimesBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString FrameSampleIndexOffsetsBuffer = FrameSampleIndexOffsetsBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
 		FString FunctionIndexToAttributeIndexBuffer = FunctionIndexToAttributeIndexBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString SpawnMinPointIdVar = SpawnMinPointIdBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString SpawnMaxPointIdVar = SpawnMaxPointIdBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString SpawnCountVar = SpawnCountBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString InstanceTimeVar = InstanceTimeBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString InstancePrevFrameIndexVar = InstancePrevFrameIndexBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString InstanceNextFrameIndexVar = InstanceNextFrameIndexBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString InstanceFramePrevWeightVar = InstanceFramePrevWeightBaseName + ParamInfo.DataInterfaceHLSLSymbol;
 #else
 		FString NumberOfSamplesVar = ParamInfo.DataInterfaceHLSLSymbol + NumberOfSamplesBaseName;
 		FString NumberOfAttributesVar = ParamInfo.DataInterfaceHLSLSymbol + NumberOfAttributesBaseName;
@@ -2748,24 +4986,131 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 		FString FloatBufferVar = ParamInfo.DataInterfaceHLSLSymbol + FloatValuesBufferBaseName;
 		FString AttributeIndexesBuffer = ParamInfo.DataInterfaceHLSLSymbol + SpecialAttributeIndexesBufferBaseName;
 		FString SpawnTimeBuffer = ParamInfo.DataInterfaceHLSLSymbol + SpawnTimesBufferBaseName;
-		FString LifeValuesBuffer = ParamInfo.DataInterfaceHLSLSymbol + LifeValuesBufferBaseName;
-		FString PointTypesBuffer = ParamInfo.DataInterfaceHLSLSymbol + PointTypesBufferBaseName;
+		FString PointRecordsBuffer = ParamInfo.DataInterfaceHLSLSymbol + PointRecordsBufferBaseName;
 		FString MaxNumberOfIndexesPerPointVar = ParamInfo.DataInterfaceHLSLSymbol + MaxNumberOfIndexesPerPointBaseName;
-		FString PointValueIndexesBuffer = ParamInfo.DataInterfaceHLSLSymbol + PointValueIndexesBufferBaseName;
+		FString PointSampleIndexOffsetsBuffer = ParamInfo.DataInterfaceHLSLSymbol + PointSampleIndexOffsetsBufferBaseName;
+		FString PointSampleIndexesBuffer = ParamInfo.DataInterfaceHLSLSymbol + PointSampleIndexesBufferBaseName;
+		FString NumberOfFramesVar = ParamInfo.DataInterfaceHLSLSymbol + NumberOfFramesBaseName;
+		FString NumberOfPointsPerFrameVar = ParamInfo.DataInterfaceHLSLSymbol + NumberOfPointsPerFrameBaseName;
+		FString SampleTimeStepVar = ParamInfo.DataInterfaceHLSLSymbol + SampleTimeStepBaseName;
+		FString PositionInterpolationVar = ParamInfo.DataInterfaceHLSLSymbol + PositionInterpolationBaseName;
+		FString SpawnTimesSortedVar = ParamInfo.DataInterfaceHLSLSymbol + SpawnTimesSortedBaseName;
+		FString NumberOfPointAttributesVar = ParamInfo.DataInterfaceHLSLSymbol + NumberOfPointAttributesBaseName;
+		FString PointAttributeValuesBuffer = ParamInfo.DataInterfaceHLSLSymbol + PointAttributeValuesBufferBaseName;
+		FString AttributeColumnIndexesBuffer = ParamInfo.DataInterfaceHLSLSymbol + AttributeColumnIndexesBufferBaseName;
+		FString NumberOfQuantizedColumnsVar = ParamInfo.DataInterfaceHLSLSymbol + NumberOfQuantizedColumnsBaseName;
+		FString QuantizedValuesBuffer = ParamInfo.DataInterfaceHLSLSymbol + QuantizedValuesBufferBaseName;
+		FString QuantizationParamsBuffer = ParamInfo.DataInterfaceHLSLSymbol + QuantizationParamsBufferBaseName;
+		FString NumberOfIntColumnsVar = ParamInfo.DataInterfaceHLSLSymbol + NumberOfIntColumnsBaseName;
+		FString IntValuesBuffer = ParamInfo.DataInterfaceHLSLSymbol + IntValuesBufferBaseName;
+		FString AttributeIntColumnIndexesBuffer = ParamInfo.DataInterfaceHLSLSymbol + AttributeIntColumnIndexesBufferBaseName;
+		FString AliveIntervalIndexBuffer = ParamInfo.DataInterfaceHLSLSymbol + AliveIntervalIndexBufferBaseName;
+		FString NumberOfVectorColumnsVar = ParamInfo.DataInterfaceHLSLSymbol + NumberOfVectorColumnsBaseName;
+		FString VectorColumnIndexesBuffer = ParamInfo.DataInterfaceHLSLSymbol + VectorColumnIndexesBufferBaseName;
+		FString VectorValuesBuffer = ParamInfo.DataInterfaceHLSLSymbol + VectorValuesBufferBaseName;
+		FString FrameTimesBuffer = ParamInfo.DataInterfaceHLSLSymbol + FrameTimesBufferBaseName;
+		FString FrameSampleIndexOffsetsBuffer = ParamInfo.DataInterfaceHLSLSymbol + FrameSampleIndexOffsetsBufferBaseName;
 		FString FunctionIndexToAttributeIndexBuffer = ParamInfo.DataInterfaceHLSLSymbol + FunctionIndexToAttributeIndexBufferBaseName;
+		FString SpawnMinPointIdVar = ParamInfo.DataInterfaceHLSLSymbol + SpawnMinPointIdBaseName;
+		FString SpawnMaxPointIdVar = ParamInfo.DataInterfaceHLSLSymbol + SpawnMaxPointIdBaseName;
+		FString SpawnCountVar = ParamInfo.DataInterfaceHLSLSymbol + SpawnCountBaseName;
+		FString InstanceTimeVar = ParamInfo.DataInterfaceHLSLSymbol + InstanceTimeBaseName;
+		FString InstancePrevFrameIndexVar = ParamInfo.DataInterfaceHLSLSymbol + InstancePrevFrameIndexBaseName;
+		FString InstanceNextFrameIndexVar = ParamInfo.DataInterfaceHLSLSymbol + InstanceNextFrameIndexBaseName;
+		FString InstanceFramePrevWeightVar = ParamInfo.DataInterfaceHLSLSymbol + InstanceFramePrevWeightBaseName;
 #endif
 
+		// Replace the layout parameters by literals when specializing the shaders for the point cache,
+		// the compiler can then fold the buffer reads and branches depending on them
+		FHoudiniPointCacheShaderLayout SpecializedLayout;
+		const bool bSpecialized = GetSpecializedShaderLayout(SpecializedLayout);
+		if ( bSpecialized )
+		{
+			NumberOfAttributesVar = FString::FromInt( SpecializedLayout.NumAttributes );
+			NumberOfPointAttributesVar = FString::FromInt( SpecializedLayout.NumPointAttributes );
+			NumberOfQuantizedColumnsVar = FString::FromInt( SpecializedLayout.NumQuantizedColumns );
+			NumberOfIntColumnsVar = FString::FromInt( SpecializedLayout.NumIntColumns );
+			NumberOfVectorColumnsVar = FString::FromInt( SpecializedLayout.NumVectorColumns );
+		}
+
 
 // Build the shader function HLSL Code.
 
 	// Lambda returning the HLSL code used for reading a Float value in the FloatBuffer
+	// Attributes that are constant for each point are read in the PointAttributeValuesBuffer, via the sample's point id
+	// Quantized attributes are read in the QuantizedValuesBuffer and decoded with their QuantizationParams
+	// Integer attributes are read in the IntValuesBuffer
 	auto ReadFloatInBuffer = [&](const FString& OutFloatValue, const FString& FloatSampleIndex, const FString& FloatAttrIndex)
 	{
-		// \t OutValue = FloatBufferName[ (SampleIndex) + ( (AttrIndex) * (NumberOfSamplesName) ) ];\n
-		return TEXT("\t ") + OutFloatValue + TEXT(" = ") + FloatBufferVar + TEXT("[ (") + FloatSampleIndex + TEXT(") + ( (") + FloatAttrIndex + TEXT(") * (") + NumberOfSamplesVar + TEXT(") ) ];\n");
+		const FString QuantizationParam = QuantizationParamsBuffer + TEXT("[ houdini_quantization_params + ");
+		FString OutHLSLCode;
+		OutHLSLCode += TEXT("\t{\n");
+			OutHLSLCode += TEXT("\t\tint houdini_attr_column = (") + FloatAttrIndex + TEXT(");\n");
+			OutHLSLCode += TEXT("\t\tint houdini_quantization_params = houdini_attr_column * ") + FString::FromInt(UHoudiniPointCache::QuantizationParamsStride) + TEXT(";\n");
+			OutHLSLCode += TEXT("\t\tif ( ") + NumberOfIntColumnsVar + TEXT(" > 0 && ") + AttributeIntColumnIndexesBuffer + TEXT("[ houdini_attr_column ] >= 0 )\n");
+				OutHLSLCode += TEXT("\t\t\t{ ") + OutFloatValue + TEXT(" = (float)") + IntValuesBuffer + TEXT("[ (") + FloatSampleIndex + TEXT(") + ( ") + AttributeIntColumnIndexesBuffer + TEXT("[ houdini_attr_column ] * (") + NumberOfSamplesVar + TEXT(") ) ]; }\n");
+			OutHLSLCode += TEXT("\t\telse if ( ") + NumberOfQuantizedColumnsVar + TEXT(" > 0 && ") + QuantizationParam + TEXT("0 ] >= 0.0f )\n\t\t{\n");
+				OutHLSLCode += TEXT("\t\t\tuint houdini_quantized = ") + QuantizedValuesBuffer + TEXT("[ (") + FloatSampleIndex + TEXT(") + ( (int)") + QuantizationParam + TEXT("0 ] * (") + NumberOfSamplesVar + TEXT(") ) ];\n");
+				OutHLSLCode += TEXT("\t\t\tint houdini_quantization = (int)") + QuantizationParam + TEXT("1 ];\n");
+				OutHLSLCode += TEXT("\t\t\tif ( houdini_quantization == ") + FString::FromInt((int32)EHoudiniAttributeQuantization::Half) + TEXT(" )\n");
+					OutHLSLCode += TEXT("\t\t\t\t{ ") + OutFloatValue + TEXT(" = f16tof32( houdini_quantized ); }\n");
+				OutHLSLCode += TEXT("\t\t\telse if ( houdini_quantization == ") + FString::FromInt((int32)EHoudiniAttributeQuantization::SNorm16) + TEXT(" )\n");
+					OutHLSLCode += TEXT("\t\t\t\t{ ") + OutFloatValue + TEXT(" = ") + QuantizationParam + TEXT("2 ] + (float)( (int)( houdini_quantized << 16 ) >> 16 ) * ") + QuantizationParam + TEXT("3 ]; }\n");
+				OutHLSLCode += TEXT("\t\t\telse\n");
+					OutHLSLCode += TEXT("\t\t\t\t{ ") + OutFloatValue + TEXT(" = ") + QuantizationParam + TEXT("2 ] + (float)houdini_quantized * ") + QuantizationParam + TEXT("3 ]; }\n");
+			OutHLSLCode += TEXT("\t\t}\n");
+			OutHLSLCode += TEXT("\t\telse\n\t\t{\n");
+				OutHLSLCode += TEXT("\t\t\tif ( ") + NumberOfPointAttributesVar + TEXT(" > 0 || ") + NumberOfQuantizedColumnsVar + TEXT(" > 0 || ") + NumberOfIntColumnsVar + TEXT(" > 0 ) { houdini_attr_column = ") + AttributeColumnIndexesBuffer + TEXT("[ houdini_attr_column ]; }\n");
+				OutHLSLCode += TEXT("\t\t\tif ( houdini_attr_column >= 0 )\n");
+					// OutValue = FloatBufferName[ (SampleIndex) + ( houdini_attr_column * (NumberOfSamplesName) ) ];
+					OutHLSLCode += TEXT("\t\t\t\t{ ") + OutFloatValue + TEXT(" = ") + FloatBufferVar + TEXT("[ (") + FloatSampleIndex + TEXT(") + ( houdini_attr_column * (") + NumberOfSamplesVar + TEXT(") ) ]; }\n");
+				OutHLSLCode += TEXT("\t\t\telse\n\t\t\t{\n");
+					OutHLSLCode += TEXT("\t\t\t\tint houdini_point_id = (int)") + FloatBufferVar + TEXT("[ (") + FloatSampleIndex + TEXT(") + ( ") + AttributeColumnIndexesBuffer + TEXT("[ ") + AttributeIndexesBuffer + TEXT("[") + FString::FromInt(EHoudiniAttributes::POINTID) + TEXT("] ] * (") + NumberOfSamplesVar + TEXT(") ) ];\n");
+					OutHLSLCode += TEXT("\t\t\t\t") + OutFloatValue + TEXT(" = ") + PointAttributeValuesBuffer + TEXT("[ houdini_point_id * ") + NumberOfPointAttributesVar + TEXT(" - houdini_attr_column - 1 ];\n");
+				OutHLSLCode += TEXT("\t\t\t}\n");
+			OutHLSLCode += TEXT("\t\t}\n");
+		OutHLSLCode += TEXT("\t}\n");
+		return OutHLSLCode;
+	};
+
+	// Lambda returning the HLSL code used for reading an Integer value, without conversion for integer attributes
+	auto ReadIntInBuffer = [&](const FString& OutIntValue, const FString& IntSampleIndex, const FString& IntAttrIndex)
+	{
+		FString OutHLSLCode;
+		OutHLSLCode += TEXT("\t{\n");
+			OutHLSLCode += TEXT("\t\tint houdini_int_attr = (") + IntAttrIndex + TEXT(");\n");
+			OutHLSLCode += TEXT("\t\tif ( ") + NumberOfIntColumnsVar + TEXT(" > 0 && ") + AttributeIntColumnIndexesBuffer + TEXT("[ houdini_int_attr ] >= 0 )\n");
+				OutHLSLCode += TEXT("\t\t\t{ ") + OutIntValue + TEXT(" = ") + IntValuesBuffer + TEXT("[ (") + IntSampleIndex + TEXT(") + ( ") + AttributeIntColumnIndexesBuffer + TEXT("[ houdini_int_attr ] * (") + NumberOfSamplesVar + TEXT(") ) ]; }\n");
+			OutHLSLCode += TEXT("\t\telse\n\t\t{\n");
+				OutHLSLCode += TEXT("\t\t\tfloat houdini_float_value = 0.0f;\n");
+				OutHLSLCode += ReadFloatInBuffer(TEXT("houdini_float_value"), IntSampleIndex, TEXT("houdini_int_attr"));
+				OutHLSLCode += TEXT("\t\t\t") + OutIntValue + TEXT(" = (int)floor(houdini_float_value);\n");
+			OutHLSLCode += TEXT("\t\t}\n");
+		OutHLSLCode += TEXT("\t}\n");
+		return OutHLSLCode;
+	};
+
+	// Lambda returning the HLSL code reading the interleaved record of a vector attribute in the VectorValuesBuffer, in houdini_vector_record.
+	// houdini_vector_column is left negative if the vector is not interleaved, or if it doesn't have the required number of components.
+	auto ReadVectorRecordInBuffer = [&](const FString& VectorSampleIndex, const FString& VectorAttributeIndex, const bool& bNeedsW)
+	{
+		FString OutHLSLCode;
+		OutHLSLCode += TEXT("\t\tint houdini_vector_column = -1;\n");
+		OutHLSLCode += TEXT("\t\tfloat4 houdini_vector_record = float4(0.0, 0.0, 0.0, 0.0);\n");
+		OutHLSLCode += TEXT("\t\tif ( ") + NumberOfVectorColumnsVar + TEXT(" > 0 && (") + VectorAttributeIndex + TEXT(") >= 0 && (") + VectorAttributeIndex + TEXT(") < ") + NumberOfAttributesVar + TEXT(" )\n");
+		OutHLSLCode += TEXT("\t\t{\n");
+			// ( row << 1 ) | 1 if the vector has a fourth component
+			OutHLSLCode += TEXT("\t\t\thoudini_vector_column = ") + VectorColumnIndexesBuffer + TEXT("[ ") + VectorAttributeIndex + TEXT(" ];\n");
+			if ( bNeedsW )
+				OutHLSLCode += TEXT("\t\t\tif ( ( houdini_vector_column & 1 ) == 0 ) { houdini_vector_column = -1; }\n");
+			OutHLSLCode += TEXT("\t\t\tif ( houdini_vector_column >= 0 )\n");
+				OutHLSLCode += TEXT("\t\t\t\t{ houdini_vector_record = ") + VectorValuesBuffer + TEXT("[ (") + VectorSampleIndex + TEXT(") + ( houdini_vector_column >> 1 ) * (") + NumberOfSamplesVar + TEXT(") ]; }\n");
+		OutHLSLCode += TEXT("\t\t}\n");
+		return OutHLSLCode;
 	};
 
 	// Lambda returning the HLSL code for reading a Vector value in the FloatBuffer
+	// Interleaved vectors are read in the VectorValuesBuffer with a single load
 	// It expects the In_DoSwap and In_DoScale bools to be defined before being called!
 	auto ReadVectorInBuffer = [&](const FString& OutVectorValue, const FString& VectorSampleIndex, const FString& VectorAttributeIndex)
 	{
@@ -2773,9 +5118,14 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 		OutHLSLCode += TEXT("\t// ReadVectorInBuffer\n");
 		OutHLSLCode += TEXT("\t{\n");
 			OutHLSLCode += TEXT("\t\tfloat3 temp_Value = float3(0.0, 0.0, 0.0);\n");
+			OutHLSLCode += ReadVectorRecordInBuffer(VectorSampleIndex, VectorAttributeIndex, false);
+			OutHLSLCode += TEXT("\t\tif ( houdini_vector_column >= 0 )\n");
+				OutHLSLCode += TEXT("\t\t\t{ temp_Value = houdini_vector_record.xyz; }\n");
+			OutHLSLCode += TEXT("\t\telse\n\t\t{\n");
 			OutHLSLCode += ReadFloatInBuffer(TEXT("temp_Value.x"), VectorSampleIndex, VectorAttributeIndex);
 			OutHLSLCode += ReadFloatInBuffer(TEXT("temp_Value.y"), VectorSampleIndex, VectorAttributeIndex + TEXT(" + 1"));
 			OutHLSLCode += ReadFloatInBuffer(TEXT("temp_Value.z"), VectorSampleIndex, VectorAttributeIndex + TEXT(" + 2"));
+			OutHLSLCode += TEXT("\t\t}\n");
 			OutHLSLCode += TEXT("\t\t") + OutVectorValue + TEXT(" = temp_Value;\n");
 			OutHLSLCode += TEXT("\t\tif ( In_DoSwap )\n");
 			OutHLSLCode += TEXT("\t\t{\n");
@@ -2791,6 +5141,7 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 	};
 
 	// Lambda returning the HLSL code for reading a Vector value in the FloatBuffer
+	// Interleaved vectors with four components are read in the VectorValuesBuffer with a single load
 	// It expects the In_DoHoudiniToUnrealConversion bool to be defined before being called!
 	auto ReadVector4InBuffer = [&](const FString& OutVectorValue, const FString& VectorSampleIndex, const FString& VectorAttributeIndex)
 	{
@@ -2798,10 +5149,15 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 		OutHLSLCode += TEXT("\t// ReadVector4InBuffer\n");
 		OutHLSLCode += TEXT("\t{\n");
 			OutHLSLCode += TEXT("\t\tfloat4 temp_Value = float4(0.0, 0.0, 0.0, 0.0);\n");
+			OutHLSLCode += ReadVectorRecordInBuffer(VectorSampleIndex, VectorAttributeIndex, true);
+			OutHLSLCode += TEXT("\t\tif ( houdini_vector_column >= 0 )\n");
+				OutHLSLCode += TEXT("\t\t\t{ temp_Value = houdini_vector_record; }\n");
+			OutHLSLCode += TEXT("\t\telse\n\t\t{\n");
 			OutHLSLCode += ReadFloatInBuffer(TEXT("temp_Value.x"), VectorSampleIndex, VectorAttributeIndex);
 			OutHLSLCode += ReadFloatInBuffer(TEXT("temp_Value.y"), VectorSampleIndex, VectorAttributeIndex + TEXT(" + 1"));
 			OutHLSLCode += ReadFloatInBuffer(TEXT("temp_Value.z"), VectorSampleIndex, VectorAttributeIndex + TEXT(" + 2"));
 			OutHLSLCode += ReadFloatInBuffer(TEXT("temp_Value.w"), VectorSampleIndex, VectorAttributeIndex + TEXT(" + 3"));
+			OutHLSLCode += TEXT("\t\t}\n");
 			OutHLSLCode += TEXT("\t\t") + OutVectorValue + TEXT(" = temp_Value;\n");
 			OutHLSLCode += TEXT("\t\tif ( In_DoHoudiniToUnrealConversion )\n");
 			OutHLSLCode += TEXT("\t\t{\n");
@@ -2817,7 +5173,41 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 	auto GetSpecAttributeIndex = [&](const EHoudiniAttributes& Attr)
 	{
 		FString OutHLSLCode;
-		OutHLSLCode += AttributeIndexesBuffer + TEXT("[") + FString::FromInt(Attr) + TEXT("]");
+		if ( bSpecialized && SpecializedLayout.SpecialAttributeIndexes.IsValidIndex( Attr ) )
+			OutHLSLCode += TEXT("(") + FString::FromInt( SpecializedLayout.SpecialAttributeIndexes[ Attr ] ) + TEXT(")");
+		else
+			OutHLSLCode += AttributeIndexesBuffer + TEXT("[") + FString::FromInt(Attr) + TEXT("]");
+		return OutHLSLCode;
+	};
+
+	// Lambda returning the HLSL code replacing a linearly interpolated position by a cubic Hermite interpolation,
+	// using the velocities as tangents, when the point cache's PositionInterpolation is Hermite.
+	// It expects prev_index, next_index, weight, In_DoSwap and In_DoScale to be defined before being called!
+	auto HermiteInterpolatePosition = [&](const FString& Out_Value, const FString& In_PrevVector, const FString& In_NextVector, const FString& In_AttributeIndex)
+	{
+		FString OutHLSLCode;
+		OutHLSLCode += TEXT("\t// HermiteInterpolatePosition\n");
+		OutHLSLCode += TEXT("\tif ( ") + PositionInterpolationVar + TEXT(" == ") + FString::FromInt((int32)EHoudiniPositionInterpolation::Hermite)
+			+ TEXT(" && (") + In_AttributeIndex + TEXT(") == ") + GetSpecAttributeIndex(EHoudiniAttributes::POSITION) + TEXT(" && prev_index != next_index )\n");
+		OutHLSLCode += TEXT("\t{\n");
+			OutHLSLCode += TEXT("\t\tint houdini_velocity_attr = ") + GetSpecAttributeIndex(EHoudiniAttributes::VELOCITY) + TEXT(";\n");
+			OutHLSLCode += TEXT("\t\tint houdini_time_attr = ") + GetSpecAttributeIndex(EHoudiniAttributes::TIME) + TEXT(";\n");
+			OutHLSLCode += TEXT("\t\tfloat3 houdini_prev_velocity = float3( 0.0, 0.0, 0.0 );\n");
+			OutHLSLCode += ReadVectorInBuffer(TEXT("houdini_prev_velocity"), TEXT("prev_index"), TEXT("houdini_velocity_attr"));
+			OutHLSLCode += TEXT("\t\tfloat3 houdini_next_velocity = float3( 0.0, 0.0, 0.0 );\n");
+			OutHLSLCode += ReadVectorInBuffer(TEXT("houdini_next_velocity"), TEXT("next_index"), TEXT("houdini_velocity_attr"));
+			OutHLSLCode += TEXT("\t\tfloat houdini_prev_time = 0.0f;\n");
+			OutHLSLCode += ReadFloatInBuffer(TEXT("houdini_prev_time"), TEXT("prev_index"), TEXT("houdini_time_attr"));
+			OutHLSLCode += TEXT("\t\tfloat houdini_next_time = 0.0f;\n");
+			OutHLSLCode += ReadFloatInBuffer(TEXT("houdini_next_time"), TEXT("next_index"), TEXT("houdini_time_attr"));
+			OutHLSLCode += TEXT("\t\tfloat houdini_dt = houdini_next_time - houdini_prev_time;\n");
+			OutHLSLCode += TEXT("\t\tfloat houdini_a2 = weight * weight;\n");
+			OutHLSLCode += TEXT("\t\tfloat houdini_a3 = houdini_a2 * weight;\n");
+			OutHLSLCode += TEXT("\t\t") + Out_Value + TEXT(" = ( 2.0f * houdini_a3 - 3.0f * houdini_a2 + 1.0f ) * (") + In_PrevVector + TEXT(")\n");
+			OutHLSLCode += TEXT("\t\t\t+ ( houdini_a3 - 2.0f * houdini_a2 + weight ) * houdini_dt * houdini_prev_velocity\n");
+			OutHLSLCode += TEXT("\t\t\t+ ( 3.0f * houdini_a2 - 2.0f * houdini_a3 ) * (") + In_NextVector + TEXT(")\n");
+			OutHLSLCode += TEXT("\t\t\t+ ( houdini_a3 - houdini_a2 ) * houdini_dt * houdini_next_velocity;\n");
+		OutHLSLCode += TEXT("\t}\n");
 		return OutHLSLCode;
 	};
 
@@ -2834,32 +5224,143 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 		OutHLSLCode += TEXT("\t// GetSampleIndexesForPointAtTime\n");
 		OutHLSLCode += TEXT("\t{\n");
 
+			// Uniformly resampled points: compute the sample indexes from the point's first sample time, without searching
+			OutHLSLCode += TEXT("\t\tif ( ") + SampleTimeStepVar + TEXT(" > 0.0f )\n\t\t{\n");
+				OutHLSLCode += TEXT("\t\t\tif ( (") + In_PointID + TEXT(") >= 0 && (") + In_PointID + TEXT(") < ") + NumberOfPointsVar + TEXT(" )\n\t\t\t{\n");
+					OutHLSLCode += TEXT("\t\t\t\tint first_index = ") + PointSampleIndexOffsetsBuffer + TEXT("[ (") + In_PointID + TEXT(") ];\n");
+					OutHLSLCode += TEXT("\t\t\t\tint num_indexes = ") + PointSampleIndexOffsetsBuffer + TEXT("[ (") + In_PointID + TEXT(") + 1 ] - first_index;\n");
+					OutHLSLCode += TEXT("\t\t\t\tif ( num_indexes > 0 )\n\t\t\t\t{\n");
+						OutHLSLCode += TEXT("\t\t\t\t\tint first_sample_index = ") + PointSampleIndexesBuffer + TEXT("[ first_index ];\n");
+						OutHLSLCode += TEXT("\t\t\t\t\tint time_attr_index = ") + GetSpecAttributeIndex(EHoudiniAttributes::TIME) + TEXT(";\n");
+						OutHLSLCode += TEXT("\t\t\t\t\tfloat start_time = 0.0f;\n");
+						OutHLSLCode += ReadFloatInBuffer(TEXT("start_time"), TEXT("first_sample_index"), TEXT("time_attr_index"));
+						OutHLSLCode += TEXT("\t\t\t\t\tfloat step = ( (") + In_Time + TEXT(") - start_time ) / ") + SampleTimeStepVar + TEXT(";\n");
+						OutHLSLCode += TEXT("\t\t\t\t\tif ( step <= 0.0f )\n");
+							OutHLSLCode += TEXT("\t\t\t\t\t\t{ ") + Out_PreviousSampleIndex + TEXT(" = first_sample_index; ") + Out_NextSampleIndex + TEXT(" = ") + Out_PreviousSampleIndex + TEXT("; ") + Out_Weight + TEXT(" = step < 0.0f ? 0.0f : 1.0f; }\n");
+						OutHLSLCode += TEXT("\t\t\t\t\telse if ( step >= num_indexes - 1 )\n");
+							OutHLSLCode += TEXT("\t\t\t\t\t\t{ ") + Out_PreviousSampleIndex + TEXT(" = ") + PointSampleIndexesBuffer + TEXT("[ first_index + num_indexes - 1 ]; ") + Out_NextSampleIndex + TEXT(" = ") + Out_PreviousSampleIndex + TEXT("; ") + Out_Weight + TEXT(" = 1.0f; }\n");
+						OutHLSLCode += TEXT("\t\t\t\t\telse\n\t\t\t\t\t{\n");
+							OutHLSLCode += TEXT("\t\t\t\t\t\tint step_index = (int)floor( step );\n");
+							OutHLSLCode += TEXT("\t\t\t\t\t\t") + Out_PreviousSampleIndex + TEXT(" = ") + PointSampleIndexesBuffer + TEXT("[ first_index + step_index ];\n");
+							OutHLSLCode += TEXT("\t\t\t\t\t\t") + Out_NextSampleIndex + TEXT(" = ") + PointSampleIndexesBuffer + TEXT("[ first_index + step_index + 1 ];\n");
+							OutHLSLCode += TEXT("\t\t\t\t\t\t") + Out_Weight + TEXT(" = step - (float)step_index;\n");
+						OutHLSLCode += TEXT("\t\t\t\t\t}\n");
+					OutHLSLCode += TEXT("\t\t\t\t}\n");
+				OutHLSLCode += TEXT("\t\t\t}\n");
+			OutHLSLCode += TEXT("\t\t}\n");
+
+			// Fixed topology: the point has a sample on every frame, search the frame table and compute the sample indexes
+			OutHLSLCode += TEXT("\t\telse if ( ") + NumberOfPointsPerFrameVar + TEXT(" > 0 )\n\t\t{\n");
+				OutHLSLCode += TEXT("\t\t\tif ( (") + In_PointID + TEXT(") >= 0 && (") + In_PointID + TEXT(") < ") + NumberOfPointsPerFrameVar + TEXT(" )\n\t\t\t{\n");
+					// The frame bracket of the system instance's time has been precomputed during its tick
+					OutHLSLCode += TEXT("\t\t\t\tif ( ") + InstancePrevFrameIndexVar + TEXT(" >= 0 && (") + In_Time + TEXT(") == ") + InstanceTimeVar + TEXT(" )\n\t\t\t\t{\n");
+						OutHLSLCode += TEXT("\t\t\t\t\t") + Out_PreviousSampleIndex + TEXT(" = ") + InstancePrevFrameIndexVar + TEXT(" * ") + NumberOfPointsPerFrameVar + TEXT(" + (") + In_PointID + TEXT(");\n");
+						OutHLSLCode += TEXT("\t\t\t\t\t") + Out_NextSampleIndex + TEXT(" = ") + InstanceNextFrameIndexVar + TEXT(" * ") + NumberOfPointsPerFrameVar + TEXT(" + (") + In_PointID + TEXT(");\n");
+						OutHLSLCode += TEXT("\t\t\t\t\t") + Out_Weight + TEXT(" = ") + InstanceFramePrevWeightVar + TEXT(";\n");
+					OutHLSLCode += TEXT("\t\t\t\t}\n");
+					OutHLSLCode += TEXT("\t\t\t\telse\n\t\t\t\t{\n");
+						// First frame that is not before In_Time
+						OutHLSLCode += TEXT("\t\t\t\t\tint low = 0;\n");
+						OutHLSLCode += TEXT("\t\t\t\t\tint high = ") + NumberOfFramesVar + TEXT(";\n");
+						OutHLSLCode += TEXT("\t\t\t\t\twhile ( low < high )\n\t\t\t\t\t{\n");
+							OutHLSLCode += TEXT("\t\t\t\t\t\tint mid = ( low + high ) / 2;\n");
+							OutHLSLCode += TEXT("\t\t\t\t\t\tfloat mid_time = ") + FrameTimesBuffer + TEXT("[ mid ];\n");
+							OutHLSLCode += TEXT("\t\t\t\t\t\tif ( mid_time < (") + In_Time + TEXT(") && !") + IsNearlyEqualExpression("mid_time", In_Time) + TEXT(" ) { low = mid + 1; }\n");
+							OutHLSLCode += TEXT("\t\t\t\t\t\telse { high = mid; }\n");
+						OutHLSLCode += TEXT("\t\t\t\t\t}\n");
+
+						OutHLSLCode += TEXT("\t\t\t\t\tif ( low < ") + NumberOfFramesVar + TEXT(" && ") + IsNearlyEqualExpression(FrameTimesBuffer + TEXT("[ low ]"), In_Time) + TEXT(" )\n");
+							OutHLSLCode += TEXT("\t\t\t\t\t\t{ ") + Out_PreviousSampleIndex + TEXT(" = low * ") + NumberOfPointsPerFrameVar + TEXT(" + (") + In_PointID + TEXT("); ") + Out_NextSampleIndex + TEXT(" = ") + Out_PreviousSampleIndex + TEXT("; ") + Out_Weight + TEXT(" = 1.0f; }\n");
+						OutHLSLCode += TEXT("\t\t\t\t\telse if ( low <= 0 )\n");
+							OutHLSLCode += TEXT("\t\t\t\t\t\t{ ") + Out_PreviousSampleIndex + TEXT(" = (") + In_PointID + TEXT("); ") + Out_NextSampleIndex + TEXT(" = ") + Out_PreviousSampleIndex + TEXT("; ") + Out_Weight + TEXT(" = 0.0f; }\n");
+						OutHLSLCode += TEXT("\t\t\t\t\telse\n\t\t\t\t\t{\n");
+							// If several frames share the previous time, the first one is used, like FindSampleTimesBracket on the CPU
+							OutHLSLCode += TEXT("\t\t\t\t\t\tfloat prev_frame_time = ") + FrameTimesBuffer + TEXT("[ low - 1 ];\n");
+							OutHLSLCode += TEXT("\t\t\t\t\t\tint prev_low = 0;\n");
+							OutHLSLCode += TEXT("\t\t\t\t\t\tint prev_high = low - 1;\n");
+							OutHLSLCode += TEXT("\t\t\t\t\t\twhile ( prev_low < prev_high )\n\t\t\t\t\t\t{\n");
+								OutHLSLCode += TEXT("\t\t\t\t\t\t\tint mid = ( prev_low + prev_high ) / 2;\n");
+								OutHLSLCode += TEXT("\t\t\t\t\t\t\tif ( ") + FrameTimesBuffer + TEXT("[ mid ] < prev_frame_time ) { prev_low = mid + 1; }\n");
+								OutHLSLCode += TEXT("\t\t\t\t\t\t\telse { prev_high = mid; }\n");
+							OutHLSLCode += TEXT("\t\t\t\t\t\t}\n");
+							OutHLSLCode += TEXT("\t\t\t\t\t\t") + Out_PreviousSampleIndex + TEXT(" = prev_low * ") + NumberOfPointsPerFrameVar + TEXT(" + (") + In_PointID + TEXT(");\n");
+							OutHLSLCode += TEXT("\t\t\t\t\t\tif ( low >= ") + NumberOfFramesVar + TEXT(" )\n");
+								OutHLSLCode += TEXT("\t\t\t\t\t\t\t{ ") + Out_NextSampleIndex + TEXT(" = ") + Out_PreviousSampleIndex + TEXT("; ") + Out_Weight + TEXT(" = 1.0f; }\n");
+							OutHLSLCode += TEXT("\t\t\t\t\t\telse\n\t\t\t\t\t\t{\n");
+								OutHLSLCode += TEXT("\t\t\t\t\t\t\t") + Out_NextSampleIndex + TEXT(" = low * ") + NumberOfPointsPerFrameVar + TEXT(" + (") + In_PointID + TEXT(");\n");
+								OutHLSLCode += TEXT("\t\t\t\t\t\t\t") + Out_Weight + TEXT(" = ( ( (") + In_Time + TEXT(") - prev_frame_time ) / ( ") + FrameTimesBuffer + TEXT("[ low ] - prev_frame_time ) );\n");
+							OutHLSLCode += TEXT("\t\t\t\t\t\t}\n");
+						OutHLSLCode += TEXT("\t\t\t\t\t}\n");
+					OutHLSLCode += TEXT("\t\t\t\t}\n");
+				OutHLSLCode += TEXT("\t\t\t}\n");
+			OutHLSLCode += TEXT("\t\t}\n");
+			OutHLSLCode += TEXT("\t\telse\n\t\t{\n");
+
 			OutHLSLCode += TEXT("\t\tbool prev_time_valid = false;\n");
 			OutHLSLCode += TEXT("\t\tfloat prev_time = -1.0f;\n");
 			OutHLSLCode += TEXT("\t\tbool next_time_valid = false;\n");
 			OutHLSLCode += TEXT("\t\tfloat next_time = -1.0f;\n");
 			OutHLSLCode += TEXT("\t\tbool is_weight_set = false;\n");
 
-			// Look at all the values for this Point
-			OutHLSLCode += TEXT("\t\tfor( int n = 0; n < ") + MaxNumberOfIndexesPerPointVar + TEXT("; n++ )\n\t\t{\n");
-				OutHLSLCode += TEXT("\t\t\tint current_sample_index = ") + PointValueIndexesBuffer + TEXT("[ (") + In_PointID + TEXT(") * ") + MaxNumberOfIndexesPerPointVar + TEXT(" + n ];\n");
-				OutHLSLCode += TEXT("\t\t\tif ( current_sample_index < 0 ){ break; }\n");
+			// Get the range of sample indexes for this Point
+			OutHLSLCode += TEXT("\t\tint first_index = 0;\n");
+			OutHLSLCode += TEXT("\t\tint last_index = 0;\n");
+			OutHLSLCode += TEXT("\t\tif ( (") + In_PointID + TEXT(") >= 0 && (") + In_PointID + TEXT(") < ") + NumberOfPointsVar + TEXT(" )\n\t\t{\n");
+				OutHLSLCode += TEXT("\t\t\tfirst_index = ") + PointSampleIndexOffsetsBuffer + TEXT("[ (") + In_PointID + TEXT(") ];\n");
+				OutHLSLCode += TEXT("\t\t\tlast_index = ") + PointSampleIndexOffsetsBuffer + TEXT("[ (") + In_PointID + TEXT(") + 1 ];\n");
+			OutHLSLCode += TEXT("\t\t}\n");
 
-				OutHLSLCode += TEXT("\t\t\tfloat current_time = -1.0f;\n");
-				OutHLSLCode += TEXT("\t\t\tint time_attr_index = ") + GetSpecAttributeIndex(EHoudiniAttributes::TIME) + TEXT(";\n");
-				OutHLSLCode += TEXT("\t\t\tif ( time_attr_index < 0 || time_attr_index >= ") + NumberOfAttributesVar + TEXT(" )\n");
-					OutHLSLCode += TEXT("\t\t\t\t{ current_time = 0.0f; }\n");
-				OutHLSLCode += TEXT("\t\t\telse\n");
+			// The time attribute index is the same for all the samples, read it once
+			OutHLSLCode += TEXT("\t\tint time_attr_index = ") + GetSpecAttributeIndex(EHoudiniAttributes::TIME) + TEXT(";\n");
+			OutHLSLCode += TEXT("\t\tbool has_time_attr = time_attr_index >= 0 && time_attr_index < ") + NumberOfAttributesVar + TEXT(";\n");
+			OutHLSLCode += TEXT("\t\tint current_sample_index = 0;\n");
+			OutHLSLCode += TEXT("\t\tfloat current_time = 0.0f;\n");
+
+			// A point's samples are sorted by time: binary search for the first one that is not before In_Time
+			OutHLSLCode += TEXT("\t\tint low = first_index;\n");
+			OutHLSLCode += TEXT("\t\tint high = last_index;\n");
+			OutHLSLCode += TEXT("\t\twhile ( low < high )\n\t\t{\n");
+				OutHLSLCode += TEXT("\t\t\tint mid = ( low + high ) / 2;\n");
+				OutHLSLCode += TEXT("\t\t\tcurrent_sample_index = ") + PointSampleIndexesBuffer + TEXT("[ mid ];\n");
+				OutHLSLCode += TEXT("\t\t\tcurrent_time = 0.0f;\n");
+				OutHLSLCode += TEXT("\t\t\tif ( has_time_attr )\n");
 					OutHLSLCode += TEXT("\t\t\t{") + ReadFloatInBuffer(TEXT("current_time"), TEXT("current_sample_index"), TEXT("time_attr_index")) + TEXT(" }\n");
+				OutHLSLCode += TEXT("\t\t\tif ( current_time < (") + In_Time + TEXT(") && !") + IsNearlyEqualExpression("current_time", In_Time) + TEXT(" ) { low = mid + 1; }\n");
+				OutHLSLCode += TEXT("\t\t\telse { high = mid; }\n");
+			OutHLSLCode += TEXT("\t\t}\n");
 
+			// The sample found is either at In_Time, or the next one
+			OutHLSLCode += TEXT("\t\tif ( low < last_index )\n\t\t{\n");
+				OutHLSLCode += TEXT("\t\t\tcurrent_sample_index = ") + PointSampleIndexesBuffer + TEXT("[ low ];\n");
+				OutHLSLCode += TEXT("\t\t\tcurrent_time = 0.0f;\n");
+				OutHLSLCode += TEXT("\t\t\tif ( has_time_attr )\n");
+					OutHLSLCode += TEXT("\t\t\t{") + ReadFloatInBuffer(TEXT("current_time"), TEXT("current_sample_index"), TEXT("time_attr_index")) + TEXT(" }\n");
 				OutHLSLCode += TEXT("\t\t\tif ( ") + IsNearlyEqualExpression("current_time", In_Time) + TEXT(" )\n");
-					OutHLSLCode += TEXT("\t\t\t\t{ ") + Out_PreviousSampleIndex + TEXT(" = current_sample_index; ") + Out_NextSampleIndex + TEXT(" = current_sample_index; ") + Out_Weight + TEXT(" = 1.0; is_weight_set = true; break;}\n");
-				OutHLSLCode += TEXT("\t\t\telse if ( current_time < (") + In_Time + TEXT(") ){\n");
-					OutHLSLCode += TEXT("\t\t\t\tif ( !prev_time_valid || prev_time < current_time )\n");
-						OutHLSLCode += TEXT("\t\t\t\t\t { ") + Out_PreviousSampleIndex + TEXT(" = current_sample_index; prev_time = current_time; prev_time_valid = true; }\n");
+					OutHLSLCode += TEXT("\t\t\t\t{ ") + Out_PreviousSampleIndex + TEXT(" = current_sample_index; ") + Out_NextSampleIndex + TEXT(" = current_sample_index; ") + Out_Weight + TEXT(" = 1.0; is_weight_set = true; }\n");
+				OutHLSLCode += TEXT("\t\t\telse\n");
+					OutHLSLCode += TEXT("\t\t\t\t{ ") + Out_NextSampleIndex + TEXT(" = current_sample_index; next_time = current_time; next_time_valid = true; }\n");
+			OutHLSLCode += TEXT("\t\t}\n");
+
+			// The sample preceding it has the previous time, if several samples share it the first one is used, like FindSampleTimesBracket on the CPU
+			OutHLSLCode += TEXT("\t\tif ( !is_weight_set && low > first_index )\n\t\t{\n");
+				OutHLSLCode += TEXT("\t\t\tcurrent_sample_index = ") + PointSampleIndexesBuffer + TEXT("[ low - 1 ];\n");
+				OutHLSLCode += TEXT("\t\t\tcurrent_time = 0.0f;\n");
+				OutHLSLCode += TEXT("\t\t\tif ( has_time_attr )\n");
+					OutHLSLCode += TEXT("\t\t\t{") + ReadFloatInBuffer(TEXT("current_time"), TEXT("current_sample_index"), TEXT("time_attr_index")) + TEXT(" }\n");
+				OutHLSLCode += TEXT("\t\t\tprev_time = current_time; prev_time_valid = true;\n");
+
+				OutHLSLCode += TEXT("\t\t\tint prev_low = first_index;\n");
+				OutHLSLCode += TEXT("\t\t\tint prev_high = low - 1;\n");
+				OutHLSLCode += TEXT("\t\t\twhile ( prev_low < prev_high )\n\t\t\t{\n");
+					OutHLSLCode += TEXT("\t\t\t\tint mid = ( prev_low + prev_high ) / 2;\n");
+					OutHLSLCode += TEXT("\t\t\t\tcurrent_sample_index = ") + PointSampleIndexesBuffer + TEXT("[ mid ];\n");
+					OutHLSLCode += TEXT("\t\t\t\tcurrent_time = 0.0f;\n");
+					OutHLSLCode += TEXT("\t\t\t\tif ( has_time_attr )\n");
+						OutHLSLCode += TEXT("\t\t\t\t{") + ReadFloatInBuffer(TEXT("current_time"), TEXT("current_sample_index"), TEXT("time_attr_index")) + TEXT(" }\n");
+					OutHLSLCode += TEXT("\t\t\t\tif ( current_time < prev_time ) { prev_low = mid + 1; }\n");
+					OutHLSLCode += TEXT("\t\t\t\telse { prev_high = mid; }\n");
 				OutHLSLCode += TEXT("\t\t\t}\n");
-				OutHLSLCode += TEXT("\t\t\telse if ( !next_time_valid || next_time > current_time )\n");
-					OutHLSLCode += TEXT("\t\t\t\t { ") + Out_NextSampleIndex + TEXT(" = current_sample_index; next_time = current_time; next_time_valid = true; break; }\n");
+				OutHLSLCode += TEXT("\t\t\t") + Out_PreviousSampleIndex + TEXT(" = ") + PointSampleIndexesBuffer + TEXT("[ prev_low ];\n");
 			OutHLSLCode += TEXT("\t\t}\n");
 
 			// Calculate the weight. We can only calculate the weight if at least one of Previous or Next Sample Index is valid,
@@ -2875,6 +5376,140 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 			OutHLSLCode += TEXT("\t\tif ( !is_weight_set && prev_time_valid && next_time_valid )\n");
 				OutHLSLCode += TEXT("\t\t\t{ ") + Out_Weight + TEXT(" = ( ( (") + In_Time + TEXT(") - prev_time ) / ( next_time - prev_time ) ); }\n");
 
+			OutHLSLCode += TEXT("\t\t}\n");
+		OutHLSLCode += TEXT("\t}\n");
+		return OutHLSLCode;
+	};
+
+	// Lambda returning the HLSL code reading the time of a point's sample (by its index in the point's sorted samples) for the cursor search.
+	// It expects is_fixed, first_index, time_attr_index and cursor_time_value to be defined before being called!
+	auto ReadCursorSampleTime = [&](const FString& Out_Time, const FString& In_Idx)
+	{
+		FString OutHLSLCode;
+		OutHLSLCode += TEXT("\t\t\t\tif ( is_fixed ) { ") + Out_Time + TEXT(" = ") + FrameTimesBuffer + TEXT("[ ") + In_Idx + TEXT(" ]; }\n");
+		OutHLSLCode += TEXT("\t\t\t\telse if ( time_attr_index < 0 || time_attr_index >= ") + NumberOfAttributesVar + TEXT(" ) { ") + Out_Time + TEXT(" = 0.0f; }\n");
+		OutHLSLCode += TEXT("\t\t\t\telse\n\t\t\t\t{\n");
+			OutHLSLCode += TEXT("\t\t\t\t\tint cursor_sample_index = ") + PointSampleIndexesBuffer + TEXT("[ first_index + ") + In_Idx + TEXT(" ];\n");
+			OutHLSLCode += ReadFloatInBuffer(TEXT("cursor_time_value"), TEXT("cursor_sample_index"), TEXT("time_attr_index"));
+			OutHLSLCode += TEXT("\t\t\t\t\t") + Out_Time + TEXT(" = cursor_time_value;\n");
+		OutHLSLCode += TEXT("\t\t\t\t}\n");
+		return OutHLSLCode;
+	};
+
+	// Lambda returning the HLSL code for the first index in [In_Low, In_High) of the point's sorted samples for which In_IsBefore,
+	// evaluated on sample_time, is false. Gallops from In_Hint first if it is in [In_Low, In_High], like SampleTimesLowerBound on the CPU,
+	// so bounds close to the hint are found in a few steps and far ones in a logarithmic number of steps.
+	// It expects the variables used by ReadCursorSampleTime and sample_time to be defined before being called!
+	auto CursorSampleTimesLowerBound = [&](const FString& Out_Index, const FString& In_Low, const FString& In_High, const FString& In_Hint, const FString& In_IsBefore)
+	{
+		FString OutHLSLCode;
+		OutHLSLCode += TEXT("\t\t\t{\n");
+			OutHLSLCode += TEXT("\t\t\tint low = (") + In_Low + TEXT(");\n");
+			OutHLSLCode += TEXT("\t\t\tint high = (") + In_High + TEXT(");\n");
+			OutHLSLCode += TEXT("\t\t\tint hint = (") + In_Hint + TEXT(");\n");
+			OutHLSLCode += TEXT("\t\t\tif ( hint >= low && hint <= high )\n\t\t\t{\n");
+				OutHLSLCode += TEXT("\t\t\t\tint step = 1;\n");
+				OutHLSLCode += TEXT("\t\t\t\tbool hint_is_before = false;\n");
+				OutHLSLCode += TEXT("\t\t\t\tif ( hint < high )\n\t\t\t\t{\n");
+					OutHLSLCode += ReadCursorSampleTime(TEXT("sample_time"), TEXT("hint"));
+					OutHLSLCode += TEXT("\t\t\t\t\thint_is_before = ") + In_IsBefore + TEXT(";\n");
+				OutHLSLCode += TEXT("\t\t\t\t}\n");
+				OutHLSLCode += TEXT("\t\t\t\tif ( hint_is_before )\n\t\t\t\t{\n");
+					// The bound is after the hint
+					OutHLSLCode += TEXT("\t\t\t\t\tint probe = hint + 1;\n");
+					OutHLSLCode += TEXT("\t\t\t\t\tlow = probe;\n");
+					OutHLSLCode += TEXT("\t\t\t\t\twhile ( probe < high )\n\t\t\t\t\t{\n");
+						OutHLSLCode += ReadCursorSampleTime(TEXT("sample_time"), TEXT("probe"));
+						OutHLSLCode += TEXT("\t\t\t\t\t\tif ( !") + In_IsBefore + TEXT(" ) { break; }\n");
+						OutHLSLCode += TEXT("\t\t\t\t\t\tlow = probe + 1;\n");
+						OutHLSLCode += TEXT("\t\t\t\t\t\tprobe = low + step;\n");
+						OutHLSLCode += TEXT("\t\t\t\t\t\tstep *= 2;\n");
+					OutHLSLCode += TEXT("\t\t\t\t\t}\n");
+					OutHLSLCode += TEXT("\t\t\t\t\thigh = min( probe, high );\n");
+				OutHLSLCode += TEXT("\t\t\t\t}\n");
+				OutHLSLCode += TEXT("\t\t\t\telse\n\t\t\t\t{\n");
+					// The bound is at or before the hint
+					OutHLSLCode += TEXT("\t\t\t\t\tint probe = hint - 1;\n");
+					OutHLSLCode += TEXT("\t\t\t\t\thigh = hint;\n");
+					OutHLSLCode += TEXT("\t\t\t\t\twhile ( probe >= low )\n\t\t\t\t\t{\n");
+						OutHLSLCode += ReadCursorSampleTime(TEXT("sample_time"), TEXT("probe"));
+						OutHLSLCode += TEXT("\t\t\t\t\t\tif ( ") + In_IsBefore + TEXT(" ) { break; }\n");
+						OutHLSLCode += TEXT("\t\t\t\t\t\thigh = probe;\n");
+						OutHLSLCode += TEXT("\t\t\t\t\t\tprobe = high - step;\n");
+						OutHLSLCode += TEXT("\t\t\t\t\t\tstep *= 2;\n");
+					OutHLSLCode += TEXT("\t\t\t\t\t}\n");
+					OutHLSLCode += TEXT("\t\t\t\t\tlow = max( probe + 1, low );\n");
+				OutHLSLCode += TEXT("\t\t\t\t}\n");
+			OutHLSLCode += TEXT("\t\t\t}\n");
+			OutHLSLCode += TEXT("\t\t\twhile ( low < high )\n\t\t\t{\n");
+				OutHLSLCode += TEXT("\t\t\t\tint mid = ( low + high ) / 2;\n");
+				OutHLSLCode += ReadCursorSampleTime(TEXT("sample_time"), TEXT("mid"));
+				OutHLSLCode += TEXT("\t\t\t\tif ( ") + In_IsBefore + TEXT(" ) { low = mid + 1; } else { high = mid; }\n");
+			OutHLSLCode += TEXT("\t\t\t}\n");
+			OutHLSLCode += TEXT("\t\t\t") + Out_Index + TEXT(" = low;\n");
+		OutHLSLCode += TEXT("\t\t\t}\n");
+		return OutHLSLCode;
+	};
+
+	// Lambda returning the HLSL code for getting the previous and next sample indexes for a given particle at a given time,
+	// resuming the search from a sample cursor: the index of the first of the point's samples that is not before the time.
+	// The search gallops from the cursor, a cursor outside of the point's samples starts a new binary search.
+	// Uniformly resampled points are not searched.
+	auto GetSampleIndexesForPointAtTimeWithCursor = [&](const FString& In_PointID, const FString& In_Time, const FString& In_SampleCursor, const FString& Out_PreviousSampleIndex, const FString& Out_NextSampleIndex, const FString& Out_Weight, const FString& Out_SampleCursor)
+	{
+		const FString IsBeforeTime = FString::Printf(TEXT("( sample_time < (%s) && !%s )"), *In_Time, *IsNearlyEqualExpression(TEXT("sample_time"), In_Time));
+
+		FString OutHLSLCode;
+		OutHLSLCode += TEXT("\t// GetSampleIndexesForPointAtTimeWithCursor\n");
+		OutHLSLCode += TEXT("\t") + Out_SampleCursor + TEXT(" = (") + In_SampleCursor + TEXT(");\n");
+		OutHLSLCode += TEXT("\tif ( ") + SampleTimeStepVar + TEXT(" > 0.0f )\n\t{\n");
+			OutHLSLCode += GetSampleIndexesForPointAtTime(In_PointID, In_Time, Out_PreviousSampleIndex, Out_NextSampleIndex, Out_Weight);
+		OutHLSLCode += TEXT("\t}\n");
+		OutHLSLCode += TEXT("\telse\n\t{\n");
+			OutHLSLCode += TEXT("\t\tbool is_fixed = ") + NumberOfPointsPerFrameVar + TEXT(" > 0;\n");
+			OutHLSLCode += TEXT("\t\tint first_index = 0;\n");
+			OutHLSLCode += TEXT("\t\tint num_times = 0;\n");
+			OutHLSLCode += TEXT("\t\tif ( is_fixed )\n");
+				OutHLSLCode += TEXT("\t\t\t{ if ( (") + In_PointID + TEXT(") >= 0 && (") + In_PointID + TEXT(") < ") + NumberOfPointsPerFrameVar + TEXT(" ) { num_times = ") + NumberOfFramesVar + TEXT("; } }\n");
+			OutHLSLCode += TEXT("\t\telse if ( (") + In_PointID + TEXT(") >= 0 && (") + In_PointID + TEXT(") < ") + NumberOfPointsVar + TEXT(" )\n\t\t{\n");
+				OutHLSLCode += TEXT("\t\t\tfirst_index = ") + PointSampleIndexOffsetsBuffer + TEXT("[ (") + In_PointID + TEXT(") ];\n");
+				OutHLSLCode += TEXT("\t\t\tnum_times = ") + PointSampleIndexOffsetsBuffer + TEXT("[ (") + In_PointID + TEXT(") + 1 ] - first_index;\n");
+			OutHLSLCode += TEXT("\t\t}\n");
+			OutHLSLCode += TEXT("\t\tint time_attr_index = ") + GetSpecAttributeIndex(EHoudiniAttributes::TIME) + TEXT(";\n");
+
+			OutHLSLCode += TEXT("\t\tif ( num_times > 0 )\n\t\t{\n");
+				OutHLSLCode += TEXT("\t\t\tfloat cursor_time_value = 0.0f;\n");
+				OutHLSLCode += TEXT("\t\t\tfloat sample_time = 0.0f;\n");
+				OutHLSLCode += TEXT("\t\t\tint next_idx = 0;\n");
+				// Find the first sample that is not before In_Time, galloping from the cursor when it is within the point's samples
+				OutHLSLCode += CursorSampleTimesLowerBound(TEXT("next_idx"), TEXT("0"), TEXT("num_times"), In_SampleCursor, IsBeforeTime);
+				OutHLSLCode += TEXT("\t\t\t") + Out_SampleCursor + TEXT(" = next_idx;\n");
+
+				OutHLSLCode += TEXT("\t\t\tint prev_idx = next_idx;\n");
+				OutHLSLCode += TEXT("\t\t\tfloat next_time = 0.0f;\n");
+				OutHLSLCode += TEXT("\t\t\tif ( next_idx < num_times )\n\t\t\t{\n");
+					OutHLSLCode += ReadCursorSampleTime(TEXT("next_time"), TEXT("next_idx"));
+				OutHLSLCode += TEXT("\t\t\t}\n");
+				OutHLSLCode += TEXT("\t\t\tif ( next_idx < num_times && ") + IsNearlyEqualExpression(TEXT("next_time"), In_Time) + TEXT(" )\n");
+					OutHLSLCode += TEXT("\t\t\t\t{ ") + Out_Weight + TEXT(" = 1.0f; }\n");
+				OutHLSLCode += TEXT("\t\t\telse if ( next_idx <= 0 )\n");
+					OutHLSLCode += TEXT("\t\t\t\t{ prev_idx = 0; next_idx = 0; ") + Out_Weight + TEXT(" = 0.0f; }\n");
+				OutHLSLCode += TEXT("\t\t\telse\n\t\t\t{\n");
+					// If several samples share the previous time value, use the first one
+					OutHLSLCode += TEXT("\t\t\t\tfloat prev_time = 0.0f;\n");
+					OutHLSLCode += ReadCursorSampleTime(TEXT("prev_time"), TEXT("next_idx - 1"));
+					OutHLSLCode += CursorSampleTimesLowerBound(TEXT("prev_idx"), TEXT("0"), TEXT("next_idx - 1"), TEXT("next_idx - 1"), TEXT("( sample_time < prev_time )"));
+					OutHLSLCode += TEXT("\t\t\t\tif ( next_idx >= num_times )\n");
+						OutHLSLCode += TEXT("\t\t\t\t\t{ next_idx = prev_idx; ") + Out_Weight + TEXT(" = 1.0f; }\n");
+					OutHLSLCode += TEXT("\t\t\t\telse\n");
+						OutHLSLCode += TEXT("\t\t\t\t\t{ ") + Out_Weight + TEXT(" = ( ( (") + In_Time + TEXT(") - prev_time ) / ( next_time - prev_time ) ); }\n");
+				OutHLSLCode += TEXT("\t\t\t}\n");
+
+				OutHLSLCode += TEXT("\t\t\tif ( is_fixed )\n");
+					OutHLSLCode += TEXT("\t\t\t\t{ ") + Out_PreviousSampleIndex + TEXT(" = prev_idx * ") + NumberOfPointsPerFrameVar + TEXT(" + (") + In_PointID + TEXT("); ") + Out_NextSampleIndex + TEXT(" = next_idx * ") + NumberOfPointsPerFrameVar + TEXT(" + (") + In_PointID + TEXT("); }\n");
+				OutHLSLCode += TEXT("\t\t\telse\n");
+					OutHLSLCode += TEXT("\t\t\t\t{ ") + Out_PreviousSampleIndex + TEXT(" = ") + PointSampleIndexesBuffer + TEXT("[ first_index + prev_idx ]; ") + Out_NextSampleIndex + TEXT(" = ") + PointSampleIndexesBuffer + TEXT("[ first_index + next_idx ]; }\n");
+			OutHLSLCode += TEXT("\t\t}\n");
 		OutHLSLCode += TEXT("\t}\n");
 		return OutHLSLCode;
 	};
@@ -2890,6 +5525,17 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 		OutHLSL += TEXT("\n}\n");
 		return true;
 	}
+	else if (FunctionInfo.DefinitionName == GetIntValueName)
+	{
+		// GetIntValue(int In_SampleIndex, int In_AttributeIndex, out int Out_Value)
+		OutHLSL += TEXT("void ") + FunctionInfo.InstanceName + TEXT("(int In_SampleIndex, int In_AttributeIndex, out int Out_Value) \n{\n");
+
+			OutHLSL += TEXT("\tOut_Value = 0;\n");
+			OutHLSL += ReadIntInBuffer(TEXT("Out_Value"), TEXT("In_SampleIndex"), TEXT("In_AttributeIndex"));
+
+		OutHLSL += TEXT("\n}\n");
+		return true;
+	}
 	else if (FunctionInfo.DefinitionName == GetVectorValueName)
 	{
 		// GetVectorValue(int In_SampleIndex, int In_AttributeIndex, out float3 Out_Value)
@@ -3062,16 +5708,28 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 		// GetLastSampleIndexAtTime(float In_Time, out int Out_Value)
 		OutHLSL += TEXT("void ") + FunctionInfo.InstanceName + TEXT("(float In_Time, out int Out_Value) \n{\n");
 
+			OutHLSL += TEXT("\tif ( ") + NumberOfFramesVar + TEXT(" > 0 )\n\t{\n");
+				// Binary search for the first frame with a time value higher than In_Time in the frame table,
+				// the last sample of the frame preceding it is the one we're looking for
+				OutHLSL += TEXT("\t\tint low = 0;\n");
+				OutHLSL += TEXT("\t\tint high = ") + NumberOfFramesVar + TEXT(";\n");
+				OutHLSL += TEXT("\t\twhile ( low < high )\n\t\t{\n");
+					OutHLSL += TEXT("\t\t\tint mid = ( low + high ) / 2;\n");
+					OutHLSL += TEXT("\t\t\tif ( ") + FrameTimesBuffer + TEXT("[ mid ] <= In_Time ) { low = mid + 1; }\n");
+					OutHLSL += TEXT("\t\t\telse { high = mid; }\n");
+				OutHLSL += TEXT("\t\t}\n");
+				OutHLSL += TEXT("\t\tOut_Value = ") + FrameSampleIndexOffsetsBuffer + TEXT("[ low ] - 1;\n");
+				OutHLSL += TEXT("\t\treturn;\n");
+			OutHLSL += TEXT("\t}\n");
+
+			// No frame table, iterate on the samples
+			OutHLSL += TEXT("\tOut_Value = ") + NumberOfSamplesVar + TEXT(" - 1;\n");
 			OutHLSL += TEXT("\tint In_TimeAttributeIndex = ") + GetSpecAttributeIndex( EHoudiniAttributes::TIME ) + TEXT(";\n");
+			OutHLSL += TEXT("\tif ( In_TimeAttributeIndex < 0 ) { return; }\n");
 			OutHLSL += TEXT("\tfloat temp_time = 1.0;\n");
-			OutHLSL += ReadFloatInBuffer(TEXT("temp_time"), NumberOfSamplesVar + TEXT("- 1"), TEXT("In_TimeAttributeIndex"));
-			OutHLSL += TEXT("\tif ( temp_time < In_Time ) { Out_Value = ") + NumberOfSamplesVar + TEXT(" - 1; return; }\n");
-			OutHLSL += TEXT("\tint lastSampleIndex = -1;\n");
 			OutHLSL += TEXT("\tfor( int n = 0; n < ") + NumberOfSamplesVar + TEXT("; n++ )\n\t{\n");
 				OutHLSL += TEXT("\t") + ReadFloatInBuffer(TEXT("temp_time"), TEXT("n"), TEXT("In_TimeAttributeIndex"));
-				OutHLSL += TEXT("\t\tif ( temp_time == In_Time ){ lastSampleIndex = n ;}");
-				OutHLSL += TEXT("\t\telse if ( temp_time > In_Time ){ lastSampleIndex = n -1; return;}");
-				OutHLSL += TEXT("\t\tif ( lastSampleIndex == -1 ){ lastSampleIndex = ") + NumberOfSamplesVar + TEXT(" - 1; }");
+				OutHLSL += TEXT("\t\tif ( temp_time > In_Time ){ Out_Value = n - 1; return; }\n");
 			OutHLSL += TEXT("\t}\n");
 
 		OutHLSL += TEXT("\n}\n");
@@ -3083,73 +5741,67 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 		OutHLSL += TEXT("void ") + FunctionInfo.InstanceName + TEXT("(float In_Time, float In_LastSpawnTime, float In_LastSpawnTimeRequest, int In_LastSpawnedPointID, out int Out_MinID, out int Out_MaxID, out int Out_Count, out float Out_LastSpawnTime, out float Out_LastSpawnTimeRequest, out int Out_LastSpawnPointID) \n{\n");
 			
 			OutHLSL += TEXT("\tint time_attr_index = ") + GetSpecAttributeIndex(EHoudiniAttributes::TIME) + TEXT(";\n");
-			OutHLSL += TEXT("\tif( time_attr_index < 0 )\n");
-				OutHLSL += TEXT("\t\t{ Out_Count = ") + NumberOfPointsVar +TEXT("; Out_MinID = 0; Out_MaxID = Out_Count - 1; In_LastSpawnTimeRequest = In_Time; return; }\n");
-
-			// GetLastPointIDToSpawnAtTime
-			OutHLSL += TEXT("\tint last_id = -1;\n");
-			OutHLSL += TEXT("\tif ( ") + SpawnTimeBuffer + TEXT("[ ") + NumberOfPointsVar + TEXT(" - 1 ] < In_Time && In_Time > In_LastSpawnTimeRequest )\n");
-			OutHLSL += TEXT("\t{\n");
-				OutHLSL += TEXT("\t\tlast_id = ") + NumberOfPointsVar + TEXT(" - 1;\n");
-			OutHLSL += TEXT("\t}\n");
-			OutHLSL += TEXT("\telse\n");
-			OutHLSL += TEXT("\t{\n");
-				OutHLSL += TEXT("\t\tfloat temp_time = 0;\n");
-				OutHLSL += TEXT("\t\tfor( int n = 0; n < ") + NumberOfPointsVar + TEXT("; n++ )\n\t\t{\n");
-					OutHLSL += TEXT("\t\t\ttemp_time = ") + SpawnTimeBuffer + TEXT("[ n ];\n");
-					OutHLSL += TEXT("\t\t\tif ( temp_time > In_Time )\n");
-						OutHLSL += TEXT("\t\t\t\t{ break; }\n");
-					OutHLSL += TEXT("\t\t\tlast_id = n;\n");
-				OutHLSL += TEXT("\t\t}\n");
-			OutHLSL += TEXT("\t}\n");
-
-			// First, detect if we need to reset LastSpawnedPointID (after a loop of the emitter)
-			OutHLSL += TEXT("\tif ( last_id < In_LastSpawnedPointID || In_Time <= In_LastSpawnTime || In_Time <= In_LastSpawnTimeRequest )\n");
-				OutHLSL += TEXT("\t\t{ In_LastSpawnedPointID = -1; }\n");
+			OutHLSL += TEXT("\tbool has_time_attr = time_attr_index >= 0;\n");
+			OutHLSL += TEXT("\tint num_points = ") + NumberOfPointsVar + TEXT(";\n");
+			OutHLSL += TEXT("\tint spawn_times_sorted = ") + SpawnTimesSortedVar + TEXT(";\n");
 
-			OutHLSL += TEXT("\tif ( last_id < 0 )\n");
-			OutHLSL += TEXT("\t{\n");
-				// Nothing to spawn, t is lower than the point's time
-				OutHLSL += TEXT("\t\t In_LastSpawnedPointID = -1;\n");
-				OutHLSL += TEXT("\t\tOut_MinID = last_id;\n");
-				OutHLSL += TEXT("\t\tOut_MaxID = last_id;\n");
-				OutHLSL += TEXT("\t\tOut_Count = 0;\n");
-			OutHLSL += TEXT("\t}\n");
-			OutHLSL += TEXT("\telse\n");
-			OutHLSL += TEXT("\t{\n");
+			// Shared with the C++ version used by HoudiniNiagara.CheckSpawnRangeParity
+			OutHLSL += TEXT("\t") + FString( HOUDINI_SPAWN_RANGE_SOURCE( HOUDINI_SHARED_SOURCE_STRING ) ).Replace( TEXT("spawn_times_buffer"), *SpawnTimeBuffer ) + TEXT("\n");
 
-				// The last time value in the CSV is lower than t, spawn everything if we didnt already!
-				OutHLSL += TEXT("\t\tif ( last_id >= In_LastSpawnedPointID )\n");
-				OutHLSL += TEXT("\t\t{\n");
-					OutHLSL += TEXT("\t\t\tlast_id = last_id - 1;\n");
-				OutHLSL += TEXT("\t\t}\n");
+		OutHLSL += TEXT("\n}\n");
+		return true;
+	}
+	else if (FunctionInfo.DefinitionName == GetPointIDsToSpawnName)
+	{
+		// GetPointIDsToSpawn(out int Out_MinID, out int Out_MaxID, out int Out_Count)
+		// The spawn range has been computed for the system instance during its tick
+		OutHLSL += TEXT("void ") + FunctionInfo.InstanceName + TEXT("(out int Out_MinID, out int Out_MaxID, out int Out_Count) \n{\n");
+			OutHLSL += TEXT("\tOut_MinID = ") + SpawnMinPointIdVar + TEXT(";\n");
+			OutHLSL += TEXT("\tOut_MaxID = ") + SpawnMaxPointIdVar + TEXT(";\n");
+			OutHLSL += TEXT("\tOut_Count = ") + SpawnCountVar + TEXT(";\n");
+		OutHLSL += TEXT("\n}\n");
+		return true;
+	}
+	else if (FunctionInfo.DefinitionName == GetAlivePointsAtTimeName)
+	{
+		// GetAlivePointsAtTime(float In_Time, out int Out_MinID, out int Out_MaxID, out int Out_Count)
+		// The alive interval index is made of four sections of NumberOfPoints values: the sorted spawn times, the min spawn time
+		// of points [i, NumberOfPoints), the sorted death times and the max death time of points [0, i]
+		auto UpperBoundInSection = [&]( const FString& OutIndex, const int32& Section )
+		{
+			FString OutHLSLCode;
+			OutHLSLCode += TEXT("\t{\n");
+				OutHLSLCode += TEXT("\t\tint low = 0;\n");
+				OutHLSLCode += TEXT("\t\tint high = ") + NumberOfPointsVar + TEXT(";\n");
+				OutHLSLCode += TEXT("\t\twhile ( low < high )\n\t\t{\n");
+					OutHLSLCode += TEXT("\t\t\tint mid = ( low + high ) / 2;\n");
+					OutHLSLCode += TEXT("\t\t\tif ( ") + AliveIntervalIndexBuffer + TEXT("[ ") + FString::FromInt( Section ) + TEXT(" * ") + NumberOfPointsVar + TEXT(" + mid ] <= In_Time ) { low = mid + 1; }\n");
+					OutHLSLCode += TEXT("\t\t\telse { high = mid; }\n");
+				OutHLSLCode += TEXT("\t\t}\n");
+				OutHLSLCode += TEXT("\t\t") + OutIndex + TEXT(" = low;\n");
+			OutHLSLCode += TEXT("\t}\n");
+			return OutHLSLCode;
+		};
 
-				OutHLSL += TEXT("\t\tif ( last_id == In_LastSpawnedPointID )\n");
-				OutHLSL += TEXT("\t\t{\n");
-					// We dont have any new point to spawn
-					OutHLSL += TEXT("\t\t\tOut_MinID = last_id;\n");
-					OutHLSL += TEXT("\t\t\tOut_MaxID = last_id;\n");
-					OutHLSL += TEXT("\t\t\tOut_Count = 0;\n");
-				OutHLSL += TEXT("\t\t}\n");
-				OutHLSL += TEXT("\t\telse\n");
-				OutHLSL += TEXT("\t\t{\n");
-					// We have points to spawn at time t
-					OutHLSL += TEXT("\t\t\tOut_MinID = In_LastSpawnedPointID + 1;\n");
-					OutHLSL += TEXT("\t\t\tOut_MaxID = last_id;\n");
-					OutHLSL += TEXT("\t\t\tOut_Count = Out_MaxID - Out_MinID + 1;\n");
-
-					OutHLSL += TEXT("\t\t\tIn_LastSpawnedPointID = Out_MaxID;\n");
-					OutHLSL += TEXT("\t\t\tIn_LastSpawnTime = In_Time;\n");
-				OutHLSL += TEXT("\t\t}\n");
+		OutHLSL += TEXT("void ") + FunctionInfo.InstanceName + TEXT("(float In_Time, out int Out_MinID, out int Out_MaxID, out int Out_Count) \n{\n");
+			OutHLSL += TEXT("\tOut_MinID = 0;\n\tOut_MaxID = -1;\n\tOut_Count = 0;\n");
 
-			OutHLSL += TEXT("\t}\n");
+			// The index is empty (dummy buffer) if the point cache has no spawn times
+			OutHLSL += TEXT("\tuint houdini_index_size = 0;\n");
+			OutHLSL += TEXT("\t") + AliveIntervalIndexBuffer + TEXT(".GetDimensions( houdini_index_size );\n");
+			OutHLSL += TEXT("\tif ( ") + NumberOfPointsVar + TEXT(" <= 0 || (int)houdini_index_size < ") + NumberOfPointsVar + TEXT(" * 4 ) { return; }\n");
 
-			OutHLSL += TEXT("\tIn_LastSpawnTimeRequest = In_Time;\n");
+			// Points that have spawned at In_Time, minus the ones that are already dead
+			OutHLSL += TEXT("\tint houdini_num_spawned = 0;\n");
+			OutHLSL += UpperBoundInSection( TEXT("houdini_num_spawned"), 0 );
+			OutHLSL += TEXT("\tint houdini_num_dead = 0;\n");
+			OutHLSL += UpperBoundInSection( TEXT("houdini_num_dead"), 2 );
+			OutHLSL += TEXT("\tif ( houdini_num_spawned <= houdini_num_dead ) { return; }\n");
+			OutHLSL += TEXT("\tOut_Count = houdini_num_spawned - houdini_num_dead;\n");
 
-			// Output the sim state variables
-			OutHLSL += TEXT("\tOut_LastSpawnTimeRequest = In_LastSpawnTimeRequest;\n");
-			OutHLSL += TEXT("\tOut_LastSpawnTime = In_LastSpawnTime;\n");
-			OutHLSL += TEXT("\tIn_LastSpawnedPointID = In_LastSpawnedPointID;\n");
+			OutHLSL += UpperBoundInSection( TEXT("Out_MinID"), 3 );
+			OutHLSL += UpperBoundInSection( TEXT("Out_MaxID"), 1 );
+			OutHLSL += TEXT("\tOut_MaxID = Out_MaxID - 1;\n");
 
 		OutHLSL += TEXT("\n}\n");
 		return true;
@@ -3159,8 +5811,139 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 		// GetSampleIndexesForPointAtTime(int In_PointID, float In_Time, out int Out_PreviousSampleIndex, out int Out_NextSampleIndex, out float Out_Weight)
 		OutHLSL += TEXT("void ") + FunctionInfo.InstanceName + TEXT("(int In_PointID, float In_Time, out int Out_PreviousSampleIndex, out int Out_NextSampleIndex, out float Out_Weight) \n{\n");
 
-			OutHLSL += TEXT("\tOut_PreviousSampleIndex = 0;\n\tOut_NextSampleIndex = 0;\n\tOut_Weight = 0;\n");
-			OutHLSL += GetSampleIndexesForPointAtTime(TEXT("In_PointID"), TEXT("In_Time"), TEXT("Out_PreviousSampleIndex"), TEXT("Out_NextSampleIndex"), TEXT("Out_Weight"));
+			OutHLSL += TEXT("\tOut_PreviousSampleIndex = 0;\n\tOut_NextSampleIndex = 0;\n\tOut_Weight = 0;\n");
+			OutHLSL += GetSampleIndexesForPointAtTime(TEXT("In_PointID"), TEXT("In_Time"), TEXT("Out_PreviousSampleIndex"), TEXT("Out_NextSampleIndex"), TEXT("Out_Weight"));
+
+		OutHLSL += TEXT("\n}\n");
+		return true;
+	}
+	else if (FunctionInfo.DefinitionName == GetSampleIndexesForPointAtTimeWithCursorName)
+	{
+		// GetSampleIndexesForPointAtTimeWithCursor(int In_PointID, float In_Time, int In_SampleCursor, out int Out_PreviousSampleIndex, out int Out_NextSampleIndex, out float Out_Weight, out int Out_SampleCursor)
+		OutHLSL += TEXT("void ") + FunctionInfo.InstanceName + TEXT("(int In_PointID, float In_Time, int In_SampleCursor, out int Out_PreviousSampleIndex, out int Out_NextSampleIndex, out float Out_Weight, out int Out_SampleCursor) \n{\n");
+
+			OutHLSL += TEXT("\tOut_PreviousSampleIndex = 0;\n\tOut_NextSampleIndex = 0;\n\tOut_Weight = 0;\n");
+			OutHLSL += GetSampleIndexesForPointAtTimeWithCursor(TEXT("In_PointID"), TEXT("In_Time"), TEXT("In_SampleCursor"), TEXT("Out_PreviousSampleIndex"), TEXT("Out_NextSampleIndex"), TEXT("Out_Weight"), TEXT("Out_SampleCursor"));
+
+		OutHLSL += TEXT("\n}\n");
+		return true;
+	}
+	else if (FunctionInfo.DefinitionName == GetPointPositionAtTimeWithCursorName)
+	{
+		// GetPointPositionAtTimeWithCursor(int In_PointID, float In_Time, int In_SampleCursor, out float3 Out_Value, out int Out_SampleCursor)
+		OutHLSL += TEXT("void ") + FunctionInfo.InstanceName + TEXT("(int In_PointID, float In_Time, int In_SampleCursor, out float3 Out_Value, out int Out_SampleCursor) \n{\n");
+
+			OutHLSL += TEXT("\tint pos_attr_index = ") + GetSpecAttributeIndex(EHoudiniAttributes::POSITION) + TEXT(";\n");
+			OutHLSL += TEXT("\tint prev_index = 0;int next_index = 0;float weight = 0.0f;\n");
+			OutHLSL += GetSampleIndexesForPointAtTimeWithCursor(TEXT("In_PointID"), TEXT("In_Time"), TEXT("In_SampleCursor"), TEXT("prev_index"), TEXT("next_index"), TEXT("weight"), TEXT("Out_SampleCursor"));
+
+			OutHLSL += TEXT("\tbool In_DoSwap = true;\n");
+			OutHLSL += TEXT("\tbool In_DoScale = true;\n");
+
+			OutHLSL += TEXT("\tfloat3 prev_vector = float3( 0.0, 0.0, 0.0 );\n");
+			OutHLSL += ReadVectorInBuffer(TEXT("prev_vector"), TEXT("prev_index"), TEXT("pos_attr_index"));
+			OutHLSL += TEXT("\tfloat3 next_vector = float3( 0.0, 0.0, 0.0 );\n");
+			OutHLSL += ReadVectorInBuffer(TEXT("next_vector"), TEXT("next_index"), TEXT("pos_attr_index"));
+
+			OutHLSL += TEXT("\tOut_Value = lerp(prev_vector, next_vector, weight);\n");
+			OutHLSL += HermiteInterpolatePosition(TEXT("Out_Value"), TEXT("prev_vector"), TEXT("next_vector"), TEXT("pos_attr_index"));
+
+		OutHLSL += TEXT("\n}\n");
+		return true;
+	}
+	else if (FunctionInfo.DefinitionName == GetPointValueAtTimeWithCursorName)
+	{
+		// GetPointValueAtTimeWithCursor(int In_PointID, int In_AttributeIndex, float In_Time, int In_SampleCursor, out float Out_Value, out int Out_SampleCursor)
+		OutHLSL += TEXT("void ") + FunctionInfo.InstanceName + TEXT("(int In_PointID, int In_AttributeIndex, float In_Time, int In_SampleCursor, out float Out_Value, out int Out_SampleCursor) \n{\n");
+
+			OutHLSL += TEXT("\tint prev_index = -1;int next_index = -1;float weight = 1.0f;\n");
+			OutHLSL += GetSampleIndexesForPointAtTimeWithCursor(TEXT("In_PointID"), TEXT("In_Time"), TEXT("In_SampleCursor"), TEXT("prev_index"), TEXT("next_index"), TEXT("weight"), TEXT("Out_SampleCursor"));
+
+			OutHLSL += TEXT("\tfloat prev_value;\n");
+			OutHLSL += ReadFloatInBuffer(TEXT("prev_value"), TEXT("prev_index"), TEXT("In_AttributeIndex"));
+			OutHLSL += TEXT("\tfloat next_value;\n");
+			OutHLSL += ReadFloatInBuffer(TEXT("next_value"), TEXT("next_index"), TEXT("In_AttributeIndex"));
+
+			OutHLSL += TEXT("\tOut_Value = lerp(prev_value, next_value, weight);\n");
+
+		OutHLSL += TEXT("\n}\n");
+		return true;
+	}
+	else if (FunctionInfo.DefinitionName == GetPointVectorValueAtTimeWithCursorName)
+	{
+		// GetPointVectorValueAtTimeWithCursor(int In_PointID, int In_AttributeIndex, float In_Time, int In_SampleCursor, out float3 Out_Value, out int Out_SampleCursor)
+		OutHLSL += TEXT("void ") + FunctionInfo.InstanceName + TEXT("(int In_PointID, int In_AttributeIndex, float In_Time, int In_SampleCursor, out float3 Out_Value, out int Out_SampleCursor) \n{\n");
+
+			OutHLSL += TEXT("\tint prev_index = -1;int next_index = -1;float weight = 1.0f;\n");
+			OutHLSL += GetSampleIndexesForPointAtTimeWithCursor(TEXT("In_PointID"), TEXT("In_Time"), TEXT("In_SampleCursor"), TEXT("prev_index"), TEXT("next_index"), TEXT("weight"), TEXT("Out_SampleCursor"));
+
+			OutHLSL += TEXT("\tbool In_DoSwap = true;\n");
+			OutHLSL += TEXT("\tbool In_DoScale = true;\n");
+
+			OutHLSL += TEXT("\tfloat3 prev_vector;\n");
+			OutHLSL += ReadVectorInBuffer(TEXT("prev_vector"), TEXT("prev_index"), TEXT("In_AttributeIndex"));
+			OutHLSL += TEXT("\tfloat3 next_vector;\n");
+			OutHLSL += ReadVectorInBuffer(TEXT("next_vector"), TEXT("next_index"), TEXT("In_AttributeIndex"));
+
+			OutHLSL += TEXT("\tOut_Value = lerp(prev_vector, next_vector, weight);\n");
+			OutHLSL += HermiteInterpolatePosition(TEXT("Out_Value"), TEXT("prev_vector"), TEXT("next_vector"), TEXT("In_AttributeIndex"));
+
+		OutHLSL += TEXT("\n}\n");
+		return true;
+	}
+	else if (FunctionInfo.DefinitionName == GetPointVectorValueAtTimeExWithCursorName)
+	{
+		// GetPointVectorValueAtTimeExWithCursor(int In_PointID, int In_AttributeIndex, float In_Time, bool In_DoSwap, bool In_DoScale, int In_SampleCursor, out float3 Out_Value, out int Out_SampleCursor)
+		OutHLSL += TEXT("void ") + FunctionInfo.InstanceName + TEXT("(int In_PointID, int In_AttributeIndex, float In_Time, bool In_DoSwap, bool In_DoScale, int In_SampleCursor, out float3 Out_Value, out int Out_SampleCursor) \n{\n");
+
+			OutHLSL += TEXT("\tint prev_index = -1;int next_index = -1;float weight = 1.0f;\n");
+			OutHLSL += GetSampleIndexesForPointAtTimeWithCursor(TEXT("In_PointID"), TEXT("In_Time"), TEXT("In_SampleCursor"), TEXT("prev_index"), TEXT("next_index"), TEXT("weight"), TEXT("Out_SampleCursor"));
+
+			OutHLSL += TEXT("\tfloat3 prev_vector;\n");
+			OutHLSL += ReadVectorInBuffer(TEXT("prev_vector"), TEXT("prev_index"), TEXT("In_AttributeIndex"));
+			OutHLSL += TEXT("\tfloat3 next_vector;\n");
+			OutHLSL += ReadVectorInBuffer(TEXT("next_vector"), TEXT("next_index"), TEXT("In_AttributeIndex"));
+
+			OutHLSL += TEXT("\tOut_Value = lerp(prev_vector, next_vector, weight);\n");
+			OutHLSL += HermiteInterpolatePosition(TEXT("Out_Value"), TEXT("prev_vector"), TEXT("next_vector"), TEXT("In_AttributeIndex"));
+
+		OutHLSL += TEXT("\n}\n");
+		return true;
+	}
+	else if (FunctionInfo.DefinitionName == GetPointVector4ValueAtTimeWithCursorName)
+	{
+		// GetPointVector4ValueAtTimeWithCursor(int In_PointID, int In_AttributeIndex, float In_Time, int In_SampleCursor, out float4 Out_Value, out int Out_SampleCursor)
+		OutHLSL += TEXT("void ") + FunctionInfo.InstanceName + TEXT("(int In_PointID, int In_AttributeIndex, float In_Time, int In_SampleCursor, out float4 Out_Value, out int Out_SampleCursor) \n{\n");
+
+			OutHLSL += TEXT("\tint prev_index = -1;int next_index = -1;float weight = 1.0f;\n");
+			OutHLSL += GetSampleIndexesForPointAtTimeWithCursor(TEXT("In_PointID"), TEXT("In_Time"), TEXT("In_SampleCursor"), TEXT("prev_index"), TEXT("next_index"), TEXT("weight"), TEXT("Out_SampleCursor"));
+
+			OutHLSL += TEXT("\tbool In_DoHoudiniToUnrealConversion = false;\n");
+
+			OutHLSL += TEXT("\tfloat4 prev_vector;\n");
+			OutHLSL += ReadVector4InBuffer(TEXT("prev_vector"), TEXT("prev_index"), TEXT("In_AttributeIndex"));
+			OutHLSL += TEXT("\tfloat4 next_vector;\n");
+			OutHLSL += ReadVector4InBuffer(TEXT("next_vector"), TEXT("next_index"), TEXT("In_AttributeIndex"));
+
+			OutHLSL += TEXT("\tOut_Value = lerp(prev_vector, next_vector, weight);\n");
+
+		OutHLSL += TEXT("\n}\n");
+		return true;
+	}
+	else if (FunctionInfo.DefinitionName == GetPointQuatValueAtTimeWithCursorName)
+	{
+		// GetPointQuatValueAtTimeWithCursor(int In_PointID, int In_AttributeIndex, float In_Time, bool In_DoHoudiniToUnrealConversion, int In_SampleCursor, out float4 Out_Value, out int Out_SampleCursor)
+		OutHLSL += TEXT("void ") + FunctionInfo.InstanceName + TEXT("(int In_PointID, int In_AttributeIndex, float In_Time, bool In_DoHoudiniToUnrealConversion, int In_SampleCursor, out float4 Out_Value, out int Out_SampleCursor) \n{\n");
+
+			OutHLSL += TEXT("\tint prev_index = -1;int next_index = -1;float weight = 1.0f;\n");
+			OutHLSL += GetSampleIndexesForPointAtTimeWithCursor(TEXT("In_PointID"), TEXT("In_Time"), TEXT("In_SampleCursor"), TEXT("prev_index"), TEXT("next_index"), TEXT("weight"), TEXT("Out_SampleCursor"));
+
+			OutHLSL += TEXT("\tfloat4 prev_quat;\n");
+			OutHLSL += ReadVector4InBuffer(TEXT("prev_quat"), TEXT("prev_index"), TEXT("In_AttributeIndex"));
+			OutHLSL += TEXT("\tfloat4 next_quat;\n");
+			OutHLSL += ReadVector4InBuffer(TEXT("next_quat"), TEXT("next_index"), TEXT("In_AttributeIndex"));
+
+			OutHLSL += TEXT("\tOut_Value = q_slerp(prev_quat, next_quat, weight);\n");
 
 		OutHLSL += TEXT("\n}\n");
 		return true;
@@ -3183,6 +5966,7 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 			OutHLSL += ReadVectorInBuffer(TEXT("next_vector"), TEXT("next_index"), TEXT("pos_attr_index"));
 
 			OutHLSL += TEXT("\tOut_Value = lerp(prev_vector, next_vector, weight);\n");
+			OutHLSL += HermiteInterpolatePosition(TEXT("Out_Value"), TEXT("prev_vector"), TEXT("next_vector"), TEXT("pos_attr_index"));
 
 		OutHLSL += TEXT("\n}\n");
 		return true;
@@ -3205,6 +5989,20 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 		OutHLSL += TEXT("\n}\n");
 		return true;
 	}
+	else if (FunctionInfo.DefinitionName == GetPointIntValueAtTimeName)
+	{
+		// GetPointIntValueAtTime(int In_PointID, int In_AttributeIndex, float In_Time, out int Out_Value)
+		OutHLSL += TEXT("void ") + FunctionInfo.InstanceName + TEXT("(int In_PointID, int In_AttributeIndex, float In_Time, out int Out_Value) \n{\n");
+
+		OutHLSL += TEXT("\tint prev_index = -1;int next_index = -1;float weight = 1.0f;\n");
+		OutHLSL += GetSampleIndexesForPointAtTime(TEXT("In_PointID"), TEXT("In_Time"), TEXT("prev_index"), TEXT("next_index"), TEXT("weight"));
+
+		OutHLSL += TEXT("\tOut_Value = 0;\n");
+		OutHLSL += ReadIntInBuffer(TEXT("Out_Value"), TEXT("prev_index"), TEXT("In_AttributeIndex"));
+
+		OutHLSL += TEXT("\n}\n");
+		return true;
+	}
 	else if (FunctionInfo.DefinitionName == GetPointVectorValueAtTimeName)
 	{
 		// GetPointVectorValueAtTime(int In_PointID, int In_AttributeIndex, float In_Time, out float3 Out_Value)
@@ -3222,6 +6020,7 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 		OutHLSL += ReadVectorInBuffer(TEXT("next_vector"), TEXT("next_index"), TEXT("In_AttributeIndex"));
 
 		OutHLSL += TEXT("\tOut_Value = lerp(prev_vector, next_vector, weight);\n");
+		OutHLSL += HermiteInterpolatePosition(TEXT("Out_Value"), TEXT("prev_vector"), TEXT("next_vector"), TEXT("In_AttributeIndex"));
 
 		OutHLSL += TEXT("\n}\n");
 		return true;
@@ -3240,6 +6039,7 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 			OutHLSL += ReadVectorInBuffer(TEXT("next_vector"), TEXT("next_index"), TEXT("In_AttributeIndex"));
 
 			OutHLSL += TEXT("\tOut_Value = lerp(prev_vector, next_vector, weight);\n");
+			OutHLSL += HermiteInterpolatePosition(TEXT("Out_Value"), TEXT("prev_vector"), TEXT("next_vector"), TEXT("In_AttributeIndex"));
 
 		OutHLSL += TEXT("\n}\n");
 
@@ -3290,7 +6090,7 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 
 			OutHLSL += TEXT("\tif ( ( In_PointID < 0 ) || ( In_PointID >= ") + NumberOfPointsVar + TEXT(") )\n");
 				OutHLSL += TEXT("\t\t{Out_Value = -1.0f; return;}\n");
-			OutHLSL += TEXT("\tOut_Value = ") + LifeValuesBuffer + TEXT("[ In_PointID ];\n");
+			OutHLSL += TEXT("\tOut_Value = ") + PointRecordsBuffer + TEXT("[ In_PointID ].y;\n");
 
 		OutHLSL += TEXT("\n}\n");
 		return true;
@@ -3302,13 +6102,15 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 
 			OutHLSL += TEXT("\tif ( ( In_PointID < 0 ) || ( In_PointID >= ") + NumberOfPointsVar+ TEXT(") )\n");
 				OutHLSL += TEXT("\t\t{Out_Value = -1; return;}\n");
-			OutHLSL += TEXT("\telse if ( In_Time < ") + SpawnTimeBuffer + TEXT("[ In_PointID ] )\n");
+			// Spawn time and life in one load: ( spawn time, life, type, death time )
+			OutHLSL += TEXT("\tfloat4 point_record = ") + PointRecordsBuffer + TEXT("[ In_PointID ];\n");
+			OutHLSL += TEXT("\tif ( In_Time < point_record.x )\n");
 			OutHLSL += TEXT("\t{\n");
-				OutHLSL += TEXT("\t\tOut_Value = ") + LifeValuesBuffer + TEXT("[ In_PointID ];\n");
+				OutHLSL += TEXT("\t\tOut_Value = point_record.y;\n");
 			OutHLSL += TEXT("\t}\n");
 			OutHLSL += TEXT("\telse\n");
 			OutHLSL += TEXT("\t{\n");
-				OutHLSL += TEXT("\t\tOut_Value = ") + LifeValuesBuffer + TEXT("[ In_PointID ] - ( In_Time - ") + SpawnTimeBuffer + TEXT("[ In_PointID ] );\n");
+				OutHLSL += TEXT("\t\tOut_Value = point_record.y - ( In_Time - point_record.x );\n");
 			OutHLSL += TEXT("\t}\n");
 
 		OutHLSL += TEXT("\n}\n");
@@ -3321,7 +6123,7 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 
 			OutHLSL += TEXT("\tif ( ( In_PointID < 0 ) || ( In_PointID >= ") + NumberOfPointsVar+ TEXT(") )\n");
 				OutHLSL += TEXT("\t\t{Out_Value = -1; return;}\n");
-			OutHLSL += TEXT("\tOut_Value = ") + PointTypesBuffer + TEXT("[ In_PointID ];\n");
+			OutHLSL += TEXT("\tOut_Value = (int)( ") + PointRecordsBuffer + TEXT("[ In_PointID ].z );\n");
 
 		OutHLSL += TEXT("\n}\n");
 		return true;
@@ -3416,6 +6218,148 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 		OutHLSL += TEXT("\n}\n");
 		return true;
 	}
+	else if (FunctionInfo.DefinitionName == GetPointNormalAtTimeWithCursorName)
+	{
+		// GetPointNormalAtTimeWithCursor(int In_PointID, float In_Time, int In_SampleCursor, out float3 Out_Normal, out int Out_SampleCursor)
+		OutHLSL += TEXT("void ") + FunctionInfo.InstanceName + TEXT("(int In_PointID, float In_Time, int In_SampleCursor, out float3 Out_Normal, out int Out_SampleCursor) \n{\n");
+
+			OutHLSL += TEXT("\tint In_AttributeIndex = ") + GetSpecAttributeIndex(EHoudiniAttributes::NORMAL) + TEXT(";\n");
+
+			OutHLSL += TEXT("\tint prev_index = -1;int next_index = -1;float weight = 1.0f;\n");
+			OutHLSL += GetSampleIndexesForPointAtTimeWithCursor(TEXT("In_PointID"), TEXT("In_Time"), TEXT("In_SampleCursor"), TEXT("prev_index"), TEXT("next_index"), TEXT("weight"), TEXT("Out_SampleCursor"));
+
+			OutHLSL += TEXT("\tbool In_DoSwap = true;\n");
+			OutHLSL += TEXT("\tbool In_DoScale = false;\n");
+
+			OutHLSL += TEXT("\tfloat3 prev_vector;\n");
+			OutHLSL += ReadVectorInBuffer(TEXT("prev_vector"), TEXT("prev_index"), TEXT("In_AttributeIndex"));
+			OutHLSL += TEXT("\tfloat3 next_vector;\n");
+			OutHLSL += ReadVectorInBuffer(TEXT("next_vector"), TEXT("next_index"), TEXT("In_AttributeIndex"));
+
+			OutHLSL += TEXT("\tOut_Normal = lerp(prev_vector, next_vector, weight);\n");
+
+		OutHLSL += TEXT("\n}\n");
+		return true;
+	}
+	else if (FunctionInfo.DefinitionName == GetPointColorAtTimeWithCursorName)
+	{
+		// GetPointColorAtTimeWithCursor(int In_PointID, float In_Time, int In_SampleCursor, out float3 Out_Color, out int Out_SampleCursor)
+		OutHLSL += TEXT("void ") + FunctionInfo.InstanceName + TEXT("(int In_PointID, float In_Time, int In_SampleCursor, out float3 Out_Color, out int Out_SampleCursor) \n{\n");
+
+			OutHLSL += TEXT("\tint In_AttributeIndex = ") + GetSpecAttributeIndex(EHoudiniAttributes::COLOR) + TEXT(";\n");
+
+			OutHLSL += TEXT("\tint prev_index = -1;int next_index = -1;float weight = 1.0f;\n");
+			OutHLSL += GetSampleIndexesForPointAtTimeWithCursor(TEXT("In_PointID"), TEXT("In_Time"), TEXT("In_SampleCursor"), TEXT("prev_index"), TEXT("next_index"), TEXT("weight"), TEXT("Out_SampleCursor"));
+
+			OutHLSL += TEXT("\tbool In_DoSwap = true;\n");
+			OutHLSL += TEXT("\tbool In_DoScale = false;\n");
+
+			OutHLSL += TEXT("\tfloat3 prev_vector;\n");
+			OutHLSL += ReadVectorInBuffer(TEXT("prev_vector"), TEXT("prev_index"), TEXT("In_AttributeIndex"));
+			OutHLSL += TEXT("\tfloat3 next_vector;\n");
+			OutHLSL += ReadVectorInBuffer(TEXT("next_vector"), TEXT("next_index"), TEXT("In_AttributeIndex"));
+
+			OutHLSL += TEXT("\tOut_Color = lerp(prev_vector, next_vector, weight);\n");
+
+		OutHLSL += TEXT("\n}\n");
+		return true;
+	}
+	else if (FunctionInfo.DefinitionName == GetPointAlphaAtTimeWithCursorName)
+	{
+		// GetPointAlphaAtTimeWithCursor(int In_PointID, float In_Time, int In_SampleCursor, out float Out_Alpha, out int Out_SampleCursor)
+		OutHLSL += TEXT("void ") + FunctionInfo.InstanceName + TEXT("(int In_PointID, float In_Time, int In_SampleCursor, out float Out_Alpha, out int Out_SampleCursor) \n{\n");
+
+			OutHLSL += TEXT("\tint In_AttributeIndex = ") + GetSpecAttributeIndex(EHoudiniAttributes::ALPHA) + TEXT(";\n");
+
+			OutHLSL += TEXT("\tint prev_index = -1;int next_index = -1;float weight = 1.0f;\n");
+			OutHLSL += GetSampleIndexesForPointAtTimeWithCursor(TEXT("In_PointID"), TEXT("In_Time"), TEXT("In_SampleCursor"), TEXT("prev_index"), TEXT("next_index"), TEXT("weight"), TEXT("Out_SampleCursor"));
+
+			OutHLSL += TEXT("\tfloat prev_value;\n");
+			OutHLSL += ReadFloatInBuffer(TEXT("prev_value"), TEXT("prev_index"), TEXT("In_AttributeIndex"));
+			OutHLSL += TEXT("\tfloat next_value;\n");
+			OutHLSL += ReadFloatInBuffer(TEXT("next_value"), TEXT("next_index"), TEXT("In_AttributeIndex"));
+
+			OutHLSL += TEXT("\tOut_Alpha = lerp(prev_value, next_value, weight);\n");
+
+		OutHLSL += TEXT("\n}\n");
+		return true;
+	}
+	else if (FunctionInfo.DefinitionName == GetPointVelocityAtTimeWithCursorName)
+	{
+		// GetPointVelocityAtTimeWithCursor(int In_PointID, float In_Time, int In_SampleCursor, out float3 Out_Velocity, out int Out_SampleCursor)
+		OutHLSL += TEXT("void ") + FunctionInfo.InstanceName + TEXT("(int In_PointID, float In_Time, int In_SampleCursor, out float3 Out_Velocity, out int Out_SampleCursor) \n{\n");
+
+			OutHLSL += TEXT("\tint In_AttributeIndex = ") + GetSpecAttributeIndex(EHoudiniAttributes::VELOCITY) + TEXT(";\n");
+
+			OutHLSL += TEXT("\tint prev_index = -1;int next_index = -1;float weight = 1.0f;\n");
+			OutHLSL += GetSampleIndexesForPointAtTimeWithCursor(TEXT("In_PointID"), TEXT("In_Time"), TEXT("In_SampleCursor"), TEXT("prev_index"), TEXT("next_index"), TEXT("weight"), TEXT("Out_SampleCursor"));
+
+			OutHLSL += TEXT("\tbool In_DoSwap = true;\n");
+			OutHLSL += TEXT("\tbool In_DoScale = true;\n");
+
+			OutHLSL += TEXT("\tfloat3 prev_vector;\n");
+			OutHLSL += ReadVectorInBuffer(TEXT("prev_vector"), TEXT("prev_index"), TEXT("In_AttributeIndex"));
+			OutHLSL += TEXT("\tfloat3 next_vector;\n");
+			OutHLSL += ReadVectorInBuffer(TEXT("next_vector"), TEXT("next_index"), TEXT("In_AttributeIndex"));
+
+			OutHLSL += TEXT("\tOut_Velocity = lerp(prev_vector, next_vector, weight);\n");
+
+		OutHLSL += TEXT("\n}\n");
+		return true;
+	}
+	else if (FunctionInfo.DefinitionName == GetPointAttributesAtTimeName)
+	{
+		// GetPointAttributesAtTime(int In_PointID, float In_Time, out float3 Out_Position, out float3 Out_Velocity, out float3 Out_Normal, out float3 Out_Color, out float Out_Alpha)
+		OutHLSL += TEXT("void ") + FunctionInfo.InstanceName + TEXT("(int In_PointID, float In_Time, out float3 Out_Position, out float3 Out_Velocity, out float3 Out_Normal, out float3 Out_Color, out float Out_Alpha) \n{\n");
+
+			OutHLSL += TEXT("\tOut_Position = float3( 0.0, 0.0, 0.0 );\n\tOut_Velocity = float3( 0.0, 0.0, 0.0 );\n\tOut_Normal = float3( 0.0, 0.0, 0.0 );\n\tOut_Color = float3( 0.0, 0.0, 0.0 );\n\tOut_Alpha = 0.0f;\n");
+
+			// Search the point's samples once, and only emit the reads for the requested attributes
+			OutHLSL += TEXT("\tint prev_index = -1;int next_index = -1;float weight = 1.0f;\n");
+			OutHLSL += GetSampleIndexesForPointAtTime(TEXT("In_PointID"), TEXT("In_Time"), TEXT("prev_index"), TEXT("next_index"), TEXT("weight"));
+
+			const int32 AttributeMask = GetPointAttributesMaskFromSpecifier(FunctionInfo.FindSpecifierValue(FName("Attributes")));
+			auto LerpVectorAttribute = [&](const FString& Out_Value, const EHoudiniAttributes& Attr, const bool& DoSwap, const bool& DoScale)
+			{
+				FString OutHLSLCode;
+				OutHLSLCode += TEXT("\t{\n");
+				OutHLSLCode += TEXT("\tint In_AttributeIndex = ") + GetSpecAttributeIndex(Attr) + TEXT(";\n");
+				OutHLSLCode += TEXT("\tbool In_DoSwap = ") + FString(DoSwap ? TEXT("true") : TEXT("false")) + TEXT(";\n");
+				OutHLSLCode += TEXT("\tbool In_DoScale = ") + FString(DoScale ? TEXT("true") : TEXT("false")) + TEXT(";\n");
+				OutHLSLCode += TEXT("\tfloat3 prev_vector;\n");
+				OutHLSLCode += ReadVectorInBuffer(TEXT("prev_vector"), TEXT("prev_index"), TEXT("In_AttributeIndex"));
+				OutHLSLCode += TEXT("\tfloat3 next_vector;\n");
+				OutHLSLCode += ReadVectorInBuffer(TEXT("next_vector"), TEXT("next_index"), TEXT("In_AttributeIndex"));
+				OutHLSLCode += TEXT("\tif ( In_AttributeIndex >= 0 ) { ") + Out_Value + TEXT(" = lerp(prev_vector, next_vector, weight); }\n");
+				if ( Attr == EHoudiniAttributes::POSITION )
+					OutHLSLCode += HermiteInterpolatePosition(Out_Value, TEXT("prev_vector"), TEXT("next_vector"), TEXT("In_AttributeIndex"));
+				OutHLSLCode += TEXT("\t}\n");
+				return OutHLSLCode;
+			};
+
+			if ( AttributeMask & HOUDINI_POINT_ATTR_POSITION )
+				OutHLSL += LerpVectorAttribute(TEXT("Out_Position"), EHoudiniAttributes::POSITION, true, true);
+			if ( AttributeMask & HOUDINI_POINT_ATTR_VELOCITY )
+				OutHLSL += LerpVectorAttribute(TEXT("Out_Velocity"), EHoudiniAttributes::VELOCITY, true, true);
+			if ( AttributeMask & HOUDINI_POINT_ATTR_NORMAL )
+				OutHLSL += LerpVectorAttribute(TEXT("Out_Normal"), EHoudiniAttributes::NORMAL, true, false);
+			if ( AttributeMask & HOUDINI_POINT_ATTR_COLOR )
+				OutHLSL += LerpVectorAttribute(TEXT("Out_Color"), EHoudiniAttributes::COLOR, false, false);
+			if ( AttributeMask & HOUDINI_POINT_ATTR_ALPHA )
+			{
+				OutHLSL += TEXT("\t{\n");
+				OutHLSL += TEXT("\tint In_AttributeIndex = ") + GetSpecAttributeIndex(EHoudiniAttributes::ALPHA) + TEXT(";\n");
+				OutHLSL += TEXT("\tfloat prev_value;\n");
+				OutHLSL += ReadFloatInBuffer(TEXT("prev_value"), TEXT("prev_index"), TEXT("In_AttributeIndex"));
+				OutHLSL += TEXT("\tfloat next_value;\n");
+				OutHLSL += ReadFloatInBuffer(TEXT("next_value"), TEXT("next_index"), TEXT("In_AttributeIndex"));
+				OutHLSL += TEXT("\tif ( In_AttributeIndex >= 0 ) { Out_Alpha = lerp(prev_value, next_value, weight); }\n");
+				OutHLSL += TEXT("\t}\n");
+			}
+
+		OutHLSL += TEXT("\n}\n");
+		return true;
+	}
 	else if (FunctionInfo.DefinitionName == GetPointImpulseAtTimeName)
 	{
 		// GetPointImpulseAtTime(int In_PointID, float In_Time, out float Out_Impulse)
@@ -3446,10 +6390,8 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 			OutHLSL += TEXT("\tint prev_index = -1;int next_index = -1;float weight = 1.0f;\n");
 			OutHLSL += GetSampleIndexesForPointAtTime(TEXT("In_PointID"), TEXT("In_Time"), TEXT("prev_index"), TEXT("next_index"), TEXT("weight"));
 
-			OutHLSL += TEXT("\tfloat3 prev_value;\n");
-			OutHLSL += ReadFloatInBuffer(TEXT("prev_value"), TEXT("prev_index"), TEXT("In_AttributeIndex"));
-
-			OutHLSL += TEXT("\tOut_Type = floor(prev_value);\n");
+			OutHLSL += TEXT("\tOut_Type = 0;\n");
+			OutHLSL += ReadIntInBuffer(TEXT("Out_Type"), TEXT("prev_index"), TEXT("In_AttributeIndex"));
 
 		OutHLSL += TEXT("\n}\n");
 		return true;
@@ -3545,10 +6487,15 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 			 FunctionInfo.DefinitionName == GetPointVectorValueAtTimeByStringName ||
 			 FunctionInfo.DefinitionName == GetPointVectorValueAtTimeExByStringName ||
 			 FunctionInfo.DefinitionName == GetPointVector4ValueAtTimeByStringName ||
-			 FunctionInfo.DefinitionName == GetPointQuatValueAtTimeByStringName)
+			 FunctionInfo.DefinitionName == GetPointQuatValueAtTimeByStringName ||
+			 FunctionInfo.DefinitionName == GetPointValueAtTimeWithCursorByStringName ||
+			 FunctionInfo.DefinitionName == GetPointVectorValueAtTimeWithCursorByStringName ||
+			 FunctionInfo.DefinitionName == GetPointVectorValueAtTimeExWithCursorByStringName ||
+			 FunctionInfo.DefinitionName == GetPointVector4ValueAtTimeWithCursorByStringName ||
+			 FunctionInfo.DefinitionName == GetPointQuatValueAtTimeWithCursorByStringName)
 	{
 		static const TCHAR *FunctionBodyTemplate = TEXT(
-			"void {FunctionName}(int In_PointID, float In_Time, {AdditionalFunctionArguments}out {AttributeType} Out_Value)\n"
+			"void {FunctionName}(int In_PointID, float In_Time, {AdditionalFunctionArguments}{SampleCursorArgument}out {AttributeType} Out_Value{SampleCursorOutput})\n"
 			"{\n"
 			"	int AttributeIndex = {FunctionIndexToAttributeIndexVarName}[{AttributeFunctionIndex}];\n"
 			"	int prev_index = -1;\n"
@@ -3563,6 +6510,7 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 			"	{ReadNextFromBufferSnippet}\n"
 
 			"	Out_Value = {LerpFunctionName}(prev_value, next_value, weight);\n"
+			"	{InterpolateSnippet}\n"
 			"}\n\n"
 		);
 
@@ -3574,27 +6522,37 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 			return false;
 		}
 
+		// The cursor variants take the sample cursor after the other inputs, and return the updated cursor after the value
+		const bool bWithCursor = FunctionInfo.DefinitionName == GetPointValueAtTimeWithCursorByStringName ||
+			FunctionInfo.DefinitionName == GetPointVectorValueAtTimeWithCursorByStringName ||
+			FunctionInfo.DefinitionName == GetPointVectorValueAtTimeExWithCursorByStringName ||
+			FunctionInfo.DefinitionName == GetPointVector4ValueAtTimeWithCursorByStringName ||
+			FunctionInfo.DefinitionName == GetPointQuatValueAtTimeWithCursorByStringName;
+
 		FString AttributeTypeName;
 		FString AdditionalFunctionArguments;
-		FString GetSampleIndexesForPointAtTimeSnippet;
+		const FString SampleCursorArgument = bWithCursor ? TEXT("int In_SampleCursor, ") : TEXT("");
+		const FString SampleCursorOutput = bWithCursor ? TEXT(", out int Out_SampleCursor") : TEXT("");
+		const FString GetSampleIndexesForPointAtTimeSnippet = bWithCursor
+			? GetSampleIndexesForPointAtTimeWithCursor(TEXT("In_PointID"), TEXT("In_Time"), TEXT("In_SampleCursor"), TEXT("prev_index"), TEXT("next_index"), TEXT("weight"), TEXT("Out_SampleCursor"))
+			: GetSampleIndexesForPointAtTime(TEXT("In_PointID"), TEXT("In_Time"), TEXT("prev_index"), TEXT("next_index"), TEXT("weight"));
 		FString VectorExFunctionDefaults;
 		FString ReadPrevFromBufferSnippet;
 		FString ReadNextFromBufferSnippet;
 		FString LerpFunctionName;
-		if (FunctionInfo.DefinitionName == GetPointValueAtTimeByStringName)
+		FString InterpolateSnippet;
+		if (FunctionInfo.DefinitionName == GetPointValueAtTimeByStringName || FunctionInfo.DefinitionName == GetPointValueAtTimeWithCursorByStringName)
 		{
 			AttributeTypeName = "float";
-			GetSampleIndexesForPointAtTimeSnippet = GetSampleIndexesForPointAtTime(TEXT("In_PointID"), TEXT("In_Time"), TEXT("prev_index"), TEXT("next_index"), TEXT("weight"));
 			AdditionalFunctionArguments = "";
 			VectorExFunctionDefaults = "";
 			ReadPrevFromBufferSnippet = ReadFloatInBuffer(TEXT("prev_value"), TEXT("prev_index"), TEXT("AttributeIndex"));
 			ReadNextFromBufferSnippet = ReadFloatInBuffer(TEXT("next_value"), TEXT("next_index"), TEXT("AttributeIndex"));
 			LerpFunctionName = "lerp";
 		}
-		else if (FunctionInfo.DefinitionName == GetPointVectorValueAtTimeByStringName)
+		else if (FunctionInfo.DefinitionName == GetPointVectorValueAtTimeByStringName || FunctionInfo.DefinitionName == GetPointVectorValueAtTimeWithCursorByStringName)
 		{
 			AttributeTypeName = "float3";
-			GetSampleIndexesForPointAtTimeSnippet = GetSampleIndexesForPointAtTime(TEXT("In_PointID"), TEXT("In_Time"), TEXT("prev_index"), TEXT("next_index"), TEXT("weight"));
 			AdditionalFunctionArguments = "";
 			VectorExFunctionDefaults = TEXT(
 				"	bool In_DoSwap = true;\n"
@@ -3603,21 +6561,21 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 			ReadPrevFromBufferSnippet = ReadVectorInBuffer(TEXT("prev_value"), TEXT("prev_index"), TEXT("AttributeIndex"));
 			ReadNextFromBufferSnippet = ReadVectorInBuffer(TEXT("next_value"), TEXT("next_index"), TEXT("AttributeIndex"));
 			LerpFunctionName = "lerp";
+			InterpolateSnippet = HermiteInterpolatePosition(TEXT("Out_Value"), TEXT("prev_value"), TEXT("next_value"), TEXT("AttributeIndex"));
 		}
-		else if (FunctionInfo.DefinitionName == GetPointVectorValueAtTimeExByStringName)
+		else if (FunctionInfo.DefinitionName == GetPointVectorValueAtTimeExByStringName || FunctionInfo.DefinitionName == GetPointVectorValueAtTimeExWithCursorByStringName)
 		{
 			AttributeTypeName = "float3";
-			GetSampleIndexesForPointAtTimeSnippet = GetSampleIndexesForPointAtTime(TEXT("In_PointID"), TEXT("In_Time"), TEXT("prev_index"), TEXT("next_index"), TEXT("weight"));
 			AdditionalFunctionArguments = TEXT("bool In_DoSwap, bool In_DoScale, ");
 			VectorExFunctionDefaults = "";
 			ReadPrevFromBufferSnippet = ReadVectorInBuffer(TEXT("prev_value"), TEXT("prev_index"), TEXT("AttributeIndex"));
 			ReadNextFromBufferSnippet = ReadVectorInBuffer(TEXT("next_value"), TEXT("next_index"), TEXT("AttributeIndex"));
 			LerpFunctionName = "lerp";
+			InterpolateSnippet = HermiteInterpolatePosition(TEXT("Out_Value"), TEXT("prev_value"), TEXT("next_value"), TEXT("AttributeIndex"));
 		}
-		else if (FunctionInfo.DefinitionName == GetPointVector4ValueAtTimeByStringName)
+		else if (FunctionInfo.DefinitionName == GetPointVector4ValueAtTimeByStringName || FunctionInfo.DefinitionName == GetPointVector4ValueAtTimeWithCursorByStringName)
 		{
 			AttributeTypeName = "float4";
-			GetSampleIndexesForPointAtTimeSnippet = GetSampleIndexesForPointAtTime(TEXT("In_PointID"), TEXT("In_Time"), TEXT("prev_index"), TEXT("next_index"), TEXT("weight"));
 			AdditionalFunctionArguments = "";
 			VectorExFunctionDefaults = TEXT(
 				"	bool In_DoHoudiniToUnrealConversion = false;\n"
@@ -3626,10 +6584,9 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 			ReadNextFromBufferSnippet = ReadVector4InBuffer(TEXT("next_value"), TEXT("next_index"), TEXT("AttributeIndex"));
 			LerpFunctionName = "lerp";
 		}
-		else if (FunctionInfo.DefinitionName == GetPointQuatValueAtTimeByStringName)
+		else if (FunctionInfo.DefinitionName == GetPointQuatValueAtTimeByStringName || FunctionInfo.DefinitionName == GetPointQuatValueAtTimeWithCursorByStringName)
 		{
 			AttributeTypeName = "float4";
-			GetSampleIndexesForPointAtTimeSnippet = GetSampleIndexesForPointAtTime(TEXT("In_PointID"), TEXT("In_Time"), TEXT("prev_index"), TEXT("next_index"), TEXT("weight"));
 			AdditionalFunctionArguments = TEXT("bool In_DoHoudiniToUnrealConversion, ");
 			VectorExFunctionDefaults = "";
 			ReadPrevFromBufferSnippet = ReadVector4InBuffer(TEXT("prev_value"), TEXT("prev_index"), TEXT("AttributeIndex"));
@@ -3649,10 +6606,13 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 			{TEXT("AttributeFunctionIndex"), AttributeFunctionIndex},
 			{TEXT("GetSampleIndexesForPointAtTimeSnippet"), GetSampleIndexesForPointAtTimeSnippet},
 			{TEXT("AdditionalFunctionArguments"), AdditionalFunctionArguments},
+			{TEXT("SampleCursorArgument"), SampleCursorArgument},
+			{TEXT("SampleCursorOutput"), SampleCursorOutput},
 			{TEXT("VectorExFunctionDefaults"), VectorExFunctionDefaults},
 			{TEXT("ReadPrevFromBufferSnippet"), ReadPrevFromBufferSnippet},
 			{TEXT("ReadNextFromBufferSnippet"), ReadNextFromBufferSnippet},
 			{TEXT("LerpFunctionName"), LerpFunctionName},
+			{TEXT("InterpolateSnippet"), InterpolateSnippet},
 		};
 
 		OutHLSL += FString::Format(FunctionBodyTemplate, FunctionTemplateArgs);
@@ -3668,6 +6628,17 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 
 #if ENGINE_MAJOR_VERSION==5 && ENGINE_MINOR_VERSION < 1
 #if WITH_EDITORONLY_DATA
+bool UNiagaraDataInterfaceHoudini::AppendCompileHash(FNiagaraCompileHashVisitor* InVisitor) const
+{
+	bool bSuccess = Super::AppendCompileHash(InVisitor);
+
+	// The HLSL depends on the point cache's layout when it is baked in
+	FHoudiniPointCacheShaderLayout Layout;
+	const FString LayoutString = GetSpecializedShaderLayout(Layout) ? Layout.ToString() : FString();
+	bSuccess &= InVisitor->UpdateString(TEXT("HoudiniShaderLayout"), LayoutString);
+	return bSuccess;
+}
+
 void UNiagaraDataInterfaceHoudini::GetParameterDefinitionHLSL(const FNiagaraDataInterfaceGPUParamInfo& ParamInfo, FString& OutHLSL)
 {
 	// int NumberOfSamples_XX;
@@ -3694,20 +6665,100 @@ void UNiagaraDataInterfaceHoudini::GetParameterDefinitionHLSL(const FNiagaraData
 	BufferName = UNiagaraDataInterfaceHoudini::SpawnTimesBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
 	OutHLSL += TEXT("Buffer<float> ") + BufferName + TEXT(";\n");
 
-	// Buffer<float> LifeValuesBuffer_XX;
-	BufferName = UNiagaraDataInterfaceHoudini::LifeValuesBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	// Buffer<float4> PointRecordsBuffer_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::PointRecordsBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	OutHLSL += TEXT("Buffer<float4> ") + BufferName + TEXT(";\n");
+
+	// int MaxNumberOfIndexesPerPoint_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::MaxNumberOfIndexesPerPointBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
+
+	// Buffer<int> PointSampleIndexOffsetsBuffer_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::PointSampleIndexOffsetsBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	OutHLSL += TEXT("Buffer<int> ") + BufferName + TEXT(";\n");
+
+	// Buffer<int> PointSampleIndexesBuffer_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::PointSampleIndexesBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	OutHLSL += TEXT("Buffer<int> ") + BufferName + TEXT(";\n");
+
+	// int NumberOfFrames_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::NumberOfFramesBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
+
+	// int NumberOfPointsPerFrame_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::NumberOfPointsPerFrameBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
+
+	// float SampleTimeStep_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::SampleTimeStepBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	OutHLSL += TEXT("float ") + BufferName + TEXT(";\n");
+
+	// int PositionInterpolation_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::PositionInterpolationBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
+
+	// int SpawnTimesSorted_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::SpawnTimesSortedBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
+
+	// int NumberOfPointAttributes_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::NumberOfPointAttributesBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
+
+	// Buffer<float> PointAttributeValuesBuffer_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::PointAttributeValuesBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	OutHLSL += TEXT("Buffer<float> ") + BufferName + TEXT(";\n");
+
+	// Buffer<int> AttributeColumnIndexesBuffer_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::AttributeColumnIndexesBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	OutHLSL += TEXT("Buffer<int> ") + BufferName + TEXT(";\n");
+
+	// int NumberOfQuantizedColumns_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::NumberOfQuantizedColumnsBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
+
+	// Buffer<uint> QuantizedValuesBuffer_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::QuantizedValuesBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	OutHLSL += TEXT("Buffer<uint> ") + BufferName + TEXT(";\n");
+
+	// Buffer<float> QuantizationParamsBuffer_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::QuantizationParamsBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
 	OutHLSL += TEXT("Buffer<float> ") + BufferName + TEXT(";\n");
 
-	// Buffer<int> PointTypesBuffer_XX;
-	BufferName = UNiagaraDataInterfaceHoudini::PointTypesBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	// int NumberOfIntColumns_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::NumberOfIntColumnsBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
+
+	// Buffer<int> IntValuesBuffer_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::IntValuesBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
 	OutHLSL += TEXT("Buffer<int> ") + BufferName + TEXT(";\n");
 
-	// int MaxNumberOfIndexesPerPoint_XX;
-	BufferName = UNiagaraDataInterfaceHoudini::MaxNumberOfIndexesPerPointBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	// Buffer<int> AttributeIntColumnIndexesBuffer_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::AttributeIntColumnIndexesBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	OutHLSL += TEXT("Buffer<int> ") + BufferName + TEXT(";\n");
+
+	// Buffer<float> AliveIntervalIndexBuffer_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::AliveIntervalIndexBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	OutHLSL += TEXT("Buffer<float> ") + BufferName + TEXT(";\n");
+
+	// int NumberOfVectorColumns_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::NumberOfVectorColumnsBaseName + ParamInfo.DataInterfaceHLSLSymbol;
 	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
 
-	// Buffer<int> PointValueIndexesBuffer_XX;
-	BufferName = UNiagaraDataInterfaceHoudini::PointValueIndexesBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	// Buffer<int> VectorColumnIndexesBuffer_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::VectorColumnIndexesBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	OutHLSL += TEXT("Buffer<int> ") + BufferName + TEXT(";\n");
+
+	// Buffer<float4> VectorValuesBuffer_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::VectorValuesBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	OutHLSL += TEXT("Buffer<float4> ") + BufferName + TEXT(";\n");
+
+	// Buffer<float> FrameTimesBuffer_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::FrameTimesBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	OutHLSL += TEXT("Buffer<float> ") + BufferName + TEXT(";\n");
+
+	// Buffer<int> FrameSampleIndexOffsetsBuffer_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::FrameSampleIndexOffsetsBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
 	OutHLSL += TEXT("Buffer<int> ") + BufferName + TEXT(";\n");
 
 	// int LastSpawnedPointId_XX;
@@ -3722,6 +6773,34 @@ void UNiagaraDataInterfaceHoudini::GetParameterDefinitionHLSL(const FNiagaraData
 	BufferName = UNiagaraDataInterfaceHoudini::LastSpawnTimeRequestBaseName + ParamInfo.DataInterfaceHLSLSymbol;
 	OutHLSL += TEXT("float ") + BufferName + TEXT(";\n");
 
+	// int SpawnMinPointId_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::SpawnMinPointIdBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
+
+	// int SpawnMaxPointId_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::SpawnMaxPointIdBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
+
+	// int SpawnCount_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::SpawnCountBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
+
+	// float InstanceTime_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::InstanceTimeBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	OutHLSL += TEXT("float ") + BufferName + TEXT(";\n");
+
+	// int InstancePrevFrameIndex_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::InstancePrevFrameIndexBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
+
+	// int InstanceNextFrameIndex_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::InstanceNextFrameIndexBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
+
+	// float InstanceFramePrevWeight_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::InstanceFramePrevWeightBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	OutHLSL += TEXT("float ") + BufferName + TEXT(";\n");
+
 	// int FunctionIndexToAttributeIndexBuffer_XX[#];
 	BufferName = UNiagaraDataInterfaceHoudini::FunctionIndexToAttributeIndexBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
 	OutHLSL += TEXT("Buffer<int> ") + BufferName + TEXT(";\n\n");
@@ -3735,6 +6814,11 @@ bool UNiagaraDataInterfaceHoudini::AppendCompileHash(FNiagaraCompileHashVisitor*
 {
 	bool bSuccess = Super::AppendCompileHash(InVisitor);
 	bSuccess &= InVisitor->UpdateShaderParameters<FShaderParameters>();
+
+	// The HLSL depends on the point cache's layout when it is baked in
+	FHoudiniPointCacheShaderLayout Layout;
+	const FString LayoutString = GetSpecializedShaderLayout(Layout) ? Layout.ToString() : FString();
+	bSuccess &= InVisitor->UpdateString(TEXT("HoudiniShaderLayout"), LayoutString);
 	return bSuccess;
 }
 
@@ -3768,20 +6852,100 @@ void UNiagaraDataInterfaceHoudini::GetParameterDefinitionHLSL(const FNiagaraData
 	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::SpawnTimesBufferBaseName;
 	OutHLSL += TEXT("Buffer<float> ") + BufferName + TEXT(";\n");
 
-	// Buffer<float> LifeValuesBuffer_XX;
-	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::LifeValuesBufferBaseName;
+	// Buffer<float4> PointRecordsBuffer_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::PointRecordsBufferBaseName;
+	OutHLSL += TEXT("Buffer<float4> ") + BufferName + TEXT(";\n");
+
+	// int MaxNumberOfIndexesPerPoint_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::MaxNumberOfIndexesPerPointBaseName;
+	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
+
+	// Buffer<int> PointSampleIndexOffsetsBuffer_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::PointSampleIndexOffsetsBufferBaseName;
+	OutHLSL += TEXT("Buffer<int> ") + BufferName + TEXT(";\n");
+
+	// Buffer<int> PointSampleIndexesBuffer_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::PointSampleIndexesBufferBaseName;
+	OutHLSL += TEXT("Buffer<int> ") + BufferName + TEXT(";\n");
+
+	// int NumberOfFrames_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::NumberOfFramesBaseName;
+	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
+
+	// int NumberOfPointsPerFrame_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::NumberOfPointsPerFrameBaseName;
+	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
+
+	// float SampleTimeStep_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::SampleTimeStepBaseName;
+	OutHLSL += TEXT("float ") + BufferName + TEXT(";\n");
+
+	// int PositionInterpolation_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::PositionInterpolationBaseName;
+	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
+
+	// int SpawnTimesSorted_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::SpawnTimesSortedBaseName;
+	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
+
+	// int NumberOfPointAttributes_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::NumberOfPointAttributesBaseName;
+	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
+
+	// Buffer<float> PointAttributeValuesBuffer_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::PointAttributeValuesBufferBaseName;
 	OutHLSL += TEXT("Buffer<float> ") + BufferName + TEXT(";\n");
 
-	// Buffer<int> PointTypesBuffer_XX;
-	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::PointTypesBufferBaseName;
+	// Buffer<int> AttributeColumnIndexesBuffer_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::AttributeColumnIndexesBufferBaseName;
 	OutHLSL += TEXT("Buffer<int> ") + BufferName + TEXT(";\n");
 
-	// int MaxNumberOfIndexesPerPoint_XX;
-	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::MaxNumberOfIndexesPerPointBaseName;
+	// int NumberOfQuantizedColumns_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::NumberOfQuantizedColumnsBaseName;
+	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
+
+	// Buffer<uint> QuantizedValuesBuffer_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::QuantizedValuesBufferBaseName;
+	OutHLSL += TEXT("Buffer<uint> ") + BufferName + TEXT(";\n");
+
+	// Buffer<float> QuantizationParamsBuffer_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::QuantizationParamsBufferBaseName;
+	OutHLSL += TEXT("Buffer<float> ") + BufferName + TEXT(";\n");
+
+	// int NumberOfIntColumns_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::NumberOfIntColumnsBaseName;
+	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
+
+	// Buffer<int> IntValuesBuffer_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::IntValuesBufferBaseName;
+	OutHLSL += TEXT("Buffer<int> ") + BufferName + TEXT(";\n");
+
+	// Buffer<int> AttributeIntColumnIndexesBuffer_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::AttributeIntColumnIndexesBufferBaseName;
+	OutHLSL += TEXT("Buffer<int> ") + BufferName + TEXT(";\n");
+
+	// Buffer<float> AliveIntervalIndexBuffer_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::AliveIntervalIndexBufferBaseName;
+	OutHLSL += TEXT("Buffer<float> ") + BufferName + TEXT(";\n");
+
+	// int NumberOfVectorColumns_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::NumberOfVectorColumnsBaseName;
 	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
 
-	// Buffer<int> PointValueIndexesBuffer_XX;
-	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::PointValueIndexesBufferBaseName;
+	// Buffer<int> VectorColumnIndexesBuffer_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::VectorColumnIndexesBufferBaseName;
+	OutHLSL += TEXT("Buffer<int> ") + BufferName + TEXT(";\n");
+
+	// Buffer<float4> VectorValuesBuffer_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::VectorValuesBufferBaseName;
+	OutHLSL += TEXT("Buffer<float4> ") + BufferName + TEXT(";\n");
+
+	// Buffer<float> FrameTimesBuffer_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::FrameTimesBufferBaseName;
+	OutHLSL += TEXT("Buffer<float> ") + BufferName + TEXT(";\n");
+
+	// Buffer<int> FrameSampleIndexOffsetsBuffer_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::FrameSampleIndexOffsetsBufferBaseName;
 	OutHLSL += TEXT("Buffer<int> ") + BufferName + TEXT(";\n");
 
 	// int LastSpawnedPointId_XX;
@@ -3796,6 +6960,34 @@ void UNiagaraDataInterfaceHoudini::GetParameterDefinitionHLSL(const FNiagaraData
 	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::LastSpawnTimeRequestBaseName;
 	OutHLSL += TEXT("float ") + BufferName + TEXT(";\n");
 
+	// int SpawnMinPointId_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::SpawnMinPointIdBaseName;
+	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
+
+	// int SpawnMaxPointId_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::SpawnMaxPointIdBaseName;
+	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
+
+	// int SpawnCount_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::SpawnCountBaseName;
+	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
+
+	// float InstanceTime_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::InstanceTimeBaseName;
+	OutHLSL += TEXT("float ") + BufferName + TEXT(";\n");
+
+	// int InstancePrevFrameIndex_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::InstancePrevFrameIndexBaseName;
+	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
+
+	// int InstanceNextFrameIndex_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::InstanceNextFrameIndexBaseName;
+	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
+
+	// float InstanceFramePrevWeight_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::InstanceFramePrevWeightBaseName;
+	OutHLSL += TEXT("float ") + BufferName + TEXT(";\n");
+
 	// int FunctionIndexToAttributeIndexBuffer_XX[#];
 	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::FunctionIndexToAttributeIndexBufferBaseName;
 	OutHLSL += TEXT("Buffer<int> ") + BufferName + TEXT(";\n\n");
@@ -4002,6 +7194,15 @@ FNiagaraDataInterfaceProxyHoudini::~FNiagaraDataInterfaceProxyHoudini()
 {
 }
 
+void FNiagaraDataInterfaceProxyHoudini::ConsumePerInstanceDataFromGameThread(void* PerInstanceData, const FNiagaraSystemInstanceID& Instance)
+{
+	check( IsInRenderingThread() );
+
+	FHoudiniNiagaraInstanceData* InstanceData = static_cast<FHoudiniNiagaraInstanceData*>(PerInstanceData);
+	SystemInstancesToInstanceData.Add(Instance, *InstanceData);
+	InstanceData->~FHoudiniNiagaraInstanceData();
+}
+
 #if ENGINE_MAJOR_VERSION==5 && ENGINE_MINOR_VERSION < 1
 void FNiagaraDataInterfaceProxyHoudini::UpdateFunctionIndexToAttributeIndexBuffer(const TMemoryImageArray<FName> &FunctionIndexToAttribute, bool bForceUpdate)
 #else
@@ -4025,10 +7226,11 @@ void FNiagaraDataInterfaceProxyHoudini::UpdateFunctionIndexToAttributeIndexBuffe
 		if (Attribute != NAME_None)
 		{
 			int32 AttributeIndex = INDEX_NONE;
-			if (UHoudiniPointCache::GetAttributeIndexInArrayFromString(Attribute.ToString(), Resource->Attributes, AttributeIndex))
+			if (const int32* FoundIndex = Resource->AttributeIndexMap.Find(Attribute))
 			{
-				FunctionIndexToAttributeIndex[FunctionIndex] = AttributeIndex;
+				AttributeIndex = *FoundIndex;
 			}
+			FunctionIndexToAttributeIndex[FunctionIndex] = AttributeIndex;
 			if (AttributeIndex == INDEX_NONE)
 			{
 				UE_LOG(LogHoudiniNiagara, Warning, TEXT("Trying to access an attribute that does not exist: %s"), *Attribute.ToString());
@@ -4081,15 +7283,46 @@ public:
 		SpecialAttributeIndexesBuffer.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::SpecialAttributeIndexesBufferBaseName + ParameterInfo.DataInterfaceHLSLSymbol));		
 
 		SpawnTimesBuffer.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::SpawnTimesBufferBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
-		LifeValuesBuffer.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::LifeValuesBufferBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
-		PointTypesBuffer.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::PointTypesBufferBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+		PointRecordsBuffer.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::PointRecordsBufferBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
 
 		MaxNumberOfIndexesPerPoint.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::MaxNumberOfIndexesPerPointBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
-		PointValueIndexesBuffer.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::PointValueIndexesBufferBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+		PointSampleIndexOffsetsBuffer.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::PointSampleIndexOffsetsBufferBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+		PointSampleIndexesBuffer.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::PointSampleIndexesBufferBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+
+		NumberOfFrames.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::NumberOfFramesBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+		NumberOfPointsPerFrame.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::NumberOfPointsPerFrameBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+		SampleTimeStep.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::SampleTimeStepBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+		PositionInterpolation.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::PositionInterpolationBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+		SpawnTimesSorted.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::SpawnTimesSortedBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+
+		NumberOfPointAttributes.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::NumberOfPointAttributesBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+		PointAttributeValuesBuffer.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::PointAttributeValuesBufferBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+		AttributeColumnIndexesBuffer.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::AttributeColumnIndexesBufferBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+
+		NumberOfQuantizedColumns.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::NumberOfQuantizedColumnsBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+		QuantizedValuesBuffer.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::QuantizedValuesBufferBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+		QuantizationParamsBuffer.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::QuantizationParamsBufferBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+
+		NumberOfIntColumns.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::NumberOfIntColumnsBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+		IntValuesBuffer.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::IntValuesBufferBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+		AttributeIntColumnIndexesBuffer.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::AttributeIntColumnIndexesBufferBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+		AliveIntervalIndexBuffer.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::AliveIntervalIndexBufferBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+		NumberOfVectorColumns.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::NumberOfVectorColumnsBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+		VectorColumnIndexesBuffer.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::VectorColumnIndexesBufferBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+		VectorValuesBuffer.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::VectorValuesBufferBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+		FrameTimesBuffer.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::FrameTimesBufferBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+		FrameSampleIndexOffsetsBuffer.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::FrameSampleIndexOffsetsBufferBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
 
 		LastSpawnedPointId.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::LastSpawnedPointIdBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
 		LastSpawnTime.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::LastSpawnTimeBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
 		LastSpawnTimeRequest.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::LastSpawnTimeRequestBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+		SpawnMinPointId.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::SpawnMinPointIdBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+		SpawnMaxPointId.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::SpawnMaxPointIdBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+		SpawnCount.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::SpawnCountBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+		InstanceTime.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::InstanceTimeBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+		InstancePrevFrameIndex.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::InstancePrevFrameIndexBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+		InstanceNextFrameIndex.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::InstanceNextFrameIndexBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+		InstanceFramePrevWeight.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::InstanceFramePrevWeightBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
 
 		FunctionIndexToAttributeIndexBuffer.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::FunctionIndexToAttributeIndexBufferBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
 
@@ -4134,16 +7367,105 @@ public:
 		SetSRVParameter(RHICmdList, ComputeShaderRHI, SpecialAttributeIndexesBuffer, Resource->SpecialAttributeIndexesGPUBuffer.SRV);
 
 		SetSRVParameter(RHICmdList, ComputeShaderRHI, SpawnTimesBuffer, Resource->SpawnTimesGPUBuffer.SRV);
-		SetSRVParameter(RHICmdList, ComputeShaderRHI, LifeValuesBuffer, Resource->LifeValuesGPUBuffer.SRV);
-		SetSRVParameter(RHICmdList, ComputeShaderRHI, PointTypesBuffer, Resource->PointTypesGPUBuffer.SRV);
+		SetSRVParameter(RHICmdList, ComputeShaderRHI, PointRecordsBuffer, Resource->PointRecordsGPUBuffer.SRV);
 
 		SetShaderValue(RHICmdList, ComputeShaderRHI, MaxNumberOfIndexesPerPoint, Resource->MaxNumberOfIndexesPerPoint);
 
-		SetSRVParameter(RHICmdList, ComputeShaderRHI, PointValueIndexesBuffer, Resource->PointValueIndexesGPUBuffer.SRV);
+		SetShaderValue(RHICmdList, ComputeShaderRHI, NumberOfPointsPerFrame, Resource->NumPointsPerFrame);
+		SetShaderValue(RHICmdList, ComputeShaderRHI, SampleTimeStep, Resource->SampleTimeStep);
+		SetShaderValue(RHICmdList, ComputeShaderRHI, PositionInterpolation, Resource->PositionInterpolation);
+		SetShaderValue(RHICmdList, ComputeShaderRHI, SpawnTimesSorted, Resource->SpawnTimesSorted);
+
+		SetShaderValue(RHICmdList, ComputeShaderRHI, NumberOfPointAttributes, Resource->NumPointAttributes);
+		if (Resource->NumPointAttributes > 0)
+			SetSRVParameter(RHICmdList, ComputeShaderRHI, PointAttributeValuesBuffer, Resource->PointAttributeValuesGPUBuffer.SRV);
+		else
+			SetSRVParameter(RHICmdList, ComputeShaderRHI, PointAttributeValuesBuffer, FNiagaraRenderer::GetDummyFloatBuffer());
+
+		SetShaderValue(RHICmdList, ComputeShaderRHI, NumberOfQuantizedColumns, Resource->NumQuantizedColumns);
+		if (Resource->NumQuantizedColumns > 0)
+		{
+			SetSRVParameter(RHICmdList, ComputeShaderRHI, QuantizedValuesBuffer, Resource->QuantizedValuesGPUBuffer.SRV);
+			SetSRVParameter(RHICmdList, ComputeShaderRHI, QuantizationParamsBuffer, Resource->QuantizationParamsGPUBuffer.SRV);
+		}
+		else
+		{
+			SetSRVParameter(RHICmdList, ComputeShaderRHI, QuantizedValuesBuffer, FNiagaraRenderer::GetDummyUIntBuffer());
+			SetSRVParameter(RHICmdList, ComputeShaderRHI, QuantizationParamsBuffer, FNiagaraRenderer::GetDummyFloatBuffer());
+		}
+
+		SetShaderValue(RHICmdList, ComputeShaderRHI, NumberOfIntColumns, Resource->NumIntColumns);
+		if (Resource->NumIntColumns > 0)
+		{
+			SetSRVParameter(RHICmdList, ComputeShaderRHI, IntValuesBuffer, Resource->IntValuesGPUBuffer.SRV);
+			SetSRVParameter(RHICmdList, ComputeShaderRHI, AttributeIntColumnIndexesBuffer, Resource->AttributeIntColumnIndexesGPUBuffer.SRV);
+		}
+		else
+		{
+			SetSRVParameter(RHICmdList, ComputeShaderRHI, IntValuesBuffer, FNiagaraRenderer::GetDummyIntBuffer());
+			SetSRVParameter(RHICmdList, ComputeShaderRHI, AttributeIntColumnIndexesBuffer, FNiagaraRenderer::GetDummyIntBuffer());
+		}
+
+		SetShaderValue(RHICmdList, ComputeShaderRHI, NumberOfVectorColumns, Resource->NumVectorColumns);
+		if (Resource->NumVectorColumns > 0)
+		{
+			SetSRVParameter(RHICmdList, ComputeShaderRHI, VectorColumnIndexesBuffer, Resource->VectorColumnIndexesGPUBuffer.SRV);
+			SetSRVParameter(RHICmdList, ComputeShaderRHI, VectorValuesBuffer, Resource->VectorValuesGPUBuffer.SRV);
+		}
+		else
+		{
+			SetSRVParameter(RHICmdList, ComputeShaderRHI, VectorColumnIndexesBuffer, FNiagaraRenderer::GetDummyIntBuffer());
+			SetSRVParameter(RHICmdList, ComputeShaderRHI, VectorValuesBuffer, FNiagaraRenderer::GetDummyFloat4Buffer());
+		}
+
+		if (Resource->NumPointAttributes > 0 || Resource->NumQuantizedColumns > 0 || Resource->NumIntColumns > 0)
+			SetSRVParameter(RHICmdList, ComputeShaderRHI, AttributeColumnIndexesBuffer, Resource->AttributeColumnIndexesGPUBuffer.SRV);
+		else
+			SetSRVParameter(RHICmdList, ComputeShaderRHI, AttributeColumnIndexesBuffer, FNiagaraRenderer::GetDummyIntBuffer());
+		if (Resource->PointSampleIndexesGPUBuffer.NumBytes > 0)
+		{
+			SetSRVParameter(RHICmdList, ComputeShaderRHI, PointSampleIndexOffsetsBuffer, Resource->PointSampleIndexOffsetsGPUBuffer.SRV);
+			SetSRVParameter(RHICmdList, ComputeShaderRHI, PointSampleIndexesBuffer, Resource->PointSampleIndexesGPUBuffer.SRV);
+		}
+		else
+		{
+			SetSRVParameter(RHICmdList, ComputeShaderRHI, PointSampleIndexOffsetsBuffer, FNiagaraRenderer::GetDummyIntBuffer());
+			SetSRVParameter(RHICmdList, ComputeShaderRHI, PointSampleIndexesBuffer, FNiagaraRenderer::GetDummyIntBuffer());
+		}
+
+		SetShaderValue(RHICmdList, ComputeShaderRHI, NumberOfFrames, Resource->NumFrames);
+		if (Resource->NumFrames > 0)
+		{
+			SetSRVParameter(RHICmdList, ComputeShaderRHI, FrameTimesBuffer, Resource->FrameTimesGPUBuffer.SRV);
+			SetSRVParameter(RHICmdList, ComputeShaderRHI, FrameSampleIndexOffsetsBuffer, Resource->FrameSampleIndexOffsetsGPUBuffer.SRV);
+		}
+		else
+		{
+			SetSRVParameter(RHICmdList, ComputeShaderRHI, FrameTimesBuffer, FNiagaraRenderer::GetDummyFloatBuffer());
+			SetSRVParameter(RHICmdList, ComputeShaderRHI, FrameSampleIndexOffsetsBuffer, FNiagaraRenderer::GetDummyIntBuffer());
+		}
 
-		SetShaderValue(RHICmdList, ComputeShaderRHI, LastSpawnedPointId, -1);
-		SetShaderValue(RHICmdList, ComputeShaderRHI, LastSpawnTime, -FLT_MAX);
-		SetShaderValue(RHICmdList, ComputeShaderRHI, LastSpawnTimeRequest, -FLT_MAX);
+		if (Resource->AliveIntervalIndexGPUBuffer.NumBytes > 0)
+			SetSRVParameter(RHICmdList, ComputeShaderRHI, AliveIntervalIndexBuffer, Resource->AliveIntervalIndexGPUBuffer.SRV);
+		else
+			SetSRVParameter(RHICmdList, ComputeShaderRHI, AliveIntervalIndexBuffer, FNiagaraRenderer::GetDummyFloatBuffer());
+
+		// Spawn state and values precomputed for the system instance during its tick
+		const FHoudiniNiagaraInstanceData DefaultInstanceData;
+		const FHoudiniNiagaraInstanceData* InstData = HoudiniDI->SystemInstancesToInstanceData.Find(Context.SystemInstanceID);
+		if (!InstData)
+			InstData = &DefaultInstanceData;
+
+		SetShaderValue(RHICmdList, ComputeShaderRHI, LastSpawnedPointId, InstData->LastSpawnedPointID);
+		SetShaderValue(RHICmdList, ComputeShaderRHI, LastSpawnTime, InstData->LastSpawnTime);
+		SetShaderValue(RHICmdList, ComputeShaderRHI, LastSpawnTimeRequest, InstData->LastSpawnTimeRequest);
+		SetShaderValue(RHICmdList, ComputeShaderRHI, SpawnMinPointId, InstData->SpawnMinID);
+		SetShaderValue(RHICmdList, ComputeShaderRHI, SpawnMaxPointId, InstData->SpawnMaxID);
+		SetShaderValue(RHICmdList, ComputeShaderRHI, SpawnCount, InstData->SpawnCount);
+		SetShaderValue(RHICmdList, ComputeShaderRHI, InstanceTime, InstData->Time);
+		SetShaderValue(RHICmdList, ComputeShaderRHI, InstancePrevFrameIndex, InstData->bHasFrameIndexes ? InstData->PrevFrameIndex : -1);
+		SetShaderValue(RHICmdList, ComputeShaderRHI, InstanceNextFrameIndex, InstData->bHasFrameIndexes ? InstData->NextFrameIndex : -1);
+		SetShaderValue(RHICmdList, ComputeShaderRHI, InstanceFramePrevWeight, InstData->FramePrevWeight);
 
 		// Build the the function index to attribute index lookup table if it has not yet been built for this DI proxy
 		HoudiniDI->UpdateFunctionIndexToAttributeIndexBuffer(FunctionIndexToAttribute);
@@ -4167,21 +7489,52 @@ private:
 	LAYOUT_FIELD(FShaderResourceParameter, SpecialAttributeIndexesBuffer);
 
 	LAYOUT_FIELD(FShaderResourceParameter, SpawnTimesBuffer);
-	LAYOUT_FIELD(FShaderResourceParameter, LifeValuesBuffer);
-	LAYOUT_FIELD(FShaderResourceParameter, PointTypesBuffer);
+	LAYOUT_FIELD(FShaderResourceParameter, PointRecordsBuffer);
 
 	LAYOUT_FIELD(FShaderParameter, MaxNumberOfIndexesPerPoint);
-	LAYOUT_FIELD(FShaderResourceParameter, PointValueIndexesBuffer);
+	LAYOUT_FIELD(FShaderResourceParameter, PointSampleIndexOffsetsBuffer);
+	LAYOUT_FIELD(FShaderResourceParameter, PointSampleIndexesBuffer);
+
+	LAYOUT_FIELD(FShaderParameter, NumberOfFrames);
+	LAYOUT_FIELD(FShaderParameter, NumberOfPointsPerFrame);
+	LAYOUT_FIELD(FShaderParameter, SampleTimeStep);
+	LAYOUT_FIELD(FShaderParameter, PositionInterpolation);
+	LAYOUT_FIELD(FShaderParameter, SpawnTimesSorted);
+
+	LAYOUT_FIELD(FShaderParameter, NumberOfPointAttributes);
+	LAYOUT_FIELD(FShaderResourceParameter, PointAttributeValuesBuffer);
+	LAYOUT_FIELD(FShaderResourceParameter, AttributeColumnIndexesBuffer);
+
+	LAYOUT_FIELD(FShaderParameter, NumberOfQuantizedColumns);
+	LAYOUT_FIELD(FShaderResourceParameter, QuantizedValuesBuffer);
+	LAYOUT_FIELD(FShaderResourceParameter, QuantizationParamsBuffer);
+
+	LAYOUT_FIELD(FShaderParameter, NumberOfIntColumns);
+	LAYOUT_FIELD(FShaderResourceParameter, IntValuesBuffer);
+	LAYOUT_FIELD(FShaderResourceParameter, AttributeIntColumnIndexesBuffer);
+	LAYOUT_FIELD(FShaderResourceParameter, AliveIntervalIndexBuffer);
+	LAYOUT_FIELD(FShaderParameter, NumberOfVectorColumns);
+	LAYOUT_FIELD(FShaderResourceParameter, VectorColumnIndexesBuffer);
+	LAYOUT_FIELD(FShaderResourceParameter, VectorValuesBuffer);
+	LAYOUT_FIELD(FShaderResourceParameter, FrameTimesBuffer);
+	LAYOUT_FIELD(FShaderResourceParameter, FrameSampleIndexOffsetsBuffer);
 
 	LAYOUT_FIELD(FShaderParameter, LastSpawnedPointId);
 	LAYOUT_FIELD(FShaderParameter, LastSpawnTime);
 	LAYOUT_FIELD(FShaderParameter, LastSpawnTimeRequest);
+	LAYOUT_FIELD(FShaderParameter, SpawnMinPointId);
+	LAYOUT_FIELD(FShaderParameter, SpawnMaxPointId);
+	LAYOUT_FIELD(FShaderParameter, SpawnCount);
+	LAYOUT_FIELD(FShaderParameter, InstanceTime);
+	LAYOUT_FIELD(FShaderParameter, InstancePrevFrameIndex);
+	LAYOUT_FIELD(FShaderParameter, InstanceNextFrameIndex);
+	LAYOUT_FIELD(FShaderParameter, InstanceFramePrevWeight);
 
 	LAYOUT_FIELD(FShaderResourceParameter, FunctionIndexToAttributeIndexBuffer);
 
 	LAYOUT_FIELD(TMemoryImageArray<FName>, FunctionIndexToAttribute);
 
-	LAYOUT_FIELD_INITIALIZED(uint32, Version, 1);
+	LAYOUT_FIELD_INITIALIZED(uint32, Version, 7);
 };
 
 IMPLEMENT_TYPE_LAYOUT(FNiagaraDataInterfaceParametersCS_Houdini);
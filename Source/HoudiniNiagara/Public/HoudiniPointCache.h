@@ -23,6 +23,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
 #include "HAL/PlatformProcess.h"
 #include "Misc/CoreMiscDefines.h" 
 #include "Misc/FileHelper.h"
@@ -80,6 +81,53 @@ enum class EHoudiniPointCacheFileType : uint8
 	BJSON,
 };
 
+UENUM()
+enum class EHoudiniPointCacheTopology : uint8
+{
+	// Use the fixed topology storage if every point exists on every frame
+	Auto,
+	// Always use the fixed topology storage, missing samples are filled with the point's closest sample
+	Fixed,
+	// Always use the per-point sample index table
+	Variable,
+};
+
+UENUM()
+enum class EHoudiniAttributeQuantization : uint8
+{
+	// Store the values as 32 bit floats
+	None,
+	// Store the values as 16 bit half floats
+	Half,
+	// Store the values as 16 bit unsigned normalized integers in the attribute's [min, max] range
+	UNorm16,
+	// Store the values as 16 bit signed normalized integers in the attribute's [-max, max] absolute range
+	SNorm16,
+};
+
+UENUM()
+enum class EHoudiniPositionInterpolation : uint8
+{
+	// Linearly interpolate the positions between two samples
+	Linear,
+	// Interpolate the positions with a cubic Hermite curve, using the velocity attribute (v) as tangents.
+	// Allows exporting the point cache with fewer frames. Positions are linearly interpolated if the point cache has no velocity.
+	Hermite,
+};
+
+// Per-point values of a point cache, packed so that all of them are fetched with a single load.
+// Matches the float4 records of the GPU PointRecordsBuffer.
+struct FHoudiniPointRecord
+{
+	float SpawnTime = 0.0f;
+	float Life = -1.0f;
+	// Stored as a float so that it isn't read as a denormal, and possibly flushed to 0, by the float4 loads on the GPU
+	float Type = -1.0f;
+	// SpawnTime + Life, or FLT_MAX for points without a valid life value
+	float DeathTime = TNumericLimits<float>::Max();
+};
+static_assert(sizeof(FHoudiniPointRecord) == 4 * sizeof(float), "FHoudiniPointRecord must match the layout of a float4");
+
 struct FNiagaraDIHoudini_StaticDataPassToRT
 {
 	~FNiagaraDIHoudini_StaticDataPassToRT()
@@ -89,16 +137,77 @@ struct FNiagaraDIHoudini_StaticDataPassToRT
 
 	TArray<float> FloatData;
 	TArray<float> SpawnTimes;
-	TArray<float> LifeValues;
-	TArray<int32> PointTypes;
+	TArray<FHoudiniPointRecord> PointRecords;
 	TArray<int32> SpecialAttributeIndexes;
-	TArray<int32> PointValueIndexes;
+	TArray<int32> PointSampleIndexOffsets;
+	TArray<int32> PointSampleIndexes;
+	TArray<float> FrameTimes;
+	TArray<int32> FrameSampleIndexOffsets;
+	TArray<float> PointAttributeValues;
+	TArray<int32> AttributeColumnIndexes;
+	TArray<uint16> QuantizedData;
+	TArray<float> QuantizationParams;
+	TArray<int32> IntData;
+	TArray<int32> AttributeIntColumnIndexes;
+	TArray<float> AliveIntervalIndex;
+	TArray<int32> VectorColumnIndexes;
+	TArray<int32> VectorSourceColumns;
 	TArray<FString> Attributes;
+	TMap<FName, int32> AttributeIndexMap;
 
 	int32 NumSamples;
 	int32 NumAttributes;
 	int32 NumPoints;
 	int32 MaxNumIndexesPerPoint;
+	int32 NumPointsPerFrame;
+	int32 NumPointAttributes;
+	int32 NumQuantizedColumns;
+	int32 NumIntColumns;
+	int32 NumVectorColumns;
+	float SampleTimeStep;
+	int32 PositionInterpolation;
+	int32 SpawnTimesSorted;
+};
+
+// Attribute layout of a point cache as seen by the GPU, see UHoudiniPointCache::GetShaderLayout.
+// Baked into the GPU simulation shaders when UNiagaraDataInterfaceHoudini::bSpecializeShaders is enabled.
+struct FHoudiniPointCacheShaderLayout
+{
+	TArray<int32> SpecialAttributeIndexes;
+	int32 NumAttributes = 0;
+	int32 NumPointAttributes = 0;
+	int32 NumQuantizedColumns = 0;
+	int32 NumIntColumns = 0;
+	int32 NumVectorColumns = 0;
+
+	bool operator==(const FHoudiniPointCacheShaderLayout& Other) const
+	{
+		return SpecialAttributeIndexes == Other.SpecialAttributeIndexes && NumAttributes == Other.NumAttributes
+			&& NumPointAttributes == Other.NumPointAttributes && NumQuantizedColumns == Other.NumQuantizedColumns && NumIntColumns == Other.NumIntColumns
+			&& NumVectorColumns == Other.NumVectorColumns;
+	}
+
+	// Returns the layout as a string, for the shader compile hash
+	FString ToString() const
+	{
+		FString Result = FString::Printf(TEXT("%d/%d/%d/%d/%d:"), NumAttributes, NumPointAttributes, NumQuantizedColumns, NumIntColumns, NumVectorColumns);
+		for (const int32& Index : SpecialAttributeIndexes)
+			Result += FString::Printf(TEXT("%d,"), Index);
+		return Result;
+	}
+};
+
+// Values of a set of attributes for all the points of a point cache at a given time, see UHoudiniPointCache::GetSharedEvaluationAtTime
+struct FHoudiniPointCacheSharedEvaluation
+{
+	float Time = 0.0f;
+	TArray<int32> AttributeIndexes;
+
+	// The value of AttributeIndexes[ n ] for a point is Values[ n * NumberOfPoints + PointID ], as filled by EvaluatePointsAtTime
+	TArray<float> Values;
+
+	// Frame on which this evaluation was last requested
+	uint64 LastUsedFrame = 0;
 };
 
 /**
@@ -112,21 +221,42 @@ public:
 	FRWBuffer FloatValuesGPUBuffer;
 	FRWBuffer SpecialAttributeIndexesGPUBuffer;
 	FRWBuffer SpawnTimesGPUBuffer;
-	FRWBuffer LifeValuesGPUBuffer;
-	FRWBuffer PointTypesGPUBuffer;
-	FRWBuffer PointValueIndexesGPUBuffer;
+	FRWBuffer PointRecordsGPUBuffer;
+	FRWBuffer PointSampleIndexOffsetsGPUBuffer;
+	FRWBuffer PointSampleIndexesGPUBuffer;
+	FRWBuffer FrameTimesGPUBuffer;
+	FRWBuffer FrameSampleIndexOffsetsGPUBuffer;
+	FRWBuffer PointAttributeValuesGPUBuffer;
+	FRWBuffer AttributeColumnIndexesGPUBuffer;
+	FRWBuffer QuantizedValuesGPUBuffer;
+	FRWBuffer QuantizationParamsGPUBuffer;
+	FRWBuffer IntValuesGPUBuffer;
+	FRWBuffer AttributeIntColumnIndexesGPUBuffer;
+	FRWBuffer AliveIntervalIndexGPUBuffer;
+	FRWBuffer VectorColumnIndexesGPUBuffer;
+	FRWBuffer VectorValuesGPUBuffer;
 
 	int32 MaxNumberOfIndexesPerPoint;
 	int32 NumSamples;
 	int32 NumAttributes;
 	int32 NumPoints;
+	int32 NumFrames;
+	int32 NumPointsPerFrame;
+	int32 NumPointAttributes;
+	int32 NumQuantizedColumns;
+	int32 NumIntColumns;
+	int32 NumVectorColumns;
+	float SampleTimeStep;
+	int32 PositionInterpolation;
+	int32 SpawnTimesSorted;
 
 	TArray<FString> Attributes;
+	TMap<FName, int32> AttributeIndexMap;
 
 	TUniquePtr<struct FNiagaraDIHoudini_StaticDataPassToRT> CachedData;
 
 	/** Default constructor. */
-	FHoudiniPointCacheResource() : CachedData(nullptr){}
+	FHoudiniPointCacheResource() : NumFrames(0), NumPointsPerFrame(0), NumPointAttributes(0), NumQuantizedColumns(0), NumIntColumns(0), NumVectorColumns(0), SampleTimeStep(0.0f), PositionInterpolation(0), SpawnTimesSorted(0), CachedData(nullptr){}
 
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
 	virtual void InitRHI(FRHICommandListBase& RHICmdList) override;
@@ -185,6 +315,17 @@ class HOUDININIAGARA_API UHoudiniPointCache : public UObject
 	UFUNCTION(BlueprintCallable, Category = "Houdini Attributes Data")
 	bool GetAttributeIndexFromString(const FString& Attribute, int32& AttributeIndex) const;
 
+	// Returns the attribute index for a given name, including vector attribute names (P for P.x). Does not allocate.
+	UFUNCTION(BlueprintCallable, Category = "Houdini Attributes Data")
+	bool GetAttributeIndexFromName(const FName& Attribute, int32& AttributeIndex) const;
+
+	// Builds a name to attribute index map from an attribute array.
+	// Vector attribute names (P for P.x) are mapped to their first component, unless an attribute uses that exact name.
+	static void BuildAttributeIndexMap(const TArray<FString>& InAttributeArray, TMap<FName, int32>& OutAttributeIndexMap);
+
+	// Rebuilds AttributeIndexMap from AttributeArray, should be called when the attribute array has changed
+	void BuildAttributeIndexMap() { BuildAttributeIndexMap( AttributeArray, AttributeIndexMap ); }
+
 	// Returns the attribute index for a given string. This is a static version of the function that
 	// takes the attribute name array as an argument as well.
 	UFUNCTION(BlueprintCallable, Category = "Houdini Attributes Data")
@@ -196,6 +337,13 @@ class HOUDININIAGARA_API UHoudiniPointCache : public UObject
 	// Returns the float value at a given point in the point cache
 	UFUNCTION(BlueprintCallable, Category = "Houdini Attributes Data")
 	bool GetFloatValueForString( const int32& sampleIndex, const FString& Attribute, float& value ) const;
+	// Returns the integer value at a given point in the point cache.
+	// Integer attributes are read without conversion, other attributes are rounded down.
+	UFUNCTION(BlueprintCallable, Category = "Houdini Attributes Data")
+	bool GetIntValue( const int32& sampleIndex, const int32& attrIndex, int32& value ) const;
+	// Returns the integer value at a given point in the point cache
+	UFUNCTION(BlueprintCallable, Category = "Houdini Attributes Data")
+	bool GetIntValueForString( const int32& sampleIndex, const FString& Attribute, int32& value ) const;
 	/*
 	// Returns the string value at a given point in the point cache
 	bool GetCSVStringValue( const int32& sampleIndex, const int32& attrIndex, FString& value );
@@ -264,9 +412,26 @@ class HOUDININIAGARA_API UHoudiniPointCache : public UObject
 		int32& MinID, int32& MaxID, int32& Count,
 		int32& LastSpawnedPointID, float& LastSpawnTime ) const;
 
+	// Returns the number of points alive at a given time (spawned, and not dead yet), and a range of point IDs containing them.
+	// The range can also contain points that are not alive at that time, use IsPointAliveAtTime to filter them.
+	// An empty range is returned as FirstPointID = 0, LastPointID = -1.
+	UFUNCTION(BlueprintCallable, Category = "Houdini Attributes Data")
+	bool GetAlivePointsAtTime( const float& desiredTime, int32& NumAlivePoints, int32& FirstPointID, int32& LastPointID ) const;
+
+	// Returns true if a point has spawned at the desired time and is not dead yet
+	UFUNCTION(BlueprintCallable, Category = "Houdini Attributes Data")
+	bool IsPointAliveAtTime( const int32& PointID, const float& desiredTime ) const;
+
 	// Returns the previous and next sample indexes for reading the values of a specified point at a given time
 	UFUNCTION(BlueprintCallable, Category = "Houdini Attributes Data")
 	bool GetSampleIndexesForPointAtTime(const int32& PointID, const float& desiredTime, int32& PrevSampleIndex, int32& NextSampleIndex, float& PrevWeight) const;
+	// Same as GetSampleIndexesForPointAtTime, but resumes the search from a sample cursor returned by a previous call for the same point.
+	// Searches from a cursor close to the desired time take a few steps, a negative cursor starts a new search.
+	bool GetSampleIndexesForPointAtTimeWithCursor(const int32& PointID, const float& desiredTime, int32& SampleCursor, int32& PrevSampleIndex, int32& NextSampleIndex, float& PrevWeight) const;
+	// Returns the previous and next frame indexes for a given time, only available for point caches with a fixed topology.
+	// The sample indexes of a point on these frames are then PrevFrameIndex * NumberOfPoints + PointID and NextFrameIndex * NumberOfPoints + PointID.
+	bool GetFrameIndexesAtTime(const float& desiredTime, int32& PrevFrameIndex, int32& NextFrameIndex, float& PrevWeight) const;
+	bool HasFixedTopology() const { return bHasFixedTopology; }
 	// Returns the value for a point at a given time value (linearly interpolated)
 	UFUNCTION(BlueprintCallable, Category = "Houdini Attributes Data")
 	bool GetPointValueAtTime(const int32& PointID, const int32& AttributeIndex, const float& desiredTime, float& Value) const;
@@ -304,10 +469,34 @@ class HOUDININIAGARA_API UHoudiniPointCache : public UObject
 	// Return the integer value of the point at the keyframe before the desired time. No value interpolation will take place.
 	UFUNCTION(BlueprintCallable, Category = "Houdini Attributes Data")
 	bool GetPointInt32ValueAtTime(int32 PointID, int32 AttributeIndex, float desiredTime, int32& Value) const;
+
+	// Evaluates several attributes of a range of points at a given time (linearly interpolated).
+	// OutValues is filled attribute by attribute: the value of the i-th point of the range for AttributeIndexes[ n ] is OutValues[ n * NumPoints + i ].
+	// A negative NumPoints evaluates all the points from FirstPointID, points without samples are evaluated as zero.
+	// The values are always linearly interpolated.
+	UFUNCTION(BlueprintCallable, Category = "Houdini Attributes Data")
+	bool EvaluatePointsAtTime(float desiredTime, const TArray<int32>& AttributeIndexes, TArray<float>& OutValues, int32 FirstPointID = 0, int32 NumPoints = -1) const;
+
+	// Returns the values of a set of attributes for all the points at a given time. They are computed with EvaluatePointsAtTime on the first request,
+	// and shared with the following requests for the same time and attributes. Evaluations that weren't requested on the previous frame are released.
+	// Returns null if bShareEvaluations is disabled, or if the values don't fit in SharedEvaluationsMaxMemoryMB.
+	// The values are linearly interpolated, the data interfaces don't use shared evaluations for Hermite interpolated positions.
+	TSharedPtr<const FHoudiniPointCacheSharedEvaluation, ESPMode::ThreadSafe> GetSharedEvaluationAtTime(const float& desiredTime, const TArray<int32>& AttributeIndexes) const;
+
+	// Releases all the shared evaluations
+	void ResetSharedEvaluations();
 	
-	// Returns the Position Value for a given point at a given time value (linearly interpolated)
+	// Returns the Position Value for a given point at a given time value (interpolated with PositionInterpolation)
 	UFUNCTION(BlueprintCallable, Category = "Houdini Attributes Data")
 	bool GetPointPositionAtTime(const int32& PointID, const float& desiredTime, FVector& Vector) const;
+
+	// Interpolates a vector attribute between two samples. The position attribute uses a cubic Hermite curve
+	// with the velocities as tangents if UsesHermiteInterpolation, the other attributes are linearly interpolated.
+	bool InterpolateVectorValue(const int32& PrevSampleIndex, const int32& NextSampleIndex, const float& PrevWeight, const int32& AttrIndex, FVector& Vector, const bool& DoSwap, const bool& DoScale) const;
+
+	// Indicates that an attribute is interpolated with a cubic Hermite curve: PositionInterpolation is Hermite,
+	// the attribute is the position and the point cache has velocities
+	bool UsesHermiteInterpolation(const int32& AttrIndex) const;
 	// Return a given point's life value at spawn
 	UFUNCTION(BlueprintCallable, Category = "Houdini Attributes Data")
 	bool GetPointLife(const int32& PointID, float& Value) const;
@@ -322,9 +511,105 @@ class HOUDININIAGARA_API UHoudiniPointCache : public UObject
 	bool GetPointType(const int32& PointID, int32& Value) const;
 
 
-	// Returns the maximum number of indexes per point, used for flattening the buffer for HLSL conversion
+	// Returns the maximum number of sample indexes used by a single point
 	int32 GetMaxNumberOfPointValueIndexes() const;
 
+	// Returns the range of a point's sample indexes in the flat PointSampleIndexes array: [OutFirst, OutFirst + OutCount)
+	bool GetPointSampleIndexRange(const int32& PointID, int32& OutFirst, int32& OutCount) const;
+
+	// Rebuilds the point to sample index table (PointSampleIndexOffsets / PointSampleIndexes) from the point ID attribute.
+	// Samples are expected to be sorted by time, each point's sample indexes will then also be sorted by time.
+	void BuildPointSampleIndexes();
+
+	// Removes the samples that can be linearly interpolated from the point's remaining samples within the attribute's tolerance.
+	// Expects the point sample index table to have been built, and rebuilds it if samples were removed.
+	// Skipped in Auto topology mode if the point cache has a fixed topology, which the reduction would break.
+	void ReduceKeyframes();
+
+	// Resamples every point onto a fixed time step (ResampleTimeStep) starting at its first sample, so that the sample indexes
+	// for a given time can be computed directly. Expects the point sample index table to have been built, and rebuilds it.
+	void ResampleUniformly();
+
+	// Returns the keyframe reduction tolerance for an attribute, by its name or the name of its vector attribute (P for P.x)
+	float GetKeyframeReductionTolerance( const int32& attrIndex ) const;
+
+	// Rebuilds PointSampleTimes, the time value of each entry in PointSampleIndexes
+	void BuildPointSampleTimes();
+
+	// Rebuilds the frame table (FrameTimes / FrameSampleIndexOffsets) by grouping consecutive samples sharing the same time value.
+	// The table is left empty if the point cache has no time attribute or if its samples are not sorted by time.
+	void BuildFrameTable();
+
+	// Checks if SpawnTimes are sorted in ascending order, enabling binary searches in GetLastPointIDToSpawnAtTime
+	void UpdateSpawnTimesSorted();
+
+	bool AreSpawnTimesSorted() const { return bSpawnTimesSorted; }
+
+	// Rebuilds AliveIntervalIndex from SpawnTimes and LifeValues, used by GetAlivePointsAtTime
+	void BuildAliveIntervalIndex();
+
+	// Rebuilds PointRecords from SpawnTimes, LifeValues and PointTypes
+	void BuildPointRecords();
+
+	const TArray<FHoudiniPointRecord>& GetPointRecords() const { return PointRecords; }
+
+	const TArray<float>& GetAliveIntervalIndex() const { return AliveIntervalIndex; }
+
+	// Finds the sample of each point on each frame, as a [frame][point] array. Fails if a point is missing from a frame or
+	// appears twice on it, unless bFillMissingSamples is set: missing samples then use the point's closest sample.
+	// Expects the point sample index table and the frame table to have been built.
+	bool FindDenseSampleIndexes( TArray<int32>& OutDenseSampleIndexes, const bool& bFillMissingSamples, int32& OutNumMissingSamples ) const;
+
+	// Converts the samples to a dense [frame][point] block if TopologyMode allows it, and removes the point sample index table.
+	// Expects the point sample index table and the frame table to have been built.
+	void BuildFixedTopology();
+
+	// Moves the attributes that are constant for each point from FloatSampleData to PointAttributeValues.
+	// Should be called last when importing, as it removes columns from FloatSampleData.
+	void HoistPointAttributes();
+
+	// Restores the default layout, where all attributes are stored in FloatSampleData. Does not move the values back.
+	void ResetPointAttributes();
+
+	// Returns the column of an attribute in FloatSampleData, or -1 - the attribute's column in PointAttributeValues
+	// if the attribute is constant for each point
+	int32 GetAttributeColumnIndex( const int32& attrIndex ) const { return AttributeColumnIndexes.Num() > 0 ? AttributeColumnIndexes[ attrIndex ] : attrIndex; }
+
+	// Returns the number of attributes stored per point in PointAttributeValues
+	int32 GetNumberOfPointAttributes() const { return NumberOfPointAttributes; }
+
+	// Quantizes the attributes selected in AttributeQuantization, moving them from FloatSampleData to QuantizedSampleData.
+	// Should be called after HoistPointAttributes, as only the attributes stored per sample are quantized.
+	void QuantizeAttributes();
+
+	// Restores the default layout, where no attribute is quantized. Does not move the values back.
+	void ResetQuantizedAttributes();
+
+	// Returns the quantization requested for an attribute, by its name or the name of its vector attribute (P for P.x)
+	EHoudiniAttributeQuantization GetAttributeQuantization( const int32& attrIndex ) const;
+
+	// Returns the number of quantized columns stored in QuantizedSampleData
+	int32 GetNumberOfQuantizedColumns() const { return NumberOfQuantizedColumns; }
+
+	// Number of values stored per attribute in QuantizationParams: quantized column, quantization, offset and scale
+	static constexpr int32 QuantizationParamsStride = 4;
+
+	// Allocates IntSampleData for the attributes flagged in IsIntAttribute. Expects NumberOfSamples and NumberOfAttributes to be set.
+	// During import, integer attributes are stored both in IntSampleData and FloatSampleData.
+	void InitIntAttributes( const TArray<bool>& IsIntAttribute );
+
+	// Restores the default layout, where no attribute is stored as integers
+	void ResetIntAttributes();
+
+	// Removes the integer attributes columns from FloatSampleData, should be called last when importing.
+	void CompactIntAttributes();
+
+	// Returns the column of an attribute in IntSampleData, or INDEX_NONE if the attribute is not stored as integers
+	int32 GetAttributeIntColumnIndex( const int32& attrIndex ) const { return AttributeIntColumnIndexes.IsValidIndex( attrIndex ) ? AttributeIntColumnIndexes[ attrIndex ] : INDEX_NONE; }
+
+	// Returns the number of integer columns stored in IntSampleData
+	int32 GetNumberOfIntColumns() const { return NumberOfIntColumns; }
+
 	//-----------------------------------------------------------------------------------------
 	//  MEMBER VARIABLES
 	//-----------------------------------------------------------------------------------------
@@ -369,6 +654,76 @@ class HOUDININIAGARA_API UHoudiniPointCache : public UObject
 	UPROPERTY(EditAnywhere, Category = "Houdini Point Cache Properties")
 	FString SourceCSVTitleRow;
 
+	// Fixed topology point caches (every point exists on every frame) can be stored as a dense [frame][point] block,
+	// removing the point sample index table. The frame is still found with a binary search in the frame times,
+	// the sample of a point on that frame is then indexed directly.
+	// Keyframe reduction is skipped for fixed topology point caches, unless this is set to Variable.
+	// Editing this will trigger a re-import of the point cache.
+	UPROPERTY(EditAnywhere, Category = "Houdini Point Cache Properties")
+	EHoudiniPointCacheTopology TopologyMode;
+
+	// Indicates that the samples are stored as a dense [frame][point] block: the sample of point P on frame F is F * NumberOfPoints + P
+	UPROPERTY( VisibleAnywhere, Category = "Houdini Point Cache Properties")
+	bool bHasFixedTopology;
+
+	// When importing, resample every point onto this fixed time step, starting at the point's first sample.
+	// The sample indexes of a point at a given time are then computed directly instead of being searched.
+	// A value of 0 keeps the source samples. Editing this will trigger a re-import of the point cache.
+	UPROPERTY(EditAnywhere, Category = "Houdini Point Cache Properties", meta = (ClampMin = "0.0"))
+	float ResampleTimeStep;
+
+	// The time step between the samples of each point if the point cache was resampled uniformly, 0 otherwise.
+	// The N-th sample of point P is then at PointSampleIndexes[ PointSampleIndexOffsets[ P ] + N ].
+	UPROPERTY( VisibleAnywhere, Category = "Houdini Point Cache Properties")
+	float UniformSampleTimeStep;
+
+	// Attributes to store with 16 bits per value instead of 32, by attribute name (P.x) or vector attribute name (P).
+	// The point ID and time attributes, and attributes that are constant for each point, are never quantized.
+	// Editing this will trigger a re-import of the point cache.
+	UPROPERTY(EditAnywhere, Category = "Houdini Point Cache Properties")
+	TMap<FString, EHoudiniAttributeQuantization> AttributeQuantization;
+
+	// The maximum absolute error introduced by the quantization of each quantized attribute
+	UPROPERTY( VisibleAnywhere, Category = "Houdini Point Cache Properties")
+	TMap<FString, float> QuantizationMaxErrors;
+
+	// When importing, samples that can be linearly interpolated from the point's other samples within this tolerance are removed.
+	// A value of 0 disables the keyframe reduction, unless tolerances are set per attribute.
+	// The reduction removes points from frames, so it is skipped if TopologyMode is Fixed, or if it is Auto and every point
+	// exists on every frame: set TopologyMode to Variable to trade the dense [frame][point] layout for fewer samples.
+	// Editing this will trigger a re-import of the point cache.
+	UPROPERTY(EditAnywhere, Category = "Houdini Point Cache Properties", meta = (ClampMin = "0.0"))
+	float KeyframeReductionTolerance;
+
+	// Keyframe reduction tolerances overriding KeyframeReductionTolerance, by attribute name (P.x) or vector attribute name (P).
+	// Editing this will trigger a re-import of the point cache.
+	UPROPERTY(EditAnywhere, Category = "Houdini Point Cache Properties")
+	TMap<FString, float> KeyframeReductionAttributeTolerances;
+
+	// The number of samples in the source file divided by the number of samples kept by the keyframe reduction
+	UPROPERTY( VisibleAnywhere, Category = "Houdini Point Cache Properties")
+	float KeyframeReductionRatio;
+
+	// The interpolation used for the positions between two samples.
+	// Hermite interpolation keeps the trajectories smooth with sparsely exported point caches, as long as they have velocities.
+	UPROPERTY(EditAnywhere, Category = "Houdini Point Cache Properties")
+	EHoudiniPositionInterpolation PositionInterpolation;
+
+	// When enabled, the data interfaces sampling this point cache at a time that is constant over a particle batch evaluate each attribute
+	// once for all the points, and share the values with the other emitters and systems sampling the same time on the same frame.
+	UPROPERTY(EditAnywhere, Category = "Houdini Point Cache Properties")
+	bool bShareEvaluations;
+
+	// Maximum memory used by the shared evaluations, in megabytes
+	UPROPERTY(EditAnywhere, Category = "Houdini Point Cache Properties", meta = (ClampMin = "0.0", EditCondition = "bShareEvaluations"))
+	float SharedEvaluationsMaxMemoryMB;
+
+	// When enabled, the vector attributes (P, v, N, orient...) stored as floats are also uploaded to the GPU interleaved,
+	// one float4 per sample, so that the GPU simulations read them with a single load instead of one load per component.
+	// Increases the GPU memory used by these attributes.
+	UPROPERTY(EditAnywhere, Category = "Houdini Point Cache Properties")
+	bool bInterleaveVectorAttributes;
+
 	// The final attribute names used by the asset after parsing.
 	// Packed vector values are expanded, so additional attributes (.0, .1, ... or .x, .y, .z) might have been inserted.
 	// Use the indexes in this array to access your data.
@@ -397,6 +752,8 @@ class HOUDININIAGARA_API UHoudiniPointCache : public UObject
 	FName RawDataCompressionMethod;
 #endif
 
+	virtual void PostLoad() override;
+
 #if WITH_EDITOR
 	bool HasRawData() const { return RawDataCompressed.Num() > 0; };
 
@@ -414,6 +771,11 @@ class HOUDININIAGARA_API UHoudiniPointCache : public UObject
 	UFUNCTION(BlueprintCallable, Category = "Houdini Point Cache Data")
 	const TArray<float>& GetFloatSampleData() const { return FloatSampleData; }
 
+	TArray<int32>& GetIntSampleData() { return IntSampleData; }
+
+	UFUNCTION(BlueprintCallable, Category = "Houdini Point Cache Data")
+	const TArray<int32>& GetIntSampleData() const { return IntSampleData; }
+
 	TArray<float>& GetSpawnTimes() { return SpawnTimes; }
 
 	UFUNCTION(BlueprintCallable, Category = "Houdini Point Cache Data")
@@ -434,10 +796,15 @@ class HOUDININIAGARA_API UHoudiniPointCache : public UObject
 	UFUNCTION(BlueprintCallable, Category = "Houdini Point Cache Data")
 	const TArray<int32>& GetSpecialAttributeIndexes() const { return SpecialAttributeIndexes; }
 
-	TArray<FPointIndexes>& GetPointValueIndexes() { return PointValueIndexes; }
+	TArray<int32>& GetPointSampleIndexOffsets() { return PointSampleIndexOffsets; }
+
+	UFUNCTION(BlueprintCallable, Category = "Houdini Point Cache Data")
+	const TArray<int32>& GetPointSampleIndexOffsets() const { return PointSampleIndexOffsets; }
 
-	UFUNCTION()
-	const TArray<FPointIndexes>& GetPointValueIndexes() const { return PointValueIndexes; }
+	TArray<int32>& GetPointSampleIndexes() { return PointSampleIndexes; }
+
+	UFUNCTION(BlueprintCallable, Category = "Houdini Point Cache Data")
+	const TArray<int32>& GetPointSampleIndexes() const { return PointSampleIndexes; }
 
 	UFUNCTION(BlueprintCallable, Category = "Houdini Point Cache Settings")
 	bool GetUseCustomCSVTitleRow() const { return UseCustomCSVTitleRow; }
@@ -450,6 +817,15 @@ class HOUDININIAGARA_API UHoudiniPointCache : public UObject
 
 	void RequestPushToGPU();
 
+	// Returns the attribute layout of the data pushed to the GPU by RequestPushToGPU
+	void GetShaderLayout(FHoudiniPointCacheShaderLayout& OutLayout) const;
+
+	// Returns the number of vector attributes uploaded interleaved to the GPU when bInterleaveVectorAttributes is enabled.
+	// OutVectorColumnIndexes has an entry per attribute: ( row << 1 ) | 1 if the vector has a fourth component for the first
+	// component of each interleaved vector, INDEX_NONE otherwise. OutSourceColumns has the four FloatSampleData columns
+	// of each row, INDEX_NONE for the missing fourth component of 3 components vectors.
+	int32 GetInterleavedVectorLayout(TArray<int32>& OutVectorColumnIndexes, TArray<int32>& OutSourceColumns) const;
+
 	private:
 
 	/*
@@ -484,9 +860,89 @@ class HOUDININIAGARA_API UHoudiniPointCache : public UObject
 	TMap<float, int32> TimeValuesIndexes;
 	*/
 
-	// Sample indexes for each point
+	// Sample indexes for each point, stored as a compressed sparse row table:
+	// the sample indexes of point N are PointSampleIndexes[ PointSampleIndexOffsets[N] ] to PointSampleIndexes[ PointSampleIndexOffsets[N + 1] - 1 ]
+	UPROPERTY()
+	TArray<int32> PointSampleIndexOffsets;
+
+	UPROPERTY()
+	TArray<int32> PointSampleIndexes;
+
+	// Frame table: time value of each frame, and the first sample index of each frame.
+	// The samples of frame N are FrameSampleIndexOffsets[N] to FrameSampleIndexOffsets[N + 1] - 1
+	UPROPERTY()
+	TArray<float> FrameTimes;
+
+	UPROPERTY()
+	TArray<int32> FrameSampleIndexOffsets;
+
+	// Values of the attributes that are constant for each point, NumberOfPointAttributes values per point
+	UPROPERTY()
+	TArray<float> PointAttributeValues;
+
+	// Column of each attribute: >= 0 for columns in FloatSampleData, < 0 for columns in PointAttributeValues (-1 - column).
+	// Empty if no attribute has been moved to PointAttributeValues
+	UPROPERTY()
+	TArray<int32> AttributeColumnIndexes;
+
+	UPROPERTY()
+	int32 NumberOfPointAttributes;
+
+	// Quantized attribute values, the value of quantized column C for sample S is QuantizedSampleData[ S + C * NumberOfSamples ]
+	UPROPERTY()
+	TArray<uint16> QuantizedSampleData;
+
+	// QuantizationParamsStride values per attribute: quantized column (< 0 if not quantized), quantization, offset and scale.
+	// Quantized attributes are not stored in FloatSampleData, their entry in AttributeColumnIndexes is unused.
+	// Empty if no attribute is quantized.
+	UPROPERTY()
+	TArray<float> QuantizationParams;
+
+	UPROPERTY()
+	int32 NumberOfQuantizedColumns;
+
+	// Values of the integer attributes, the value of integer column C for sample S is IntSampleData[ S + C * NumberOfSamples ]
+	UPROPERTY()
+	TArray<int32> IntSampleData;
+
+	// Column of each attribute in IntSampleData, INDEX_NONE for attributes that are not integers.
+	// Integer attributes are not stored in FloatSampleData, their entry in AttributeColumnIndexes is unused.
+	// Empty if the point cache has no integer attribute.
+	UPROPERTY()
+	TArray<int32> AttributeIntColumnIndexes;
+
+	UPROPERTY()
+	int32 NumberOfIntColumns;
+
+	// Time value of each entry in PointSampleIndexes, so that each point's sample times are contiguous and sorted.
+	// Not serialized, rebuilt on load from FloatSampleData.
+	TArray<float> PointSampleTimes;
+
+	// Indicates that SpawnTimes are sorted in ascending order.
+	// Not serialized, validated on load and after import.
+	bool bSpawnTimesSorted = false;
+
+	// Index of the points' alive intervals [spawn time, death time), in four sections of NumberOfPoints values:
+	// the sorted spawn times, the minimum spawn time of points [i, NumberOfPoints), the sorted death times
+	// and the maximum death time of points [0, i]. Points without a life value never die.
+	// Not serialized, rebuilt on load and after import from SpawnTimes and LifeValues.
+	TArray<float> AliveIntervalIndex;
+
+	// SpawnTimes, LifeValues and PointTypes interleaved in one record per point, used by the per-point queries.
+	// Not serialized, rebuilt on load and after import. Empty if any of the three arrays is missing values.
+	TArray<FHoudiniPointRecord> PointRecords;
+
+	// Attribute name to attribute index map, including the vector attribute names.
+	// Not serialized, rebuilt on load and after import from AttributeArray.
+	TMap<FName, int32> AttributeIndexMap;
+
+	// Evaluations shared by the data interfaces, see GetSharedEvaluationAtTime. Not serialized.
+	mutable TArray< TSharedPtr<FHoudiniPointCacheSharedEvaluation, ESPMode::ThreadSafe> > SharedEvaluations;
+	mutable FCriticalSection SharedEvaluationsLock;
+
+	// Legacy per-point sample index arrays, converted to PointSampleIndexOffsets / PointSampleIndexes on load
 	UPROPERTY()
-	TArray< FPointIndexes > PointValueIndexes;
+	TArray< FPointIndexes > PointValueIndexes_DEPRECATED;
 
 	/** For CSV source files, whether to use a custom title row. */
 	UPROPERTY()
@@ -35,11 +35,11 @@ struct FHoudiniPointCacheSortPredicate
     template<class T>
 	bool operator()( const TArray<T>& A, const TArray<T>& B ) const
     {
-        float ATime = TNumericLimits< float >::Lowest();
+        T ATime = TNumericLimits< T >::Lowest();
         if ( A.IsValidIndex( TimeAttributeIndex ) )
             ATime = A[ TimeAttributeIndex ];
 
-        float BTime = TNumericLimits< float >::Lowest();
+        T BTime = TNumericLimits< T >::Lowest();
         if ( B.IsValidIndex( TimeAttributeIndex ) )
             BTime = B[ TimeAttributeIndex ];
 
@@ -49,11 +49,11 @@ struct FHoudiniPointCacheSortPredicate
         }
         else
         {
-            float AAge = TNumericLimits< float >::Lowest();
+            T AAge = TNumericLimits< T >::Lowest();
             if (A.IsValidIndex(AgeAttributeIndex))
                 AAge = A[AgeAttributeIndex];
 
-            float BAge = TNumericLimits< float >::Lowest();
+            T BAge = TNumericLimits< T >::Lowest();
             if (B.IsValidIndex(AgeAttributeIndex))
                 BAge = B[AgeAttributeIndex];
 
@@ -63,11 +63,11 @@ struct FHoudiniPointCacheSortPredicate
             }
             else
             {
-                float AID = TNumericLimits< float >::Lowest();
+                T AID = TNumericLimits< T >::Lowest();
                 if (A.IsValidIndex(IDAttributeIndex))
                     AID = A[IDAttributeIndex];
 
-                float BID = TNumericLimits< float >::Lowest();
+                T BID = TNumericLimits< T >::Lowest();
                 if (B.IsValidIndex(IDAttributeIndex))
                     BID = B[IDAttributeIndex];
 
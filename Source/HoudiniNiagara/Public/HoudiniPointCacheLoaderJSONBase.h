@@ -64,6 +64,7 @@ class FHoudiniPointCacheLoaderJSONBase : public FHoudiniPointCacheLoader
          * @param InAsset The point cache asset to populate.
          * @param InFrameNumber The frame number
          * @param InFrameData The frame's data, an array of arrays (point and attribute values for the point).
+         *        Values are stored as doubles so that integer attributes and point ids are read without loss of precision.
          * @param InFrameTime The time, in seconds, of the frame.
          * @param InFrameStartSampleIndex The sample index of the first sample in the frame.
          * @param InNumPointsInFrame The number of points in this frame.
@@ -73,6 +74,9 @@ class FHoudiniPointCacheLoaderJSONBase : public FHoudiniPointCacheLoader
          * @param OutNextPointID The next point id (incremented everytime a new point is detected).
          * @return false if processing the frame failed.
          */
-        virtual bool ProcessFrame(UHoudiniPointCache *InAsset, float InFrameNumber, const TArray<TArray<float>> &InFrameData, float InFrameTime, uint32 InFrameStartSampleIndex, uint32 InNumPointsInFrame, uint32 InNumAttributesPerPoint, const FHoudiniPointCacheJSONHeader &InHeader, TMap<int32, int32>& InHoudiniIDToNiagaraIDMap, int32 &OutNextPointID) const;
+        virtual bool ProcessFrame(UHoudiniPointCache *InAsset, float InFrameNumber, const TArray<TArray<double>> &InFrameData, float InFrameTime, uint32 InFrameStartSampleIndex, uint32 InNumPointsInFrame, uint32 InNumAttributesPerPoint, const FHoudiniPointCacheJSONHeader &InHeader, TMap<int64, int32>& InHoudiniIDToNiagaraIDMap, int32 &OutNextPointID) const;
+
+        /** Returns true if InDataType, an entry of the header's attrib_data_type, is an integer type (see the FHoudiniPointCacheLoaderBJSON markers). */
+        static bool IsIntegerDataType(unsigned char InDataType);
 
 };